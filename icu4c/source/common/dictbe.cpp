@@ -28,6 +28,9 @@
 #include "unicode/normlzr.h"
 #include "cmemory.h"
 #include "dictionarydata.h"
+#include "mutex.h"
+#include "uhash.h"
+#include "ustr_imp.h"
 
 U_NAMESPACE_BEGIN
 
@@ -1053,11 +1056,170 @@ KhmerBreakEngine::divideUpDictionaryRange( UText *text,
  * CjkBreakEngine
  */
 static const uint32_t kuint32max = 0xFFFFFFFF;
+/**
+ * Bounded least-recently-used map from runs of normalized CJK text
+ * to the code point boundaries of their best segmentation.
+ * A CjkBreakEngine is shared by all break iterators for its languages,
+ * so the cache is used under a mutex.
+ */
+class CjkBreakCache : public UMemory {
+public:
+    CjkBreakCache(int32_t capacity, UErrorCode &status);
+    ~CjkBreakCache();
+
+    // Copies the boundaries cached for the text into boundaries[]
+    // and returns their number, or returns -1 if the text is not cached.
+    int32_t get(const UnicodeString &text, UBool isPhraseBreaking, int32_t *boundaries);
+    void put(const UnicodeString &text, UBool isPhraseBreaking,
+             const int32_t *boundaries, int32_t count, UErrorCode &status);
+
+    // Longer runs are not cached.
+    static constexpr int32_t kMaxTextLength = 128;
+
+private:
+    struct Entry : public UMemory {
+        UnicodeString text;
+        UBool isPhraseBreaking = false;
+        int32_t count = 0;
+        MaybeStackArray<int32_t, 16> boundaries;
+        Entry *newer = nullptr;
+        Entry *older = nullptr;
+    };
+
+    static int32_t U_CALLCONV hashEntry(const UHashTok key);
+    static UBool U_CALLCONV compareEntries(const UHashTok key1, const UHashTok key2);
+    void unlink(Entry *entry);
+    void makeNewest(Entry *entry);
+
+    UMutex fMutex;
+    UHashtable *fMap = nullptr;
+    Entry *fNewest = nullptr;
+    Entry *fOldest = nullptr;
+    int32_t fSize = 0;
+    int32_t fCapacity;
+};
+
+CjkBreakCache::CjkBreakCache(int32_t capacity, UErrorCode &status) : fCapacity(capacity) {
+    fMap = uhash_open(hashEntry, compareEntries, nullptr, &status);
+}
+
+CjkBreakCache::~CjkBreakCache() {
+    uhash_close(fMap);
+    while (fNewest != nullptr) {
+        Entry *next = fNewest->older;
+        delete fNewest;
+        fNewest = next;
+    }
+}
+
+int32_t U_CALLCONV CjkBreakCache::hashEntry(const UHashTok key) {
+    const Entry *entry = static_cast<const Entry *>(key.pointer);
+    return ustr_hashUCharsN(entry->text.getBuffer(), entry->text.length()) * 2 +
+        (entry->isPhraseBreaking ? 1 : 0);
+}
+
+UBool U_CALLCONV CjkBreakCache::compareEntries(const UHashTok key1, const UHashTok key2) {
+    const Entry *entry1 = static_cast<const Entry *>(key1.pointer);
+    const Entry *entry2 = static_cast<const Entry *>(key2.pointer);
+    return entry1->isPhraseBreaking == entry2->isPhraseBreaking && entry1->text == entry2->text;
+}
+
+void CjkBreakCache::unlink(Entry *entry) {
+    if (entry->newer != nullptr) {
+        entry->newer->older = entry->older;
+    } else {
+        fNewest = entry->older;
+    }
+    if (entry->older != nullptr) {
+        entry->older->newer = entry->newer;
+    } else {
+        fOldest = entry->newer;
+    }
+    entry->newer = entry->older = nullptr;
+}
+
+void CjkBreakCache::makeNewest(Entry *entry) {
+    entry->older = fNewest;
+    if (fNewest != nullptr) {
+        fNewest->newer = entry;
+    } else {
+        fOldest = entry;
+    }
+    fNewest = entry;
+}
+
+int32_t CjkBreakCache::get(const UnicodeString &text, UBool isPhraseBreaking, int32_t *boundaries) {
+    Entry key;
+    key.text.setTo(false, text.getBuffer(), text.length());  // read-only alias
+    key.isPhraseBreaking = isPhraseBreaking;
+    Mutex lock(&fMutex);
+    Entry *entry = static_cast<Entry *>(uhash_get(fMap, &key));
+    if (entry == nullptr) {
+        return -1;
+    }
+    if (entry != fNewest) {
+        unlink(entry);
+        makeNewest(entry);
+    }
+    uprv_memcpy(boundaries, entry->boundaries.getAlias(), entry->count * sizeof(int32_t));
+    return entry->count;
+}
+
+void CjkBreakCache::put(const UnicodeString &text, UBool isPhraseBreaking,
+                        const int32_t *boundaries, int32_t count, UErrorCode &status) {
+    if (U_FAILURE(status)) { return; }
+    Entry key;
+    key.text.setTo(false, text.getBuffer(), text.length());
+    key.isPhraseBreaking = isPhraseBreaking;
+    Mutex lock(&fMutex);
+    if (uhash_get(fMap, &key) != nullptr) {
+        return;  // Another thread segmented the same text meanwhile.
+    }
+    Entry *entry;
+    if (fSize < fCapacity) {
+        entry = new Entry();
+        if (entry == nullptr) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        ++fSize;
+    } else {
+        // Reuse the least recently used entry.
+        entry = fOldest;
+        uhash_remove(fMap, entry);
+        unlink(entry);
+    }
+    entry->text = text;
+    entry->isPhraseBreaking = isPhraseBreaking;
+    if (count > entry->boundaries.getCapacity() &&
+            entry->boundaries.resize(count) == nullptr) {
+        entry->count = 0;
+        status = U_MEMORY_ALLOCATION_ERROR;
+    } else {
+        uprv_memcpy(entry->boundaries.getAlias(), boundaries, count * sizeof(int32_t));
+        entry->count = count;
+        if (!entry->text.isBogus()) {
+            uhash_put(fMap, entry, entry, &status);
+        }
+    }
+    // Keep the entry in the list even if it is not in the map,
+    // so that the destructor deletes it.
+    makeNewest(entry);
+}
+
 CjkBreakEngine::CjkBreakEngine(DictionaryMatcher *adoptDictionary, LanguageType type, UErrorCode &status)
-: DictionaryBreakEngine(), fDictionary(adoptDictionary), isCj(false) {
+: DictionaryBreakEngine(), fDictionary(adoptDictionary), isCj(false), fCache(nullptr) {
     UTRACE_ENTRY(UTRACE_UBRK_CREATE_BREAK_ENGINE);
     UTRACE_DATA1(UTRACE_INFO, "dictbe=%s", "Hani");
     fMlBreakEngine = nullptr;
+#if UCONFIG_CJK_BREAK_CACHE_SIZE > 0
+    if (U_SUCCESS(status)) {
+        fCache = new CjkBreakCache(UCONFIG_CJK_BREAK_CACHE_SIZE, status);
+        if (fCache == nullptr) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+    }
+#endif
     nfkcNorm2 = Normalizer2::getNFKCInstance(status);
     // Korean dictionary only includes Hangul syllables
     fHangulWordSet.applyPattern(UnicodeString(u"[\\uac00-\\ud7a3]"), status);
@@ -1096,6 +1258,7 @@ CjkBreakEngine::CjkBreakEngine(DictionaryMatcher *adoptDictionary, LanguageType
 CjkBreakEngine::~CjkBreakEngine(){
     delete fDictionary;
     delete fMlBreakEngine;
+    delete fCache;
 }
 
 // The katakanaCost values below are based on the length frequencies of all
@@ -1271,30 +1434,136 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     }
 #endif
 
-    // bestSnlp[i] is the snlp of the best segmentation of the first i
-    // code points in the range to be matched.
-    UVector32 bestSnlp(numCodePts + 1, status);
-    bestSnlp.addElement(0, status);
-    for(int32_t i = 1; i <= numCodePts; i++) {
-        bestSnlp.addElement(kuint32max, status);
+    // t_boundary (t for tentative) receives the boundaries of the best segmentation,
+    // in code point indexes from the end backwards, with room for one at the start.
+    MaybeStackArray<int32_t, 64> t_boundary;
+    if (numCodePts + 2 > t_boundary.getCapacity() && t_boundary.resize(numCodePts + 2) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    int32_t numBreaks = -1;
+    bool useCache = fCache != nullptr && inString.length() <= CjkBreakCache::kMaxTextLength;
+    if (useCache) {
+        numBreaks = fCache->get(inString, isPhraseBreaking, t_boundary.getAlias());
+    }
+    if (numBreaks < 0) {
+        numBreaks = findBestSegmentation(inString, numCodePts, isPhraseBreaking,
+                                         t_boundary.getAlias(), status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        if (useCache) {
+            // Not being able to cache the result is not an error.
+            UErrorCode cacheStatus = U_ZERO_ERROR;
+            fCache->put(inString, isPhraseBreaking, t_boundary.getAlias(), numBreaks, cacheStatus);
+        }
+    }
+
+    // Add a break for the start of the dictionary range if there is not one
+    // there already.
+    if (foundBreaks.size() == 0 || foundBreaks.peeki() < rangeStart) {
+        t_boundary[numBreaks++] = 0;
+    }
+
+    // Now that we're done, convert positions in t_boundary[] (indices in 
+    // the normalized input string) back to indices in the original input UText
+    // while reversing t_boundary and pushing values to foundBreaks.
+    int32_t prevCPPos = -1;
+    int32_t prevUTextPos = -1;
+    int32_t correctedNumBreaks = 0;
+    for (int32_t i = numBreaks - 1; i >= 0; i--) {
+        int32_t cpPos = t_boundary[i];
+        U_ASSERT(cpPos > prevCPPos);
+        int32_t utextPos =  inputMap.isValid() ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
+        U_ASSERT(utextPos >= prevUTextPos);
+        if (utextPos > prevUTextPos) {
+            // Boundaries are added to foundBreaks output in ascending order.
+            U_ASSERT(foundBreaks.size() == 0 || foundBreaks.peeki() < utextPos);
+            // In phrase breaking, there has to be a breakpoint between Cj character and close
+            // punctuation.
+            // E.g.［携帯電話］正しい選択 -> ［携帯▁電話］▁正しい▁選択 -> breakpoint between ］ and 正
+            if (utextPos != rangeStart
+                || (isPhraseBreaking && utextPos > 0
+                       && fClosePunctuationSet.contains(utext_char32At(inText, utextPos - 1)))) {
+                foundBreaks.push(utextPos, status);
+                correctedNumBreaks++;
+            }
+        } else {
+            // Normalization expanded the input text, the dictionary found a boundary
+            // within the expansion, giving two boundaries with the same index in the
+            // original text. Ignore the second. See ticket #12918.
+            --numBreaks;
+        }
+        prevCPPos = cpPos;
+        prevUTextPos = utextPos;
+    }
+    (void)prevCPPos; // suppress compiler warnings about unused variable
+
+    UChar32 nextChar = utext_char32At(inText, rangeEnd);
+    if (!foundBreaks.isEmpty() && foundBreaks.peeki() == rangeEnd) {
+        // In phrase breaking, there has to be a breakpoint between Cj character and
+        // the number/open punctuation.
+        // E.g. る文字「そうだ、京都」->る▁文字▁「そうだ、▁京都」-> breakpoint between 字 and「
+        // E.g. 乗車率９０％程度だろうか -> 乗車▁率▁９０％▁程度だろうか -> breakpoint between 率 and ９
+        // E.g. しかもロゴがＵｎｉｃｏｄｅ！ -> しかも▁ロゴが▁Ｕｎｉｃｏｄｅ！-> breakpoint between が and Ｕ
+        if (isPhraseBreaking) {
+            if (!fDigitOrOpenPunctuationOrAlphabetSet.contains(nextChar)) {
+                foundBreaks.popi();
+                correctedNumBreaks--;
+            }
+        } else {
+            foundBreaks.popi();
+            correctedNumBreaks--;
+        }
     }
 
+    // inString goes out of scope
+    // inputMap goes out of scope
+    return correctedNumBreaks;
+}
 
+/*
+ * @param inString The normalized text of a range of dictionary characters
+ * @param numCodePts The number of code points in inString
+ * @param t_boundary Receives the boundaries, from the end backwards
+ * @return The number of boundaries
+ */
+int32_t
+CjkBreakEngine::findBestSegmentation(const UnicodeString &inString, int32_t numCodePts,
+                                     UBool isPhraseBreaking, int32_t *t_boundary,
+                                     UErrorCode &status) const {
+    if (U_FAILURE(status)) return 0;
+    // The work arrays are on the stack for short runs,
+    // so that segmenting typical text does not allocate memory.
+    // bestSnlp[i] is the snlp of the best segmentation of the first i
+    // code points in the range to be matched.
+    MaybeStackArray<uint32_t, 64> bestSnlp;
     // prev[i] is the index of the last CJK code point in the previous word in 
     // the best segmentation of the first i characters.
-    UVector32 prev(numCodePts + 1, status);
+    MaybeStackArray<int32_t, 64> prev;
+    MaybeStackArray<int32_t, 64> values;
+    MaybeStackArray<int32_t, 64> lengths;
+    if (numCodePts + 1 > bestSnlp.getCapacity() &&
+            (bestSnlp.resize(numCodePts + 1) == nullptr || prev.resize(numCodePts + 1) == nullptr ||
+             values.resize(numCodePts + 1) == nullptr || lengths.resize(numCodePts + 1) == nullptr)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    bestSnlp[0] = 0;
+    for(int32_t i = 1; i <= numCodePts; i++) {
+        bestSnlp[i] = kuint32max;
+    }
     for(int32_t i = 0; i <= numCodePts; i++){
-        prev.addElement(-1, status);
+        prev[i] = -1;
     }
 
     const int32_t maxWordSize = 20;
-    UVector32 values(numCodePts, status);
-    values.setSize(numCodePts);
-    UVector32 lengths(numCodePts, status);
-    lengths.setSize(numCodePts);
 
     UText fu = UTEXT_INITIALIZER;
-    utext_openUnicodeString(&fu, &inString, &status);
+    utext_openConstUnicodeString(&fu, &inString, &status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
 
     // Dynamic programming to find the best segmentation.
 
@@ -1304,14 +1573,14 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     int32_t ix = 0;
     bool is_prev_katakana = false;
     for (int32_t i = 0;  i < numCodePts;  ++i, ix = inString.moveIndex32(ix, 1)) {
-        if (static_cast<uint32_t>(bestSnlp.elementAti(i)) == kuint32max) {
+        if (bestSnlp[i] == kuint32max) {
             continue;
         }
 
         int32_t count;
         utext_setNativeIndex(&fu, ix);
         count = fDictionary->matches(&fu, maxWordSize, numCodePts,
-                             nullptr, lengths.getBuffer(), values.getBuffer(), nullptr);
+                             nullptr, lengths.getAlias(), values.getAlias(), nullptr);
                              // Note: lengths is filled with code point lengths
                              //       The nullptr parameter is the ignored code unit lengths.
 
@@ -1320,18 +1589,18 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         // with the highest value possible, i.e. the least likely to occur.
         // Exclude Korean characters from this treatment, as they should be left
         // together by default.
-        if ((count == 0 || lengths.elementAti(0) != 1) &&
+        if ((count == 0 || lengths[0] != 1) &&
                 !fHangulWordSet.contains(inString.char32At(ix))) {
-            values.setElementAt(maxSnlp, count);   // 255
-            lengths.setElementAt(1, count++);
+            values[count] = maxSnlp;   // 255
+            lengths[count++] = 1;
         }
 
         for (int32_t j = 0; j < count; j++) {
-            uint32_t newSnlp = static_cast<uint32_t>(bestSnlp.elementAti(i)) + static_cast<uint32_t>(values.elementAti(j));
-            int32_t ln_j_i = lengths.elementAti(j) + i;
-            if (newSnlp < static_cast<uint32_t>(bestSnlp.elementAti(ln_j_i))) {
-                bestSnlp.setElementAt(newSnlp, ln_j_i);
-                prev.setElementAt(i, ln_j_i);
+            uint32_t newSnlp = bestSnlp[i] + static_cast<uint32_t>(values[j]);
+            int32_t ln_j_i = lengths[j] + i;
+            if (newSnlp < bestSnlp[ln_j_i]) {
+                bestSnlp[ln_j_i] = newSnlp;
+                prev[ln_j_i] = i;
             }
         }
 
@@ -1352,10 +1621,10 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
                 katakanaRunLength++;
             }
             if (katakanaRunLength < kMaxKatakanaGroupLength) {
-                uint32_t newSnlp = bestSnlp.elementAti(i) + getKatakanaCost(katakanaRunLength);
-                if (newSnlp < static_cast<uint32_t>(bestSnlp.elementAti(i + katakanaRunLength))) {
-                    bestSnlp.setElementAt(newSnlp, i+katakanaRunLength);
-                    prev.setElementAt(i, i+katakanaRunLength);  // prev[j] = i;
+                uint32_t newSnlp = bestSnlp[i] + getKatakanaCost(katakanaRunLength);
+                if (newSnlp < bestSnlp[i + katakanaRunLength]) {
+                    bestSnlp[i + katakanaRunLength] = newSnlp;
+                    prev[i + katakanaRunLength] = i;  // prev[j] = i;
                 }
             }
         }
@@ -1365,110 +1634,40 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
 
     // Start pushing the optimal offset index into t_boundary (t for tentative).
     // prev[numCodePts] is guaranteed to be meaningful.
-    // We'll first push in the reverse order, i.e.,
-    // t_boundary[0] = numCodePts, and afterwards do a swap.
-    UVector32 t_boundary(numCodePts+1, status);
-
+    // We push in the reverse order, i.e., t_boundary[0] = numCodePts.
     int32_t numBreaks = 0;
     // No segmentation found, set boundary to end of range
-    if (static_cast<uint32_t>(bestSnlp.elementAti(numCodePts)) == kuint32max) {
-        t_boundary.addElement(numCodePts, status);
-        numBreaks++;
+    if (bestSnlp[numCodePts] == kuint32max) {
+        t_boundary[numBreaks++] = numCodePts;
     } else if (isPhraseBreaking) {
-        t_boundary.addElement(numCodePts, status);
-        if(U_SUCCESS(status)) {
-            numBreaks++;
-            int32_t prevIdx = numCodePts;
-
-            int32_t codeUnitIdx = -1;
-            int32_t prevCodeUnitIdx = -1;
-            int32_t length = -1;
-            for (int32_t i = prev.elementAti(numCodePts); i > 0; i = prev.elementAti(i)) {
-                codeUnitIdx = inString.moveIndex32(0, i);
-                prevCodeUnitIdx = inString.moveIndex32(0, prevIdx);
-                // Calculate the length by using the code unit.
-                length = prevCodeUnitIdx - codeUnitIdx;
-                prevIdx = i;
-                // Keep the breakpoint if the pattern is not in the fSkipSet and continuous Katakana
-                // characters don't occur.
-                if (!fSkipSet.containsKey(inString.tempSubString(codeUnitIdx, length))
-                    && (!isKatakana(inString.char32At(inString.moveIndex32(codeUnitIdx, -1)))
-                           || !isKatakana(inString.char32At(codeUnitIdx)))) {
-                    t_boundary.addElement(i, status);
-                    numBreaks++;
-                }
+        t_boundary[numBreaks++] = numCodePts;
+        int32_t prevIdx = numCodePts;
+
+        int32_t codeUnitIdx = -1;
+        int32_t prevCodeUnitIdx = -1;
+        int32_t length = -1;
+        for (int32_t i = prev[numCodePts]; i > 0; i = prev[i]) {
+            codeUnitIdx = inString.moveIndex32(0, i);
+            prevCodeUnitIdx = inString.moveIndex32(0, prevIdx);
+            // Calculate the length by using the code unit.
+            length = prevCodeUnitIdx - codeUnitIdx;
+            prevIdx = i;
+            // Keep the breakpoint if the pattern is not in the fSkipSet and continuous Katakana
+            // characters don't occur.
+            if (!fSkipSet.containsKey(inString.tempSubString(codeUnitIdx, length))
+                && (!isKatakana(inString.char32At(inString.moveIndex32(codeUnitIdx, -1)))
+                       || !isKatakana(inString.char32At(codeUnitIdx)))) {
+                t_boundary[numBreaks++] = i;
             }
         }
     } else {
-        for (int32_t i = numCodePts; i > 0; i = prev.elementAti(i)) {
-            t_boundary.addElement(i, status);
-            numBreaks++;
-        }
-        U_ASSERT(prev.elementAti(t_boundary.elementAti(numBreaks - 1)) == 0);
-    }
-
-    // Add a break for the start of the dictionary range if there is not one
-    // there already.
-    if (foundBreaks.size() == 0 || foundBreaks.peeki() < rangeStart) {
-        t_boundary.addElement(0, status);
-        numBreaks++;
-    }
-
-    // Now that we're done, convert positions in t_boundary[] (indices in 
-    // the normalized input string) back to indices in the original input UText
-    // while reversing t_boundary and pushing values to foundBreaks.
-    int32_t prevCPPos = -1;
-    int32_t prevUTextPos = -1;
-    int32_t correctedNumBreaks = 0;
-    for (int32_t i = numBreaks - 1; i >= 0; i--) {
-        int32_t cpPos = t_boundary.elementAti(i);
-        U_ASSERT(cpPos > prevCPPos);
-        int32_t utextPos =  inputMap.isValid() ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
-        U_ASSERT(utextPos >= prevUTextPos);
-        if (utextPos > prevUTextPos) {
-            // Boundaries are added to foundBreaks output in ascending order.
-            U_ASSERT(foundBreaks.size() == 0 || foundBreaks.peeki() < utextPos);
-            // In phrase breaking, there has to be a breakpoint between Cj character and close
-            // punctuation.
-            // E.g.［携帯電話］正しい選択 -> ［携帯▁電話］▁正しい▁選択 -> breakpoint between ］ and 正
-            if (utextPos != rangeStart
-                || (isPhraseBreaking && utextPos > 0
-                       && fClosePunctuationSet.contains(utext_char32At(inText, utextPos - 1)))) {
-                foundBreaks.push(utextPos, status);
-                correctedNumBreaks++;
-            }
-        } else {
-            // Normalization expanded the input text, the dictionary found a boundary
-            // within the expansion, giving two boundaries with the same index in the
-            // original text. Ignore the second. See ticket #12918.
-            --numBreaks;
+        for (int32_t i = numCodePts; i > 0; i = prev[i]) {
+            t_boundary[numBreaks++] = i;
         }
-        prevCPPos = cpPos;
-        prevUTextPos = utextPos;
+        U_ASSERT(prev[t_boundary[numBreaks - 1]] == 0);
     }
-    (void)prevCPPos; // suppress compiler warnings about unused variable
+    return numBreaks;
 
-    UChar32 nextChar = utext_char32At(inText, rangeEnd);
-    if (!foundBreaks.isEmpty() && foundBreaks.peeki() == rangeEnd) {
-        // In phrase breaking, there has to be a breakpoint between Cj character and
-        // the number/open punctuation.
-        // E.g. る文字「そうだ、京都」->る▁文字▁「そうだ、▁京都」-> breakpoint between 字 and「
-        // E.g. 乗車率９０％程度だろうか -> 乗車▁率▁９０％▁程度だろうか -> breakpoint between 率 and ９
-        // E.g. しかもロゴがＵｎｉｃｏｄｅ！ -> しかも▁ロゴが▁Ｕｎｉｃｏｄｅ！-> breakpoint between が and Ｕ
-        if (isPhraseBreaking) {
-            if (!fDigitOrOpenPunctuationOrAlphabetSet.contains(nextChar)) {
-                foundBreaks.popi();
-                correctedNumBreaks--;
-            }
-        } else {
-            foundBreaks.popi();
-            correctedNumBreaks--;
-        }
-    }
-
-    // inString goes out of scope
-    // inputMap goes out of scope
-    return correctedNumBreaks;
 }
 
 void CjkBreakEngine::initJapanesePhraseParameter(UErrorCode& error) {
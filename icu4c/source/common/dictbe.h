@@ -21,6 +21,7 @@
 
 U_NAMESPACE_BEGIN
 
+class CjkBreakCache;
 class DictionaryMatcher;
 class MlBreakEngine;
 class Normalizer2;
@@ -387,8 +388,17 @@ class CjkBreakEngine : public DictionaryBreakEngine {
   void loadHiragana(UErrorCode& error);
   // Initialize fSkipSet by loading Japanese Hiragana and extensions.
   void initJapanesePhraseParameter(UErrorCode& error);
+  // Find the best segmentation of the normalized text with numCodePts code points.
+  // Writes code point boundaries into boundaries[] (capacity numCodePts + 2)
+  // from the end of the text backwards, and returns their number.
+  int32_t findBestSegmentation(const UnicodeString &inString, int32_t numCodePts,
+                               UBool isPhraseBreaking, int32_t *boundaries,
+                               UErrorCode &status) const;
 
   Hashtable fSkipSet;
+  // Recently segmented runs, shared by all break iterators using this engine.
+  // nullptr if disabled.
+  CjkBreakCache *fCache;
 
  public:
 
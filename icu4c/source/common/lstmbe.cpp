@@ -76,7 +76,7 @@ ReadArray2D::~ReadArray2D()
  * A class to index a float array as a 1D Array without owning the pointer or
  * copy the data.
  */
-class ConstArray1D : public ReadArray1D {
+class ConstArray1D final : public ReadArray1D {
 public:
     ConstArray1D() : data_(nullptr), d1_(0) {}
 
@@ -99,6 +99,8 @@ class ConstArray1D : public ReadArray1D {
         return data_[i];
     }
 
+    inline const float* data() const { return data_; }
+
 private:
     const float* data_;
     int32_t d1_;
@@ -112,7 +114,7 @@ ConstArray1D::~ConstArray1D()
  * A class to index a float array as a 2D Array without owning the pointer or
  * copy the data.
  */
-class ConstArray2D : public ReadArray2D {
+class ConstArray2D final : public ReadArray2D {
 public:
     ConstArray2D() : data_(nullptr), d1_(0), d2_(0) {}
 
@@ -145,6 +147,8 @@ class ConstArray2D : public ReadArray2D {
         return ConstArray1D(data_ + i * d2_, d2_);
     }
 
+    inline const float* data() const { return data_; }
+
 private:
     const float* data_;
     int32_t d1_;
@@ -159,7 +163,7 @@ ConstArray2D::~ConstArray2D()
  * A class to allocate data as a writable 1D array.
  * This is the main class implement matrix operation.
  */
-class Array1D : public ReadArray1D {
+class Array1D final : public ReadArray1D {
 public:
     Array1D() : memory_(nullptr), data_(nullptr), d1_(0) {}
     Array1D(int32_t d1, UErrorCode &status)
@@ -210,51 +214,46 @@ class Array1D : public ReadArray1D {
     }
 
     // Add dot product of a 1D array and a 2D array into this one.
-    inline Array1D& addDotProduct(const ReadArray1D& a, const ReadArray2D& b) {
-        U_ASSERT(a.d1() == b.d1());
-        U_ASSERT(b.d2() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            for (int32_t j = 0; j < a.d1(); j++) {
-                data_[i] += a.get(j) * b.get(j, i);
-            }
-        }
-        return *this;
+    inline Array1D& addDotProduct(const ConstArray1D& a, const ConstArray2D& b) {
+        return addDotProduct(a.data(), a.d1(), b);
+    }
+
+    inline Array1D& addDotProduct(const Array1D& a, const ConstArray2D& b) {
+        return addDotProduct(a.data_, a.d1_, b);
     }
 
     // Hadamard Product the values of another array of the same size into this one.
-    inline Array1D& hadamardProduct(const ReadArray1D& a) {
+    inline Array1D& hadamardProduct(const Array1D& a) {
         U_ASSERT(a.d1() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            data_[i] *= a.get(i);
+        const float* aData = a.data_;
+        for (int32_t i = 0; i < d1_; i++) {
+            data_[i] *= aData[i];
         }
         return *this;
     }
 
     // Add the Hadamard Product of two arrays of the same size into this one.
-    inline Array1D& addHadamardProduct(const ReadArray1D& a, const ReadArray1D& b) {
+    inline Array1D& addHadamardProduct(const Array1D& a, const Array1D& b) {
         U_ASSERT(a.d1() == d1());
         U_ASSERT(b.d1() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            data_[i] += a.get(i) * b.get(i);
+        const float* aData = a.data_;
+        const float* bData = b.data_;
+        for (int32_t i = 0; i < d1_; i++) {
+            data_[i] += aData[i] * bData[i];
         }
         return *this;
     }
 
-    // Add the values of another array of the same size into this one.
-    inline Array1D& add(const ReadArray1D& a) {
+    // Assign the values of another array of the same size into this one.
+    inline Array1D& assign(const ConstArray1D& a) {
         U_ASSERT(a.d1() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            data_[i] += a.get(i);
-        }
+        uprv_memcpy(data_, a.data(), d1_ * sizeof(float));
         return *this;
     }
 
-    // Assign the values of another array of the same size into this one.
-    inline Array1D& assign(const ReadArray1D& a) {
+    inline Array1D& assign(const Array1D& a) {
         U_ASSERT(a.d1() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            data_[i] = a.get(i);
-        }
+        uprv_memcpy(data_, a.data_, d1_ * sizeof(float));
         return *this;
     }
 
@@ -266,8 +265,9 @@ class Array1D : public ReadArray1D {
     // Apply tanh of a and store into this array.
     inline Array1D& tanh(const Array1D& a) {
         U_ASSERT(a.d1() == d1());
+        const float* aData = a.data_;
         for (int32_t i = 0; i < d1_; i++) {
-            data_[i] = std::tanh(a.get(i));
+            data_[i] = std::tanh(aData[i]);
         }
         return *this;
     }
@@ -286,6 +286,23 @@ class Array1D : public ReadArray1D {
     }
 
 private:
+    // Add the product of the vector a and the matrix b into this one.
+    // The outer loop runs over the rows of b, so that the inner loop reads
+    // b sequentially and the compiler can vectorize it.
+    // Each element still sums its products in the order of j.
+    inline Array1D& addDotProduct(const float* a, int32_t aLength, const ConstArray2D& b) {
+        U_ASSERT(aLength == b.d1());
+        U_ASSERT(b.d2() == d1());
+        const float* bRow = b.data();
+        for (int32_t j = 0; j < aLength; j++, bRow += d1_) {
+            float aj = a[j];
+            for (int32_t i = 0; i < d1_; i++) {
+                data_[i] += aj * bRow[i];
+            }
+        }
+        return *this;
+    }
+
     void* memory_;
     float* data_;
     int32_t d1_;
@@ -296,7 +313,7 @@ Array1D::~Array1D()
     uprv_free(memory_);
 }
 
-class Array2D : public ReadArray2D {
+class Array2D final : public ReadArray2D {
 public:
     Array2D() : memory_(nullptr), data_(nullptr), d1_(0), d2_(0) {}
     Array2D(int32_t d1, int32_t d2, UErrorCode &status)
@@ -371,9 +388,13 @@ struct LSTMData : public UMemory {
     ConstArray1D fBackwardB;
     ConstArray2D fOutputW;
     ConstArray1D fOutputB;
+    // x * W + b for each embedding row x, for the forward and backward LSTM.
+    ConstArray2D fForwardInput;
+    ConstArray2D fBackwardInput;
 
 private:
     UResourceBundle* fBundle;
+    LocalMemory<float> fInputMemory;
 };
 
 LSTMData::LSTMData(UResourceBundle* rb, UErrorCode &status)
@@ -462,6 +483,25 @@ LSTMData::LSTMData(UResourceBundle* rb, UErrorCode &status)
     fOutputW.init(data, 2 * hunits, 4);
     data += mat8_size;
     fOutputB.init(data, 4);
+
+    // The input part of the LSTM gates depends only on the embedding row,
+    // so compute it once per row here rather than once per character.
+    int32_t num_rows = num_index + 1;
+    if (fInputMemory.allocateInsteadAndReset(2 * num_rows * 4 * hunits) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    float* forwardInput = fInputMemory.getAlias();
+    float* backwardInput = forwardInput + num_rows * 4 * hunits;
+    for (int32_t i = 0; i < num_rows; i++) {
+        ConstArray1D x = fEmbedding.row(i);
+        Array1D(forwardInput + i * 4 * hunits, 4 * hunits)
+            .assign(fForwardB).addDotProduct(x, fForwardW);
+        Array1D(backwardInput + i * 4 * hunits, 4 * hunits)
+            .assign(fBackwardB).addDotProduct(x, fBackwardW);
+    }
+    fForwardInput = ConstArray2D(forwardInput, num_rows, 4 * hunits);
+    fBackwardInput = ConstArray2D(backwardInput, num_rows, 4 * hunits);
 }
 
 LSTMData::~LSTMData() {
@@ -602,18 +642,18 @@ void GraphemeClusterVectorizer::vectorize(
 
 // Computing LSTM as stated in
 // https://en.wikipedia.org/wiki/Long_short-term_memory#LSTM_with_a_forget_gate
+// xWb is the precomputed x * W + b for the input x.
 // ifco is temp array allocate outside which does not need to be
 // input/output value but could avoid unnecessary memory alloc/free if passing
 // in.
 void compute(
     int32_t hunits,
-    const ReadArray2D& W, const ReadArray2D& U, const ReadArray1D& b,
-    const ReadArray1D& x, Array1D& h, Array1D& c,
+    const ConstArray2D& U, const ConstArray1D& xWb,
+    Array1D& h, Array1D& c,
     Array1D& ifco)
 {
-    // ifco = x * W + h * U + b
-    ifco.assign(b)
-        .addDotProduct(x, W)
+    // ifco = x * W + b + h * U
+    ifco.assign(xWb)
         .addDotProduct(h, U);
 
     ifco.slice(0*hunits, hunits).sigmoid();  // i: sigmod
@@ -696,8 +736,7 @@ LSTMBreakEngine::divideUpDictionaryRange( UText *text,
         fData->fEmbedding.row(indicesBuf[i]).print();
 #endif  // LSTM_DEBUG
         compute(hunits,
-                fData->fBackwardW, fData->fBackwardU, fData->fBackwardB,
-                fData->fEmbedding.row(indicesBuf[i]),
+                fData->fBackwardU, fData->fBackwardInput.row(indicesBuf[i]),
                 hRow, c, ifco);
     }
 
@@ -717,8 +756,7 @@ LSTMBreakEngine::divideUpDictionaryRange( UText *text,
         // Calculate the result into forwardRow, which point to the data in the first half
         // of fbRow.
         compute(hunits,
-                fData->fForwardW, fData->fForwardU, fData->fForwardB,
-                fData->fEmbedding.row(indicesBuf[i]),
+                fData->fForwardU, fData->fForwardInput.row(indicesBuf[i]),
                 forwardRow, c, ifco);
 
         // assign the data from hBackward.row(i) to second half of fbRowa.
@@ -25,6 +25,8 @@
 #include "unicode/stringoptions.h"
 #include "unicode/unistr.h"
 #include "unicode/unorm.h"
+#include "unicode/utf8.h"
+#include "charstr.h"
 #include "cstring.h"
 #include "mutex.h"
 #include "norm2allmodes.h"
@@ -288,6 +290,105 @@ Normalizer2Factory::getNFCImpl(UErrorCode &errorCode) {
 }
 #endif  // NORM2_HARDCODE_NFC_DATA
 
+// Normalizer2UTF8Stream --------------------------------------------------- ***
+
+Normalizer2UTF8Stream::Normalizer2UTF8Stream(const Normalizer2 &n2, ByteSink &bs,
+                                             uint32_t opts, Edits *e, UErrorCode &errorCode)
+        : norm2(n2), sink(bs), options(opts | U_EDITS_NO_RESET), edits(e), tail(nullptr) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    tail = new CharString();
+    if (tail == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    if (edits != nullptr && (opts & U_EDITS_NO_RESET) == 0) {
+        edits->reset();
+    }
+}
+
+Normalizer2UTF8Stream::~Normalizer2UTF8Stream() {
+    delete tail;
+}
+
+void
+Normalizer2UTF8Stream::normalize(const char *s, int32_t length, UErrorCode &errorCode) {
+    if (length > 0) {
+        norm2.normalizeUTF8(options, StringPiece(s, length), sink, edits, errorCode);
+    }
+}
+
+void
+Normalizer2UTF8Stream::append(StringPiece chunk, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (tail == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(chunk.data());
+    int32_t length = chunk.length();
+    int32_t start = 0;
+    if (!tail->isEmpty()) {
+        // Find the first boundary in the chunk, and normalize the kept text
+        // together with the chunk text before it.
+        // Trail bytes at the start of the chunk may continue a sequence in the tail.
+        while (start < length && start < 3 && U8_IS_TRAIL(s[start])) {
+            ++start;
+        }
+        for (;;) {
+            if (start == length) {
+                tail->append(chunk.data(), length, errorCode);
+                return;
+            }
+            int32_t prev = start;
+            UChar32 c;
+            U8_NEXT(s, start, length, c);
+            if (c >= 0 && norm2.hasBoundaryBefore(c)) {
+                start = prev;
+                break;
+            }
+        }
+        tail->append(chunk.data(), start, errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        normalize(tail->data(), tail->length(), errorCode);
+        tail->clear();
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+    }
+    // Find the last boundary in the rest of the chunk, normalize the text before it
+    // straight from the chunk, and keep the rest.
+    // Without a boundary, limit stops at start and the whole rest is kept.
+    int32_t limit = length;
+    while (limit > start) {
+        UChar32 c;
+        U8_PREV(s, start, limit, c);
+        if (c >= 0 && norm2.hasBoundaryBefore(c)) {
+            break;
+        }
+    }
+    normalize(chunk.data() + start, limit - start, errorCode);
+    tail->append(chunk.data() + limit, length - limit, errorCode);
+}
+
+void
+Normalizer2UTF8Stream::finish(UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (tail == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    normalize(tail->data(), tail->length(), errorCode);
+    tail->clear();
+}
+
 U_CDECL_BEGIN
 
 static UBool U_CALLCONV uprv_normalizer2_cleanup() {
@@ -40,6 +40,7 @@
 #include "uassert.h"
 #include "ucptrie_impl.h"
 #include "uset_imp.h"
+#include "ustr_ascii.h"
 #include "uvector.h"
 
 U_NAMESPACE_BEGIN
@@ -609,9 +610,15 @@ Normalizer2Impl::decompose(const char16_t *src, const char16_t *limit,
     for(;;) {
         // count code units below the minimum or with irrelevant data for the quick check
         for(prevSrc=src; src!=limit;) {
-            if( (c=*src)<minNoCP ||
-                isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if( (c=*src)<minNoCP ) {
+                ++src;
+                // Skip whole blocks of code units below the minimum at once,
+                // but not for an isolated one like a space between words.
+                if((limit-src)>=UPRV_ASCII_BLOCK_LENGTH && *src<minNoCP) {
+                    src+=uprv_spanUTF16Below(src, static_cast<int32_t>(limit-src),
+                                             static_cast<char16_t>(minNoCP));
+                }
+            } else if(isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else if(!U16_IS_LEAD(c)) {
                 break;
@@ -767,6 +774,11 @@ Normalizer2Impl::decomposeUTF8(uint32_t options,
             }
             if (*src < minNoLead) {
                 ++src;
+                // Skip whole blocks of bytes below the minimum lead byte at once,
+                // but not for an isolated one like a space between words.
+                if ((limit - src) >= UPRV_ASCII_BLOCK_LENGTH && *src < minNoLead) {
+                    src += uprv_spanUTF8Below(src, static_cast<int32_t>(limit - src), minNoLead);
+                }
             } else {
                 prevSrc = src;
                 UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
@@ -1490,9 +1502,15 @@ Normalizer2Impl::compose(const char16_t *src, const char16_t *limit,
                 }
                 return true;
             }
-            if( (c=*src)<minNoMaybeCP ||
-                isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if( (c=*src)<minNoMaybeCP ) {
+                ++src;
+                // Skip whole blocks of code units below the minimum at once,
+                // but not for an isolated one like a space between words.
+                if((limit-src)>=UPRV_ASCII_BLOCK_LENGTH && *src<minNoMaybeCP) {
+                    src+=uprv_spanUTF16Below(src, static_cast<int32_t>(limit-src),
+                                             static_cast<char16_t>(minNoMaybeCP));
+                }
+            } else if(isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else {
                 prevSrc = src++;
@@ -1751,9 +1769,15 @@ Normalizer2Impl::composeQuickCheck(const char16_t *src, const char16_t *limit,
             if(src==limit) {
                 return src;
             }
-            if( (c=*src)<minNoMaybeCP ||
-                isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
-            ) {
+            if( (c=*src)<minNoMaybeCP ) {
+                ++src;
+                // Skip whole blocks of code units below the minimum at once,
+                // but not for an isolated one like a space between words.
+                if((limit-src)>=UPRV_ASCII_BLOCK_LENGTH && *src<minNoMaybeCP) {
+                    src+=uprv_spanUTF16Below(src, static_cast<int32_t>(limit-src),
+                                             static_cast<char16_t>(minNoMaybeCP));
+                }
+            } else if(isCompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))) {
                 ++src;
             } else {
                 prevSrc = src++;
@@ -1906,6 +1930,11 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
             }
             if (*src < minNoMaybeLead) {
                 ++src;
+                // Skip whole blocks of bytes below the minimum lead byte at once,
+                // but not for an isolated one like a space between words.
+                if ((limit - src) >= UPRV_ASCII_BLOCK_LENGTH && *src < minNoMaybeLead) {
+                    src += uprv_spanUTF8Below(src, static_cast<int32_t>(limit - src), minNoMaybeLead);
+                }
             } else {
                 prevSrc = src;
                 UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
@@ -36,6 +36,7 @@
 #include "rbbirb.h"
 #include "uassert.h"
 #include "umutex.h"
+#include "ustr_imp.h"
 #include "uvectr32.h"
 
 #ifdef RBBI_DEBUG
@@ -331,6 +332,7 @@ RuleBasedBreakIterator::operator=(const RuleBasedBreakIterator& that) {
     //       Current position could be within a dictionary range. Trying to continue
     //       the iteration without the caches present would go to the rules, with
     //       the assumption that the current position is on a rule boundary.
+    fBreakCache->setCapacity(that.fBreakCache->getCapacity(), status);
     fBreakCache->reset(fPosition, fRuleStatusIndex);
     fDictionaryCache->reset();
 
@@ -733,42 +735,125 @@ static inline uint16_t TrieFunc16(const UCPTrie *trie, UChar32 c) {
     return UCPTRIE_FAST_GET(trie, UCPTRIE_16, c);
 }
 
-int32_t RuleBasedBreakIterator::handleNext() {
+namespace {
+
+/**
+ * Text access for the break iterator state machines, via the UText macros.
+ */
+class UTextAccess {
+public:
+    explicit UTextAccess(UText *ut) : ut(ut) {}
+    void setIndex(int32_t index) { UTEXT_SETNATIVEINDEX(ut, index); }
+    int32_t getIndex() const { return static_cast<int32_t>(UTEXT_GETNATIVEINDEX(ut)); }
+    UChar32 next32() { return UTEXT_NEXT32(ut); }
+    UChar32 previous32() { return UTEXT_PREVIOUS32(ut); }
+private:
+    UText *ut;
+};
+
+/**
+ * Direct text access for UTF-8 strings.
+ * Indexes are byte offsets, as for a UTF-8 UText.
+ * Ill-formed sequences are read as U+FFFD, also as for a UTF-8 UText.
+ */
+class UTF8Access {
+public:
+    UTF8Access(const uint8_t *s, int32_t length) : s(s), length(length), index(0) {}
+    void setIndex(int32_t i) {
+        // Pin to the string, and back up to the start of a code point.
+        if (i <= 0) {
+            index = 0;
+        } else if (i >= length) {
+            index = length;
+        } else {
+            U8_SET_CP_START(s, 0, i);
+            index = i;
+        }
+    }
+    int32_t getIndex() const { return index; }
+    UChar32 next32() {
+        if (index >= length) {
+            return U_SENTINEL;
+        }
+        UChar32 c;
+        U8_NEXT_OR_FFFD(s, index, length, c);
+        return c;
+    }
+    UChar32 previous32() {
+        if (index <= 0) {
+            return U_SENTINEL;
+        }
+        UChar32 c;
+        U8_PREV_OR_FFFD(s, 0, index, c);
+        return c;
+    }
+private:
+    const uint8_t *s;
+    int32_t length;
+    int32_t index;
+};
+
+}  // namespace
+
+template<typename Text>
+int32_t RuleBasedBreakIterator::selectHandleNext(Text text) {
     const RBBIStateTable *statetable = fData->fForwardTable;
     bool use8BitsTrie = ucptrie_getValueWidth(fData->fTrie) == UCPTRIE_VALUE_BITS_8;
     if (statetable->fFlags & RBBI_8BITS_ROWS) {
         if (use8BitsTrie) {
-            return handleNext<RBBIStateTableRow8, TrieFunc8>();
+            return handleNext<RBBIStateTableRow8, TrieFunc8>(text);
         } else {
-            return handleNext<RBBIStateTableRow8, TrieFunc16>();
+            return handleNext<RBBIStateTableRow8, TrieFunc16>(text);
         }
     } else {
         if (use8BitsTrie) {
-            return handleNext<RBBIStateTableRow16, TrieFunc8>();
+            return handleNext<RBBIStateTableRow16, TrieFunc8>(text);
         } else {
-            return handleNext<RBBIStateTableRow16, TrieFunc16>();
+            return handleNext<RBBIStateTableRow16, TrieFunc16>(text);
         }
     }
 }
 
-int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
+template<typename Text>
+int32_t RuleBasedBreakIterator::selectHandleSafePrevious(int32_t fromPosition, Text text) {
     const RBBIStateTable *statetable = fData->fReverseTable;
     bool use8BitsTrie = ucptrie_getValueWidth(fData->fTrie) == UCPTRIE_VALUE_BITS_8;
     if (statetable->fFlags & RBBI_8BITS_ROWS) {
         if (use8BitsTrie) {
-            return handleSafePrevious<RBBIStateTableRow8, TrieFunc8>(fromPosition);
+            return handleSafePrevious<RBBIStateTableRow8, TrieFunc8>(fromPosition, text);
         } else {
-            return handleSafePrevious<RBBIStateTableRow8, TrieFunc16>(fromPosition);
+            return handleSafePrevious<RBBIStateTableRow8, TrieFunc16>(fromPosition, text);
         }
     } else {
         if (use8BitsTrie) {
-            return handleSafePrevious<RBBIStateTableRow16, TrieFunc8>(fromPosition);
+            return handleSafePrevious<RBBIStateTableRow16, TrieFunc8>(fromPosition, text);
         } else {
-            return handleSafePrevious<RBBIStateTableRow16, TrieFunc16>(fromPosition);
+            return handleSafePrevious<RBBIStateTableRow16, TrieFunc16>(fromPosition, text);
         }
     }
 }
 
+int32_t RuleBasedBreakIterator::handleNext() {
+    int32_t length;
+    const char *s = utext_getUTF8Contents(&fText, &length);
+    if (s != nullptr) {
+        return selectHandleNext(UTF8Access(reinterpret_cast<const uint8_t *>(s), length));
+    } else {
+        return selectHandleNext(UTextAccess(&fText));
+    }
+}
+
+int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
+    int32_t length;
+    const char *s = utext_getUTF8Contents(&fText, &length);
+    if (s != nullptr) {
+        return selectHandleSafePrevious(
+            fromPosition, UTF8Access(reinterpret_cast<const uint8_t *>(s), length));
+    } else {
+        return selectHandleSafePrevious(fromPosition, UTextAccess(&fText));
+    }
+}
+
 
 //-----------------------------------------------------------------------------------
 //
@@ -776,8 +861,8 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
 //     Run the state machine to find a boundary
 //
 //-----------------------------------------------------------------------------------
-template <typename RowType, RuleBasedBreakIterator::PTrieFunc trieFunc>
-int32_t RuleBasedBreakIterator::handleNext() {
+template <typename RowType, RuleBasedBreakIterator::PTrieFunc trieFunc, typename Text>
+int32_t RuleBasedBreakIterator::handleNext(Text text) {
     int32_t             state;
     uint16_t            category        = 0;
     RBBIRunMode         mode;
@@ -804,9 +889,9 @@ int32_t RuleBasedBreakIterator::handleNext() {
 
     // if we're already at the end of the text, return DONE.
     initialPosition = fPosition;
-    UTEXT_SETNATIVEINDEX(&fText, initialPosition);
+    text.setIndex(initialPosition);
     result          = initialPosition;
-    c               = UTEXT_NEXT32(&fText);
+    c               = text.next32();
     if (c==U_SENTINEL) {
         fDone = true;
         return UBRK_DONE;
@@ -856,7 +941,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
 
        #ifdef RBBI_DEBUG
             if (gTrace) {
-                RBBIDebugPrintf("             %4" PRId64 "   ", utext_getNativeIndex(&fText));
+                RBBIDebugPrintf("             %4d   ", text.getIndex());
                 if (0x20<=c && c<0x7f) {
                     RBBIDebugPrintf("\"%c\"  ", c);
                 } else {
@@ -881,7 +966,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         if (accepting == ACCEPTING_UNCONDITIONAL) {
             // Match found, common case.
             if (mode != RBBI_START) {
-                result = static_cast<int32_t>(UTEXT_GETNATIVEINDEX(&fText));
+                result = text.getIndex();
             }
             fRuleStatusIndex = row->fTagsIdx;   // Remember the break status (tag) values.
         } else if (accepting > ACCEPTING_UNCONDITIONAL) {
@@ -905,7 +990,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         U_ASSERT(rule == 0 || rule > ACCEPTING_UNCONDITIONAL);
         U_ASSERT(rule == 0 || rule < fData->fForwardTable->fLookAheadResultsSize);
         if (rule > ACCEPTING_UNCONDITIONAL) {
-            int32_t pos = static_cast<int32_t>(UTEXT_GETNATIVEINDEX(&fText));
+            int32_t pos = text.getIndex();
             fLookAheadMatches[rule] = pos;
         }
 
@@ -921,7 +1006,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         //    the input position.  The next iteration will be processing the
         //    first real input character.
         if (mode == RBBI_RUN) {
-            c = UTEXT_NEXT32(&fText);
+            c = text.next32();
         } else {
             if (mode == RBBI_START) {
                 mode = RBBI_RUN;
@@ -935,9 +1020,9 @@ int32_t RuleBasedBreakIterator::handleNext() {
     //   (This really indicates a defect in the break rules.  They should always match
     //    at least one character.)
     if (result == initialPosition) {
-        utext_setNativeIndex(&fText, initialPosition);
-        utext_next32(&fText);
-        result = static_cast<int32_t>(utext_getNativeIndex(&fText));
+        text.setIndex(initialPosition);
+        text.next32();
+        result = text.getIndex();
         fRuleStatusIndex = 0;
     }
 
@@ -961,8 +1046,8 @@ int32_t RuleBasedBreakIterator::handleNext() {
 //      because the safe table does not require as many options.
 //
 //-----------------------------------------------------------------------------------
-template <typename RowType, RuleBasedBreakIterator::PTrieFunc trieFunc>
-int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
+template <typename RowType, RuleBasedBreakIterator::PTrieFunc trieFunc, typename Text>
+int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition, Text text) {
 
     int32_t             state;
     uint16_t            category        = 0;
@@ -971,7 +1056,7 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
     int32_t             result          = 0;
 
     const RBBIStateTable *stateTable = fData->fReverseTable;
-    UTEXT_SETNATIVEINDEX(&fText, fromPosition);
+    text.setIndex(fromPosition);
     #ifdef RBBI_DEBUG
         if (gTrace) {
             RBBIDebugPuts("Handle Previous   pos   char  state category");
@@ -979,19 +1064,19 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
     #endif
 
     // if we're already at the start of the text, return DONE.
-    if (fData == nullptr || UTEXT_GETNATIVEINDEX(&fText)==0) {
+    if (fData == nullptr || text.getIndex()==0) {
         return BreakIterator::DONE;
     }
 
     //  Set the initial state for the state machine
-    c = UTEXT_PREVIOUS32(&fText);
+    c = text.previous32();
     state = START_STATE;
     row = (RowType *)
             (stateTable->fTableData + (stateTable->fRowLen * state));
 
     // loop until we reach the start of the text or transition to state 0
     //
-    for (; c != U_SENTINEL; c = UTEXT_PREVIOUS32(&fText)) {
+    for (; c != U_SENTINEL; c = text.previous32()) {
 
         // look up the current character's character category, which tells us
         // which column in the state table to look at.
@@ -1001,7 +1086,7 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
 
         #ifdef RBBI_DEBUG
             if (gTrace) {
-                RBBIDebugPrintf("             %4d   ", (int32_t)utext_getNativeIndex(&fText));
+                RBBIDebugPrintf("             %4d   ", text.getIndex());
                 if (0x20<=c && c<0x7f) {
                     RBBIDebugPrintf("\"%c\"  ", c);
                 } else {
@@ -1027,7 +1112,7 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
     }
 
     // The state machine is done.  Check whether it found a match...
-    result = static_cast<int32_t>(UTEXT_GETNATIVEINDEX(&fText));
+    result = text.getIndex();
     #ifdef RBBI_DEBUG
         if (gTrace) {
             RBBIDebugPrintf("result = %d\n\n", result);
@@ -1078,6 +1163,33 @@ int32_t RuleBasedBreakIterator::getRuleStatusVec(
 }
 
 
+int32_t RuleBasedBreakIterator::nextBoundaries(int32_t *boundaries, int32_t *ruleStatuses,
+                                               int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (capacity > 0 && boundaries == nullptr)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t count = fBreakCache->nextBoundaries(boundaries, ruleStatuses, capacity);
+    if (ruleStatuses != nullptr) {
+        // The cache holds status indexes; return the last (largest) status value of each,
+        // as getRuleStatus() does.
+        const int32_t *statusTable = fData->fRuleStatusTable;
+        for (int32_t i = 0; i < count; ++i) {
+            int32_t idx = ruleStatuses[i];
+            ruleStatuses[i] = statusTable[idx + statusTable[idx]];
+        }
+    }
+    return count;
+}
+
+
+void RuleBasedBreakIterator::setCacheCapacity(int32_t capacity, UErrorCode &status) {
+    fBreakCache->setCapacity(capacity, status);
+}
+
 
 //-------------------------------------------------------------------------------
 //
@@ -206,7 +206,7 @@ void RuleBasedBreakIterator::DictionaryCache::populateDictionary(int32_t startPo
  */
 
 RuleBasedBreakIterator::BreakCache::BreakCache(RuleBasedBreakIterator *bi, UErrorCode &status) :
-        fBI(bi), fSideBuffer(status) {
+        fCacheSize(CACHE_SIZE), fBI(bi), fSideBuffer(status) {
     reset();
 }
 
@@ -278,6 +278,101 @@ void RuleBasedBreakIterator::BreakCache::nextOL() {
 }
 
 
+int32_t RuleBasedBreakIterator::BreakCache::nextBoundaries(
+        int32_t *boundaries, int32_t *ruleStatusIdxs, int32_t capacity) {
+    int32_t count = 0;
+    while (count < capacity) {
+        if (fBufIdx == fEndBufIdx) {
+            int32_t extraCount = capacity - count - 1;
+            if (extraCount > fCacheSize / 2) {
+                extraCount = fCacheSize / 2;
+            } else if (extraCount < 6) {
+                extraCount = 6;
+            }
+            fBI->fDone = !populateFollowing(extraCount);
+            if (fBI->fDone) {
+                break;
+            }
+            // Now positioned on the first newly added boundary.
+            boundaries[count] = fTextIdx;
+            if (ruleStatusIdxs != nullptr) {
+                ruleStatusIdxs[count] = fStatuses[fBufIdx];
+            }
+            ++count;
+            continue;
+        }
+        // Copy the cached boundaries up to the end of the cache
+        // or the end of the circular buffer, whichever comes first.
+        int32_t idx = modChunkSize(fBufIdx + 1);
+        int32_t runLength = (idx <= fEndBufIdx ? fEndBufIdx + 1 : fCacheSize) - idx;
+        if (runLength > capacity - count) {
+            runLength = capacity - count;
+        }
+        const int32_t *runBoundaries = fBoundaries.getAlias() + idx;
+        for (int32_t i = 0; i < runLength; ++i) {
+            boundaries[count + i] = runBoundaries[i];
+        }
+        if (ruleStatusIdxs != nullptr) {
+            const uint16_t *runStatuses = fStatuses.getAlias() + idx;
+            for (int32_t i = 0; i < runLength; ++i) {
+                ruleStatusIdxs[count + i] = runStatuses[i];
+            }
+        }
+        count += runLength;
+        fBufIdx = idx + runLength - 1;
+        fTextIdx = fBoundaries[fBufIdx];
+    }
+    fBI->fPosition = fTextIdx;
+    fBI->fRuleStatusIndex = fStatuses[fBufIdx];
+    return count;
+}
+
+
+void RuleBasedBreakIterator::BreakCache::setCapacity(int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t newSize = CACHE_SIZE;
+    while (newSize < capacity && newSize < MAX_CACHE_SIZE) {
+        newSize *= 2;
+    }
+    if (newSize == fCacheSize) {
+        return;
+    }
+    MaybeStackArray<int32_t, CACHE_SIZE> boundaries;
+    MaybeStackArray<uint16_t, CACHE_SIZE> statuses;
+    if (newSize > CACHE_SIZE &&
+            (boundaries.resize(newSize) == nullptr || statuses.resize(newSize) == nullptr)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+
+    // Copy the cached boundaries to the start of the new buffers.
+    // If they do not all fit, then drop the ones farthest from the iteration position.
+    int32_t length = modChunkSize(fEndBufIdx - fStartBufIdx) + 1;
+    int32_t bufIdx = modChunkSize(fBufIdx - fStartBufIdx);
+    int32_t first = 0;
+    if (length > newSize) {
+        first = length - newSize;
+        if (first > bufIdx) {
+            first = bufIdx;
+        }
+        length = newSize;
+    }
+    for (int32_t i = 0; i < length; ++i) {
+        int32_t oldIdx = modChunkSize(fStartBufIdx + first + i);
+        boundaries[i] = fBoundaries[oldIdx];
+        statuses[i] = fStatuses[oldIdx];
+    }
+    fBoundaries = std::move(boundaries);
+    fStatuses = std::move(statuses);
+    fCacheSize = newSize;
+    fStartBufIdx = 0;
+    fEndBufIdx = length - 1;
+    fBufIdx = bufIdx - first;
+}
+
+
 void RuleBasedBreakIterator::BreakCache::previous(UErrorCode &status) {
     if (U_FAILURE(status)) {
         return;
@@ -316,7 +411,7 @@ UBool RuleBasedBreakIterator::BreakCache::seek(int32_t pos) {
     int32_t min = fStartBufIdx;
     int32_t max = fEndBufIdx;
     while (min != max) {
-        int32_t probe = (min + max + (min>max ? CACHE_SIZE : 0)) / 2;
+        int32_t probe = (min + max + (min>max ? fCacheSize : 0)) / 2;
         probe = modChunkSize(probe);
         if (fBoundaries[probe] > pos) {
             max = probe;
@@ -465,7 +560,7 @@ UBool RuleBasedBreakIterator::BreakCache::populateNear(int32_t position, UErrorC
 
 
 
-UBool RuleBasedBreakIterator::BreakCache::populateFollowing() {
+UBool RuleBasedBreakIterator::BreakCache::populateFollowing(int32_t extraCount) {
     int32_t fromPosition = fBoundaries[fEndBufIdx];
     int32_t fromRuleStatusIdx = fStatuses[fEndBufIdx];
     int32_t pos = 0;
@@ -504,7 +599,7 @@ UBool RuleBasedBreakIterator::BreakCache::populateFollowing() {
     // Add several non-dictionary boundaries at this point, to optimize straight forward iteration.
     //    (subsequent calls to BreakIterator::next() will take the fast path, getting cached results.
     //
-    for (int count=0; count<6; ++count) {
+    for (int count=0; count<extraCount; ++count) {
         pos = fBI->handleNext();
         if (pos == UBRK_DONE || fBI->fDictionaryCharCount > 0) {
             break;
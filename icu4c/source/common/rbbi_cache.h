@@ -13,6 +13,7 @@
 #include "unicode/rbbi.h"
 #include "unicode/uobject.h"
 
+#include "cmemory.h"
 #include "uvectr32.h"
 
 U_NAMESPACE_BEGIN
@@ -99,6 +100,26 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
 
 
     void        nextOL();
+
+    /**
+     * Move the iteration position forward by up to capacity boundaries,
+     * storing each boundary and its rule status index.
+     * Copies runs of boundaries that are already cached in one go, and refills
+     * the cache with as many boundaries as will be needed, up to half its capacity.
+     * @param boundaries receives the boundary positions
+     * @param ruleStatusIdxs receives the rule status indexes; can be nullptr
+     * @param capacity the maximum number of boundaries to return
+     * @return the number of boundaries stored; less than capacity only at the end of the text
+     */
+    int32_t     nextBoundaries(int32_t *boundaries, int32_t *ruleStatusIdxs, int32_t capacity);
+
+    /**
+     * Change the number of boundaries held in the cache, rounded up to a power of two.
+     * The cached boundaries nearest the iteration position are retained.
+     */
+    void        setCapacity(int32_t capacity, UErrorCode &status);
+
+    int32_t     getCapacity() const { return fCacheSize; }
     void        previous(UErrorCode &status);
 
     // Move the iteration state to the position following the startPosition.
@@ -132,10 +153,12 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
 
     /**
      *  Add boundary(s) to the cache following the current last boundary.
+     *  When not in a dictionary range, adds up to extraCount further rule based
+     *  boundaries, to speed up the following next() calls.
      *  Return false if at the end of the text, and no more boundaries can be added.
      *  Leave iteration position at the first newly added boundary, or unchanged if no boundary was added.
      */
-    UBool populateFollowing();
+    UBool populateFollowing(int32_t extraCount = 6);
 
     /**
      *  Add one or more boundaries to the cache preceding the first currently cached boundary.
@@ -178,10 +201,15 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
     void dumpCache();
 
   private:
-    static inline int32_t   modChunkSize(int index) { return index & (CACHE_SIZE - 1); }
+    inline int32_t          modChunkSize(int index) const { return index & (fCacheSize - 1); }
 
+    // Default and minimum size of the circular cache buffer.
     static constexpr int32_t CACHE_SIZE = 128;
     static_assert((CACHE_SIZE & (CACHE_SIZE-1)) == 0, "CACHE_SIZE must be power of two.");
+    // Maximum size of the circular cache buffer.
+    static constexpr int32_t MAX_CACHE_SIZE = 0x10000;
+
+    int32_t                 fCacheSize;    // always a power of two
 
     RuleBasedBreakIterator *fBI;
     int32_t                 fStartBufIdx;
@@ -190,8 +218,8 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
     int32_t                 fTextIdx;
     int32_t                 fBufIdx;
 
-    int32_t                 fBoundaries[CACHE_SIZE];
-    uint16_t                fStatuses[CACHE_SIZE];
+    MaybeStackArray<int32_t, CACHE_SIZE>  fBoundaries;
+    MaybeStackArray<uint16_t, CACHE_SIZE> fStatuses;
 
     UVector32               fSideBuffer;
 };
@@ -165,9 +165,10 @@ class U_COMMON_API_CLASS SharedObject : public UObject {
      * The number of references from the UnifiedCache, which is
      * the number of times that the sharedObject is stored as a hash table value.
      * For use by UnifiedCache implementation code only.
-     * All access is synchronized by UnifiedCache's gCacheMutex
+     * Entries referring to the same object may live in different cache shards,
+     * so the count is updated atomically.
      */
-    mutable int32_t softRefCount;
+    mutable u_atomic_int32_t softRefCount;
     friend class UnifiedCache;
 
     /**
@@ -24,6 +24,8 @@
 
 #if !UCONFIG_NO_CONVERSION
 
+#include <algorithm>
+
 #include "unicode/ucnv.h"
 #include "unicode/utf.h"
 #include "unicode/utf8.h"
@@ -32,6 +34,7 @@
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
 #include "cmemory.h"
+#include "ustr_ascii.h"
 #include "ustr_imp.h"
 
 /* Prototypes --------------------------------------------------------------- */
@@ -94,6 +97,17 @@ static void  U_CALLCONV ucnv_toUnicode_UTF8 (UConverterToUnicodeArgs * args,
         if (U8_IS_SINGLE(ch))        /* Simple case */
         {
             *(myTarget++) = (char16_t) ch;
+
+            /* Copy the rest of an ASCII run in bulk, then finish it byte by byte. */
+            int32_t count = (int32_t)std::min<ptrdiff_t>(sourceLimit - mySource, targetLimit - myTarget);
+            if (count >= UPRV_ASCII_BLOCK_LENGTH) {
+                count = uprv_copyASCIIToUTF16(mySource, count, myTarget);
+                mySource += count;
+                myTarget += count;
+            }
+            while (mySource < sourceLimit && myTarget < targetLimit && U8_IS_SINGLE(*mySource)) {
+                *(myTarget++) = *(mySource++);
+            }
         }
         else
         {
@@ -325,6 +339,17 @@ U_CFUNC void  U_CALLCONV ucnv_fromUnicode_UTF8 (UConverterFromUnicodeArgs * args
         if (ch < 0x80)        /* Single byte */
         {
             *(myTarget++) = (uint8_t) ch;
+
+            /* Copy the rest of an ASCII run in bulk, then finish it unit by unit. */
+            int32_t count = (int32_t)std::min<ptrdiff_t>(sourceLimit - mySource, targetLimit - myTarget);
+            if (count >= UPRV_ASCII_BLOCK_LENGTH) {
+                count = uprv_copyASCIIToUTF8(mySource, count, myTarget);
+                mySource += count;
+                myTarget += count;
+            }
+            while (mySource < sourceLimit && myTarget < targetLimit && *mySource < 0x80) {
+                *(myTarget++) = (uint8_t) *(mySource++);
+            }
         }
         else if (ch < 0x800)  /* Double byte */
         {
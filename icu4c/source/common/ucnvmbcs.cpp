@@ -59,12 +59,19 @@
 #include "cmemory.h"
 #include "cstring.h"
 #include "umutex.h"
+#include "ustr_ascii.h"
 #include "ustr_imp.h"
 
 /* control optimizations according to the platform */
 #define MBCS_UNROLL_SINGLE_TO_BMP 1
 #define MBCS_UNROLL_SINGLE_FROM_BMP 0
 
+/*
+ * All of ASCII round-trips: ASCII bytes and ASCII code units map to each other 1:1,
+ * so that runs of them can be copied in bulk (see ustr_ascii.h).
+ */
+#define ALL_ASCII_ROUNDTRIPS(asciiRoundtrips) ((asciiRoundtrips)==0xffffffff)
+
 /*
  * _MBCSHeader versions 5.3 & 4.3
  * (Note that the _MBCSHeader version is in addition to the converter formatVersion.)
@@ -2196,6 +2203,7 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     int32_t entry;
     uint8_t action;
+    UBool allASCIIRoundtrips;
 
     /* set up the local pointers */
     cnv=pArgs->converter;
@@ -2210,6 +2218,7 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
     } else {
         stateTable=cnv->sharedData->mbcs.stateTable;
     }
+    allASCIIRoundtrips=ALL_ASCII_ROUNDTRIPS(cnv->sharedData->mbcs.asciiRoundtrips);
 
     /* sourceIndex=-1 if the current character began in the previous buffer */
     sourceIndex=0;
@@ -2233,6 +2242,12 @@ ucnv_MBCSSingleToBMPWithOffsets(UConverterToUnicodeArgs *pArgs,
 
         loops=count=targetCapacity>>4;
         do {
+            /* copy 16 ASCII bytes at once if they map to themselves */
+            if(allASCIIRoundtrips && uprv_copyASCIIToUTF16(source, 16, target)==16) {
+                source+=16;
+                target+=16;
+                continue;
+            }
             oredEntries=entry=stateTable[0][*source++];
             *target++ = static_cast<char16_t>(MBCS_ENTRY_FINAL_VALUE_16(entry));
             oredEntries|=entry=stateTable[0][*source++];
@@ -2483,6 +2498,7 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
     int32_t entry;
     char16_t c;
     uint8_t action;
+    UBool allASCIIRoundtrips;
 
     /* use optimized function if possible */
     cnv=pArgs->converter;
@@ -2521,6 +2537,7 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
         stateTable=cnv->sharedData->mbcs.stateTable;
     }
     unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+    allASCIIRoundtrips=ALL_ASCII_ROUNDTRIPS(cnv->sharedData->mbcs.asciiRoundtrips);
 
     /* get the converter state from UConverter */
     offset=cnv->toUnicodeStatus;
@@ -2587,6 +2604,18 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                             ++source;
                             *target++=(char16_t)MBCS_ENTRY_FINAL_VALUE_16(entry);
                             state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+                            /* copy the rest of an ASCII run in bulk */
+                            if(allASCIIRoundtrips && state==0 && U8_IS_SINGLE(*(source-1))) {
+                                int32_t count=(int32_t)(sourceLimit-source);
+                                if(count>(targetLimit-target)) {
+                                    count=(int32_t)(targetLimit-target);
+                                }
+                                if(count>=UPRV_ASCII_BLOCK_LENGTH) {
+                                    count=uprv_copyASCIIToUTF16(source, count, target);
+                                    source+=count;
+                                    target+=count;
+                                }
+                            }
                         } else {
                             /* leave the optimized loop */
                             break;
@@ -2631,6 +2660,23 @@ ucnv_MBCSToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
                                 sourceIndex=++nextSourceIndex;
                             }
                             state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+                            /* copy the rest of an ASCII run in bulk */
+                            if(allASCIIRoundtrips && state==0 && U8_IS_SINGLE(*(source-1))) {
+                                int32_t count=(int32_t)(sourceLimit-source);
+                                if(count>(targetLimit-target)) {
+                                    count=(int32_t)(targetLimit-target);
+                                }
+                                if(count>=UPRV_ASCII_BLOCK_LENGTH) {
+                                    count=uprv_copyASCIIToUTF16(source, count, target);
+                                    source+=count;
+                                    target+=count;
+                                    while(count>0) {
+                                        *offsets++=sourceIndex;
+                                        sourceIndex=++nextSourceIndex;
+                                        --count;
+                                    }
+                                }
+                            }
                         } else {
                             /* leave the optimized loop */
                             break;
@@ -3478,6 +3524,26 @@ ucnv_MBCSDoubleFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
                 --targetCapacity;
                 c=0;
+                /* copy the rest of an ASCII run in bulk */
+                if(ALL_ASCII_ROUNDTRIPS(asciiRoundtrips)) {
+                    int32_t count = static_cast<int32_t>(sourceLimit - source);
+                    if(count>targetCapacity) {
+                        count=targetCapacity;
+                    }
+                    if(count>=UPRV_ASCII_BLOCK_LENGTH) {
+                        count=uprv_copyASCIIToUTF8(source, count, target);
+                        source+=count;
+                        target+=count;
+                        targetCapacity-=count;
+                        nextSourceIndex+=count;
+                        if(offsets!=nullptr) {
+                            while(count>0) {
+                                *offsets++=sourceIndex++;
+                                --count;
+                            }
+                        }
+                    }
+                }
                 continue;
             }
             /*
@@ -3937,6 +4003,13 @@ ucnv_MBCSSingleFromBMPWithOffsets(UConverterFromUnicodeArgs *pArgs,
             *target++ = static_cast<uint8_t>(c);
             --targetCapacity;
             c=0;
+            /* copy the rest of an ASCII run in bulk; the offsets are set later from lastSource */
+            if(ALL_ASCII_ROUNDTRIPS(asciiRoundtrips) && targetCapacity>=UPRV_ASCII_BLOCK_LENGTH) {
+                length=uprv_copyASCIIToUTF8(source, targetCapacity, target);
+                source+=length;
+                target+=length;
+                targetCapacity-=length;
+            }
             continue;
         }
         value=MBCS_SINGLE_RESULT_FROM_U(table, results, c);
@@ -4208,6 +4281,27 @@ ucnv_MBCSFromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
                 }
                 --targetCapacity;
                 c=0;
+                /* copy the rest of an ASCII run in bulk */
+                if(ALL_ASCII_ROUNDTRIPS(asciiRoundtrips)) {
+                    int32_t count=(int32_t)(sourceLimit-source);
+                    if(count>targetCapacity) {
+                        count=targetCapacity;
+                    }
+                    if(count>=UPRV_ASCII_BLOCK_LENGTH) {
+                        count=uprv_copyASCIIToUTF8(source, count, target);
+                        source+=count;
+                        target+=count;
+                        targetCapacity-=count;
+                        nextSourceIndex+=count;
+                        if(offsets!=nullptr) {
+                            while(count>0) {
+                                prevSourceIndex=sourceIndex;
+                                *offsets++=sourceIndex++;
+                                --count;
+                            }
+                        }
+                    }
+                }
                 continue;
             }
             /*
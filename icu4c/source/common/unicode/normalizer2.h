@@ -38,6 +38,7 @@
 U_NAMESPACE_BEGIN
 
 class ByteSink;
+class CharString;
 
 /**
  * Unicode normalization functionality for standard Unicode normalization or
@@ -782,6 +783,97 @@ class U_COMMON_API FilteredNormalizer2 : public Normalizer2 {
     const UnicodeSet &set;
 };
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Normalizes UTF-8 text that arrives in chunks, for example while reading a large file,
+ * and writes the result to a ByteSink.
+ * The result is the same as from Normalizer2::normalizeUTF8() on the concatenation
+ * of all of the chunks.
+ *
+ * Each append() call normalizes and writes the text up to the last normalization boundary
+ * (see Normalizer2::hasBoundaryBefore()) and keeps only the rest for the next call.
+ * Chunks need not end on code point boundaries.
+ * The memory use does not depend on the total length of the text, only on the length
+ * of the longest sequence of code points without a boundary,
+ * which is very short for normal text.
+ *
+ * \code
+ * Normalizer2UTF8Stream stream(*Normalizer2::getNFCInstance(errorCode), sink, 0, nullptr, errorCode);
+ * while (readChunk(chunk)) {
+ *     stream.append(chunk, errorCode);
+ * }
+ * stream.finish(errorCode);
+ * \endcode
+ *
+ * An instance of this class is not thread-safe.
+ * @draft ICU 79
+ */
+class U_COMMON_API Normalizer2UTF8Stream : public UMemory {
+public:
+    /**
+     * Constructor.
+     * The normalizer, sink and edits are aliased and must remain valid
+     * while this object is used.
+     * @param norm2     the normalizer
+     * @param sink      a ByteSink to which the normalized UTF-8 text is written
+     * @param options   options bit set, usually 0; see Normalizer2::normalizeUTF8()
+     * @param edits     records edits for the whole text if not nullptr.
+     *                  edits->reset() is called first unless options includes
+     *                  U_EDITS_NO_RESET.
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 79
+     */
+    Normalizer2UTF8Stream(const Normalizer2 &norm2, ByteSink &sink,
+                          uint32_t options, Edits *edits, UErrorCode &errorCode);
+
+    /**
+     * Destructor. Does not write any remaining text; call finish() for that.
+     * @draft ICU 79
+     */
+    ~Normalizer2UTF8Stream();
+
+    /**
+     * Normalizes the text up to the last normalization boundary within
+     * the previously kept text plus the chunk, and writes it to the sink.
+     * Keeps the rest of the text for later.
+     * @param chunk     the next piece of UTF-8 text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 79
+     */
+    void append(StringPiece chunk, UErrorCode &errorCode);
+
+    /**
+     * Normalizes and writes the remaining text.
+     * The stream can then be used for new text.
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 79
+     */
+    void finish(UErrorCode &errorCode);
+
+private:
+    Normalizer2UTF8Stream(const Normalizer2UTF8Stream &) = delete;
+    Normalizer2UTF8Stream &operator=(const Normalizer2UTF8Stream &) = delete;
+
+    void normalize(const char *s, int32_t length, UErrorCode &errorCode);
+
+    const Normalizer2 &norm2;
+    ByteSink &sink;
+    uint32_t options;
+    Edits *edits;
+    /** Text after the last boundary seen so far. */
+    CharString *tail;
+};
+#endif  /* U_HIDE_DRAFT_API */
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_NORMALIZATION
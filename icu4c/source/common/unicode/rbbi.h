@@ -607,6 +607,47 @@ class U_COMMON_API RuleBasedBreakIterator /*final*/ : public BreakIterator {
     */
     virtual int32_t getRuleStatusVec(int32_t *fillInVec, int32_t capacity, UErrorCode &status) override;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Advances the iterator by up to capacity boundaries and returns them all at once.
+     * This is equivalent to calling next() and getRuleStatus() repeatedly,
+     * but faster when many boundaries are needed, for example when tokenizing
+     * a large document.
+     * <p>
+     * Afterwards, the iterator is positioned on the last returned boundary.
+     * If fewer than capacity boundaries are returned, then the end of the text
+     * has been reached, and a subsequent next() returns UBRK_DONE.
+     *
+     * @param boundaries   an array to be filled in with the boundary positions
+     * @param ruleStatuses an array to be filled in with the rule status value
+     *                     of each boundary, as from getRuleStatus(); can be nullptr
+     * @param capacity     the length of each array
+     * @param status       receives error codes.
+     * @return             the number of boundaries stored, 0 at the end of the text.
+     * @see next
+     * @see getRuleStatus
+     * @draft ICU 79
+     */
+    int32_t nextBoundaries(int32_t *boundaries, int32_t *ruleStatuses, int32_t capacity,
+                           UErrorCode &status);
+
+    /**
+     * Sets the number of boundaries that this iterator keeps cached.
+     * Iterating back and forth within the cached boundaries does not rerun the
+     * break rules. A larger cache helps when the application repeatedly moves
+     * back over many boundaries, or when it uses nextBoundaries() with large arrays.
+     * <p>
+     * The capacity is rounded up to a power of two between
+     * the default of 128 and an implementation-defined maximum.
+     * The iteration position is not changed.
+     *
+     * @param capacity the number of boundaries to keep cached
+     * @param status   receives error codes.
+     * @draft ICU 79
+     */
+    void setCacheCapacity(int32_t capacity, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Returns a unique class ID POLYMORPHICALLY.  Pure virtual override.
      * This method is to implement a simple version of RTTI, since not all
@@ -741,8 +782,8 @@ class U_COMMON_API RuleBasedBreakIterator /*final*/ : public BreakIterator {
     /*
      * Templatized version of handleNext() and handleSafePrevious().
      *
-     * There will be exactly four instantiations, two each for 8 and 16 bit tables,
-     * two each for 8 and 16 bit trie.
+     * There will be exactly eight instantiations, for 8 and 16 bit tables,
+     * for 8 and 16 bit trie, and for UText and UTF-8 string text access.
      * Having separate instantiations for the table types keeps conditional tests of
      * the table type out of the inner loops, at the expense of replicated code.
      *
@@ -750,15 +791,29 @@ class U_COMMON_API RuleBasedBreakIterator /*final*/ : public BreakIterator {
      * Doing it this way, the compiler will inline the Trie function in the
      * expanded functions. (Both the 8 and 16 bit access functions have the same type
      * signature)
+     *
+     * The Text type provides setIndex(), getIndex(), next32() and previous32()
+     * with the semantics of the UText macros. Text from utext_openUTF8() is read
+     * directly from its bytes, bypassing the UText UTF-16 chunk conversion.
      */
 
     typedef uint16_t (*PTrieFunc)(const UCPTrie *, UChar32);
 
-    template<typename RowType, PTrieFunc trieFunc>
-    int32_t handleSafePrevious(int32_t fromPosition);
+    template<typename RowType, PTrieFunc trieFunc, typename Text>
+    int32_t handleSafePrevious(int32_t fromPosition, Text text);
 
-    template<typename RowType, PTrieFunc trieFunc>
-    int32_t handleNext();
+    template<typename RowType, PTrieFunc trieFunc, typename Text>
+    int32_t handleNext(Text text);
+
+    /*
+     * Call the handleNext() or handleSafePrevious() instantiation
+     * for the table and trie types of this iterator's rules.
+     */
+    template<typename Text>
+    int32_t selectHandleNext(Text text);
+
+    template<typename Text>
+    int32_t selectHandleSafePrevious(int32_t fromPosition, Text text);
 
 
     /**
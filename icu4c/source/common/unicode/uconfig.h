@@ -333,6 +333,19 @@
 #   define UCONFIG_USE_ML_PHRASE_BREAKING 0
 #endif
 
+/**
+ * \def UCONFIG_CJK_BREAK_CACHE_SIZE
+ * The number of recently segmented runs of CJK text for which the dictionary
+ * break engine remembers the word boundaries, so that segmenting the same text
+ * again skips the dictionary lookups.
+ * Set to 0 to turn off the cache.
+ *
+ * @internal
+ */
+#ifndef UCONFIG_CJK_BREAK_CACHE_SIZE
+#   define UCONFIG_CJK_BREAK_CACHE_SIZE 128
+#endif
+
 #if UCONFIG_NO_NORMALIZATION
     /* common library */
     /* ICU 50 CJK dictionary BreakIterator uses normalization */
@@ -760,6 +760,8 @@
 #define ucol_getRulesEx U_ICU_ENTRY_POINT_RENAME(ucol_getRulesEx)
 #define ucol_getShortDefinitionString U_ICU_ENTRY_POINT_RENAME(ucol_getShortDefinitionString)
 #define ucol_getSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getSortKey)
+#define ucol_getSortKeyPrefixes U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeyPrefixes)
+#define ucol_getSortKeys U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeys)
 #define ucol_getStrength U_ICU_ENTRY_POINT_RENAME(ucol_getStrength)
 #define ucol_getTailoredSet U_ICU_ENTRY_POINT_RENAME(ucol_getTailoredSet)
 #define ucol_getUCAVersion U_ICU_ENTRY_POINT_RENAME(ucol_getUCAVersion)
@@ -794,6 +796,7 @@
 #define ucol_setStrength U_ICU_ENTRY_POINT_RENAME(ucol_setStrength)
 #define ucol_setText U_ICU_ENTRY_POINT_RENAME(ucol_setText)
 #define ucol_setVariableTop U_ICU_ENTRY_POINT_RENAME(ucol_setVariableTop)
+#define ucol_sortStrings U_ICU_ENTRY_POINT_RENAME(ucol_sortStrings)
 #define ucol_strcoll U_ICU_ENTRY_POINT_RENAME(ucol_strcoll)
 #define ucol_strcollIter U_ICU_ENTRY_POINT_RENAME(ucol_strcollIter)
 #define ucol_strcollUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_strcollUTF8)
@@ -1576,6 +1579,7 @@
 #define uregex_find64 U_ICU_ENTRY_POINT_RENAME(uregex_find64)
 #define uregex_findNext U_ICU_ENTRY_POINT_RENAME(uregex_findNext)
 #define uregex_flags U_ICU_ENTRY_POINT_RENAME(uregex_flags)
+#define uregex_getEngine U_ICU_ENTRY_POINT_RENAME(uregex_getEngine)
 #define uregex_getFindProgressCallback U_ICU_ENTRY_POINT_RENAME(uregex_getFindProgressCallback)
 #define uregex_getMatchCallback U_ICU_ENTRY_POINT_RENAME(uregex_getMatchCallback)
 #define uregex_getStackLimit U_ICU_ENTRY_POINT_RENAME(uregex_getStackLimit)
@@ -1898,6 +1902,7 @@
 #define utext_freeze U_ICU_ENTRY_POINT_RENAME(utext_freeze)
 #define utext_getNativeIndex U_ICU_ENTRY_POINT_RENAME(utext_getNativeIndex)
 #define utext_getPreviousNativeIndex U_ICU_ENTRY_POINT_RENAME(utext_getPreviousNativeIndex)
+#define utext_getUTF8Contents U_ICU_ENTRY_POINT_RENAME(utext_getUTF8Contents)
 #define utext_hasMetaData U_ICU_ENTRY_POINT_RENAME(utext_hasMetaData)
 #define utext_isLengthExpensive U_ICU_ENTRY_POINT_RENAME(utext_isLengthExpensive)
 #define utext_isWritable U_ICU_ENTRY_POINT_RENAME(utext_isWritable)
@@ -13,6 +13,7 @@
 #include "unifiedcache.h"
 
 #include <algorithm>      // For std::max()
+#include <condition_variable>
 #include <mutex>
 
 #include "uassert.h"
@@ -20,24 +21,22 @@
 #include "ucln_cmn.h"
 
 static icu::UnifiedCache *gCache = nullptr;
-static std::mutex *gCacheMutex = nullptr;
-static std::condition_variable *gInProgressValueAddedCond;
 static icu::UInitOnce gCacheInitOnce {};
 
 static const int32_t MAX_EVICT_ITERATIONS = 10;
 static const int32_t DEFAULT_MAX_UNUSED = 1000;
 static const int32_t DEFAULT_PERCENTAGE_OF_IN_USE = 100;
 
+// The cache is split into 2^SHARD_BITS independently locked shards.
+static const int32_t SHARD_BITS = 4;
+static const int32_t NUM_SHARDS = 1 << SHARD_BITS;
+
 
 U_CDECL_BEGIN
 static UBool U_CALLCONV unifiedcache_cleanup() {
     gCacheInitOnce.reset();
     delete gCache;
     gCache = nullptr;
-    gCacheMutex->~mutex();
-    gCacheMutex = nullptr;
-    gInProgressValueAddedCond->~condition_variable();
-    gInProgressValueAddedCond = nullptr;
     return true;
 }
 U_CDECL_END
@@ -45,6 +44,19 @@ U_CDECL_END
 
 U_NAMESPACE_BEGIN
 
+/**
+ * One partition of the cache. All keys whose hash codes map to the shard,
+ * and the cache entries for them, live in its hash table and are guarded
+ * by its mutex.
+ */
+struct UnifiedCacheShard : public UMemory {
+    std::mutex fMutex;
+    // Signalled when an in-progress entry of this shard receives its value.
+    std::condition_variable fInProgressValueAddedCond;
+    UHashtable *fHashtable = nullptr;
+    int32_t fEvictPos = UHASH_FIRST;
+};
+
 int32_t U_EXPORT2
 ucache_hashKeys(const UHashTok key) {
     const CacheKeyBase* ckey = static_cast<const CacheKeyBase*>(key.pointer);
@@ -72,8 +84,6 @@ static void U_CALLCONV cacheInit(UErrorCode &status) {
     ucln_common_registerCleanup(
             UCLN_COMMON_UNIFIED_CACHE, unifiedcache_cleanup);
 
-    gCacheMutex = STATIC_NEW(std::mutex);
-    gInProgressValueAddedCond = STATIC_NEW(std::condition_variable);
     gCache = new UnifiedCache(status);
     if (gCache == nullptr) {
         status = U_MEMORY_ALLOCATION_ERROR;
@@ -95,8 +105,9 @@ UnifiedCache *UnifiedCache::getInstance(UErrorCode &status) {
 }
 
 UnifiedCache::UnifiedCache(UErrorCode &status) :
-        fHashtable(nullptr),
-        fEvictPos(UHASH_FIRST),
+        fShards(nullptr),
+        fEvictShard(0),
+        fNumKeys(0),
         fNumValuesTotal(0),
         fNumValuesInUse(0),
         fMaxUnused(DEFAULT_MAX_UNUSED),
@@ -115,15 +126,36 @@ UnifiedCache::UnifiedCache(UErrorCode &status) :
     fNoValue->hardRefCount = 1;  // when other references to it are removed.
     fNoValue->cachePtr = this;
 
-    fHashtable = uhash_open(
-            &ucache_hashKeys,
-            &ucache_compareKeys,
-            nullptr,
-            &status);
-    if (U_FAILURE(status)) {
+    fShards = new UnifiedCacheShard[NUM_SHARDS];
+    if (fShards == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
         return;
     }
-    uhash_setKeyDeleter(fHashtable, &ucache_deleteKey);
+    for (int32_t i = 0; i < NUM_SHARDS; ++i) {
+        UHashtable *hashtable = uhash_open(
+                &ucache_hashKeys,
+                &ucache_compareKeys,
+                nullptr,
+                &status);
+        if (U_FAILURE(status)) {
+            // Leave the cache without shards so the destructor has nothing to flush.
+            for (int32_t j = 0; j < i; ++j) {
+                uhash_close(fShards[j].fHashtable);
+            }
+            delete[] fShards;
+            fShards = nullptr;
+            return;
+        }
+        uhash_setKeyDeleter(hashtable, &ucache_deleteKey);
+        fShards[i].fHashtable = hashtable;
+    }
+}
+
+UnifiedCacheShard &UnifiedCache::_shardFor(const CacheKeyBase &key) const {
+    // Multiplicative hashing spreads keys whose hash codes differ
+    // only in their low bits across the shards.
+    uint32_t hash = static_cast<uint32_t>(key.hashCode()) * 0x9e3779b1u;
+    return fShards[hash >> (32 - SHARD_BITS)];
 }
 
 void UnifiedCache::setEvictionPolicy(
@@ -135,38 +167,42 @@ void UnifiedCache::setEvictionPolicy(
         status = U_ILLEGAL_ARGUMENT_ERROR;
         return;
     }
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    fMaxUnused = count;
-    fMaxPercentageOfInUse = percentageOfInUseItems;
+    umtx_storeRelease(fMaxUnused, count);
+    umtx_storeRelease(fMaxPercentageOfInUse, percentageOfInUseItems);
 }
 
 int32_t UnifiedCache::unusedCount() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    return uhash_count(fHashtable) - fNumValuesInUse;
+    return umtx_loadAcquire(fNumKeys) - umtx_loadAcquire(fNumValuesInUse);
 }
 
 int64_t UnifiedCache::autoEvictedCount() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    return fAutoEvictedCount;
+    return fAutoEvictedCount.load();
 }
 
 int32_t UnifiedCache::keyCount() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    return uhash_count(fHashtable);
+    return umtx_loadAcquire(fNumKeys);
 }
 
 void UnifiedCache::flush() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-
     // Use a loop in case cache items that are flushed held hard references to
     // other cache items making those additional cache items eligible for
-    // flushing.
-    while (_flush(false));
+    // flushing. Such items may live in any shard, so keep sweeping all of
+    // the shards until one full pass flushes nothing.
+    UBool flushedAny;
+    do {
+        flushedAny = false;
+        for (int32_t i = 0; i < NUM_SHARDS; ++i) {
+            UnifiedCacheShard &shard = fShards[i];
+            std::lock_guard<std::mutex> lock(shard.fMutex);
+            while (_flush(shard, false)) {
+                flushedAny = true;
+            }
+        }
+    } while (flushedAny);
 }
 
 void UnifiedCache::handleUnreferencedObject() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    --fNumValuesInUse;
+    umtx_atomic_dec(&fNumValuesInUse);
     _runEvictionSlice();
 }
 
@@ -184,70 +220,80 @@ void UnifiedCache::dump() {
 }
 
 void UnifiedCache::dumpContents() const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
     _dumpContents();
 }
 
 // Dumps content of cache.
-// On entry, gCacheMutex must be held.
+// On entry, no shard mutex may be held.
 // On exit, cache contents dumped to stderr.
 void UnifiedCache::_dumpContents() const {
-    int32_t pos = UHASH_FIRST;
-    const UHashElement *element = uhash_nextElement(fHashtable, &pos);
     char buffer[256];
     int32_t cnt = 0;
-    for (; element != nullptr; element = uhash_nextElement(fHashtable, &pos)) {
-        const SharedObject *sharedObject =
-                (const SharedObject *) element->value.pointer;
-        const CacheKeyBase *key =
-                (const CacheKeyBase *) element->key.pointer;
-        if (sharedObject->hasHardReferences()) {
-            ++cnt;
-            fprintf(
-                    stderr,
-                    "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
-                    key->writeDescription(buffer, 256),
-                    key->creationStatus,
-                    sharedObject == fNoValue ? nullptr :sharedObject,
-                    sharedObject->getRefCount(),
-                    sharedObject->getSoftRefCount());
+    for (int32_t i = 0; i < NUM_SHARDS; ++i) {
+        UnifiedCacheShard &shard = fShards[i];
+        std::lock_guard<std::mutex> lock(shard.fMutex);
+        int32_t pos = UHASH_FIRST;
+        const UHashElement *element = uhash_nextElement(shard.fHashtable, &pos);
+        for (; element != nullptr; element = uhash_nextElement(shard.fHashtable, &pos)) {
+            const SharedObject *sharedObject =
+                    (const SharedObject *) element->value.pointer;
+            const CacheKeyBase *key =
+                    (const CacheKeyBase *) element->key.pointer;
+            if (sharedObject->hasHardReferences()) {
+                ++cnt;
+                fprintf(
+                        stderr,
+                        "Unified Cache: Key '%s', error %d, value %p, total refcount %d, soft refcount %d\n",
+                        key->writeDescription(buffer, 256),
+                        key->creationStatus,
+                        sharedObject == fNoValue ? nullptr :sharedObject,
+                        sharedObject->getRefCount(),
+                        sharedObject->getSoftRefCount());
+            }
         }
     }
-    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, uhash_count(fHashtable));
+    fprintf(stderr, "Unified Cache: %d out of a total of %d still have hard references\n", cnt, keyCount());
 }
 #endif
 
 UnifiedCache::~UnifiedCache() {
-    // Try our best to clean up first.
-    flush();
-    {
+    if (fShards != nullptr) {
+        // Try our best to clean up first.
+        flush();
         // Now all that should be left in the cache are entries that refer to
         // each other and entries with hard references from outside the cache.
         // Nothing we can do about these so proceed to wipe out the cache.
-        std::lock_guard<std::mutex> lock(*gCacheMutex);
-        _flush(true);
+        for (int32_t i = 0; i < NUM_SHARDS; ++i) {
+            UnifiedCacheShard &shard = fShards[i];
+            std::lock_guard<std::mutex> lock(shard.fMutex);
+            _flush(shard, true);
+        }
+        for (int32_t i = 0; i < NUM_SHARDS; ++i) {
+            uhash_close(fShards[i].fHashtable);
+            fShards[i].fHashtable = nullptr;
+        }
+        delete[] fShards;
+        fShards = nullptr;
     }
-    uhash_close(fHashtable);
-    fHashtable = nullptr;
     delete fNoValue;
     fNoValue = nullptr;
 }
 
 const UHashElement *
-UnifiedCache::_nextElement() const {
-    const UHashElement *element = uhash_nextElement(fHashtable, &fEvictPos);
+UnifiedCache::_nextElement(UnifiedCacheShard &shard) const {
+    const UHashElement *element = uhash_nextElement(shard.fHashtable, &shard.fEvictPos);
     if (element == nullptr) {
-        fEvictPos = UHASH_FIRST;
-        return uhash_nextElement(fHashtable, &fEvictPos);
+        shard.fEvictPos = UHASH_FIRST;
+        return uhash_nextElement(shard.fHashtable, &shard.fEvictPos);
     }
     return element;
 }
 
-UBool UnifiedCache::_flush(UBool all) const {
+UBool UnifiedCache::_flush(UnifiedCacheShard &shard, UBool all) const {
     UBool result = false;
-    int32_t origSize = uhash_count(fHashtable);
+    int32_t origSize = uhash_count(shard.fHashtable);
     for (int32_t i = 0; i < origSize; ++i) {
-        const UHashElement *element = _nextElement();
+        const UHashElement *element = _nextElement(shard);
         if (element == nullptr) {
             break;
         }
@@ -255,7 +301,8 @@ UBool UnifiedCache::_flush(UBool all) const {
             const SharedObject *sharedObject =
                     static_cast<const SharedObject*>(element->value.pointer);
             U_ASSERT(sharedObject->cachePtr == this);
-            uhash_removeElement(fHashtable, element);
+            uhash_removeElement(shard.fHashtable, element);
+            umtx_atomic_dec(&fNumKeys);
             removeSoftRef(sharedObject);    // Deletes the sharedObject when softRefCount goes to zero.
             result = true;
         }
@@ -264,11 +311,13 @@ UBool UnifiedCache::_flush(UBool all) const {
 }
 
 int32_t UnifiedCache::_computeCountOfItemsToEvict() const {
-    int32_t totalItems = uhash_count(fHashtable);
-    int32_t evictableItems = totalItems - fNumValuesInUse;
+    int32_t totalItems = umtx_loadAcquire(fNumKeys);
+    int32_t numValuesInUse = umtx_loadAcquire(fNumValuesInUse);
+    int32_t evictableItems = totalItems - numValuesInUse;
 
-    int32_t unusedLimitByPercentage = fNumValuesInUse * fMaxPercentageOfInUse / 100;
-    int32_t unusedLimit = std::max(unusedLimitByPercentage, fMaxUnused);
+    int32_t unusedLimitByPercentage =
+            numValuesInUse * umtx_loadAcquire(fMaxPercentageOfInUse) / 100;
+    int32_t unusedLimit = std::max(unusedLimitByPercentage, umtx_loadAcquire(fMaxUnused));
     int32_t countOfItemsToEvict = std::max<int32_t>(0, evictableItems - unusedLimit);
     return countOfItemsToEvict;
 }
@@ -278,25 +327,50 @@ void UnifiedCache::_runEvictionSlice() const {
     if (maxItemsToEvict <= 0) {
         return;
     }
-    for (int32_t i = 0; i < MAX_EVICT_ITERATIONS; ++i) {
-        const UHashElement *element = _nextElement();
-        if (element == nullptr) {
-            break;
-        }
-        if (_isEvictable(element)) {
-            const SharedObject *sharedObject =
-                    static_cast<const SharedObject*>(element->value.pointer);
-            uhash_removeElement(fHashtable, element);
-            removeSoftRef(sharedObject);   // Deletes sharedObject when SoftRefCount goes to zero.
-            ++fAutoEvictedCount;
-            if (--maxItemsToEvict == 0) {
-                break;
+    // Continue round robin from the shard where the previous slice stopped.
+    // Each shard is locked only while its own entries are examined, so that
+    // a slice never holds more than one shard mutex at a time.
+    int32_t shardIndex = umtx_loadAcquire(fEvictShard);
+    int32_t iterations = 0;
+    int32_t emptyShardsInARow = 0;
+    while (iterations < MAX_EVICT_ITERATIONS && maxItemsToEvict > 0 &&
+            emptyShardsInARow < NUM_SHARDS) {
+        UnifiedCacheShard &shard = fShards[shardIndex];
+        UBool reachedEnd = false;
+        int32_t visited = 0;
+        {
+            std::lock_guard<std::mutex> lock(shard.fMutex);
+            while (iterations < MAX_EVICT_ITERATIONS && maxItemsToEvict > 0) {
+                const UHashElement *element =
+                        uhash_nextElement(shard.fHashtable, &shard.fEvictPos);
+                if (element == nullptr) {
+                    shard.fEvictPos = UHASH_FIRST;
+                    reachedEnd = true;
+                    break;
+                }
+                ++iterations;
+                ++visited;
+                if (_isEvictable(element)) {
+                    const SharedObject *sharedObject =
+                            static_cast<const SharedObject*>(element->value.pointer);
+                    uhash_removeElement(shard.fHashtable, element);
+                    umtx_atomic_dec(&fNumKeys);
+                    removeSoftRef(sharedObject);   // Deletes sharedObject when SoftRefCount goes to zero.
+                    ++fAutoEvictedCount;
+                    --maxItemsToEvict;
+                }
             }
         }
+        emptyShardsInARow = visited == 0 ? emptyShardsInARow + 1 : 0;
+        if (reachedEnd) {
+            shardIndex = (shardIndex + 1) & (NUM_SHARDS - 1);
+        }
     }
+    umtx_storeRelease(fEvictShard, shardIndex);
 }
 
 void UnifiedCache::_putNew(
+        UnifiedCacheShard &shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -310,14 +384,12 @@ void UnifiedCache::_putNew(
         return;
     }
     keyToAdopt->fCreationStatus = creationStatus;
-    if (value->softRefCount == 0) {
-        _registerPrimary(keyToAdopt, value);
-    }
-    void *oldValue = uhash_put(fHashtable, keyToAdopt, (void *) value, &status);
+    void *oldValue = uhash_put(shard.fHashtable, keyToAdopt, (void *) value, &status);
     U_ASSERT(oldValue == nullptr);
     (void)oldValue;
     if (U_SUCCESS(status)) {
-        value->softRefCount++;
+        umtx_atomic_inc(&fNumKeys);
+        _addSoftRef(keyToAdopt, value);
     }
 }
 
@@ -325,21 +397,25 @@ void UnifiedCache::_putIfAbsentAndGet(
         const CacheKeyBase &key,
         const SharedObject *&value,
         UErrorCode &status) const {
-    std::lock_guard<std::mutex> lock(*gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
-    if (element != nullptr && !_inProgress(element)) {
-        _fetch(element, value, status);
-        return;
-    }
-    if (element == nullptr) {
-        UErrorCode putError = U_ZERO_ERROR;
-        // best-effort basis only.
-        _putNew(key, value, status, putError);
-    } else {
-        _put(element, value, status);
+    UnifiedCacheShard &shard = _shardFor(key);
+    {
+        std::lock_guard<std::mutex> lock(shard.fMutex);
+        const UHashElement *element = uhash_find(shard.fHashtable, &key);
+        if (element != nullptr && !_inProgress(element)) {
+            _fetch(element, value, status);
+            return;
+        }
+        if (element == nullptr) {
+            UErrorCode putError = U_ZERO_ERROR;
+            // best-effort basis only.
+            _putNew(shard, key, value, status, putError);
+        } else {
+            _put(shard, element, value, status);
+        }
     }
     // Run an eviction slice. This will run even if we added a primary entry
     // which doesn't increase the unused count, but that is still o.k
+    // The slice locks shards one at a time, so the lock above must be released first.
     _runEvictionSlice();
 }
 
@@ -350,15 +426,16 @@ UBool UnifiedCache::_poll(
         UErrorCode &status) const {
     U_ASSERT(value == nullptr);
     U_ASSERT(status == U_ZERO_ERROR);
-    std::unique_lock<std::mutex> lock(*gCacheMutex);
-    const UHashElement *element = uhash_find(fHashtable, &key);
+    UnifiedCacheShard &shard = _shardFor(key);
+    std::unique_lock<std::mutex> lock(shard.fMutex);
+    const UHashElement *element = uhash_find(shard.fHashtable, &key);
 
     // If the hash table contains an inProgress placeholder entry for this key,
     // this means that another thread is currently constructing the value object.
     // Loop, waiting for that construction to complete.
      while (element != nullptr && _inProgress(element)) {
-         gInProgressValueAddedCond->wait(lock);
-         element = uhash_find(fHashtable, &key);
+         shard.fInProgressValueAddedCond.wait(lock);
+         element = uhash_find(shard.fHashtable, &key);
     }
 
     // If the hash table contains an entry for the key,
@@ -371,7 +448,7 @@ UBool UnifiedCache::_poll(
     // The hash table contained nothing for this key.
     // Insert an inProgress place holder value.
     // Our caller will create the final value and update the hash table.
-    _putNew(key, fNoValue, U_ZERO_ERROR, status);
+    _putNew(shard, key, fNoValue, U_ZERO_ERROR, status);
     return false;
 }
 
@@ -407,11 +484,22 @@ void UnifiedCache::_registerPrimary(
             const CacheKeyBase *theKey, const SharedObject *value) const {
     theKey->fIsPrimary = true;
     value->cachePtr = this;
-    ++fNumValuesTotal;
-    ++fNumValuesInUse;
+    umtx_atomic_inc(&fNumValuesTotal);
+    umtx_atomic_inc(&fNumValuesInUse);
+}
+
+void UnifiedCache::_addSoftRef(
+        const CacheKeyBase *theKey, const SharedObject *value) const {
+    // Testing the result of the increment, rather than loading the count
+    // first, makes exactly one key primary even when keys in other shards
+    // add soft references to the same value at the same time.
+    if (umtx_atomic_inc(&value->softRefCount) == 1) {
+        _registerPrimary(theKey, value);
+    }
 }
 
 void UnifiedCache::_put(
+        UnifiedCacheShard &shard,
         const UHashElement *element,
         const SharedObject *value,
         const UErrorCode status) const {
@@ -419,10 +507,7 @@ void UnifiedCache::_put(
     const CacheKeyBase* theKey = static_cast<const CacheKeyBase*>(element->key.pointer);
     const SharedObject* oldValue = static_cast<const SharedObject*>(element->value.pointer);
     theKey->fCreationStatus = status;
-    if (value->softRefCount == 0) {
-        _registerPrimary(theKey, value);
-    }
-    value->softRefCount++;
+    _addSoftRef(theKey, value);
     UHashElement *ptr = const_cast<UHashElement *>(element);
     ptr->value.pointer = (void *) value;
     U_ASSERT(oldValue == fNoValue);
@@ -430,7 +515,7 @@ void UnifiedCache::_put(
 
     // Tell waiting threads that we replace in-progress status with
     // an error.
-    gInProgressValueAddedCond->notify_all();
+    shard.fInProgressValueAddedCond.notify_all();
 }
 
 void UnifiedCache::_fetch(
@@ -475,14 +560,15 @@ UBool UnifiedCache::_isEvictable(const UHashElement *element) const
 
     // We can evict entries that are either not a primary or have just
     // one reference (The one reference being from the cache itself).
-    return (!theKey->fIsPrimary || (theValue->softRefCount == 1 && theValue->noHardReferences()));
+    return (!theKey->fIsPrimary ||
+            (umtx_loadAcquire(theValue->softRefCount) == 1 && theValue->noHardReferences()));
 }
 
 void UnifiedCache::removeSoftRef(const SharedObject *value) const {
     U_ASSERT(value->cachePtr == this);
-    U_ASSERT(value->softRefCount > 0);
-    if (--value->softRefCount == 0) {
-        --fNumValuesTotal;
+    U_ASSERT(umtx_loadAcquire(value->softRefCount) > 0);
+    if (umtx_atomic_dec(&value->softRefCount) == 0) {
+        umtx_atomic_dec(&fNumValuesTotal);
         if (value->noHardReferences()) {
             delete value;
         } else {
@@ -500,7 +586,7 @@ int32_t UnifiedCache::removeHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_dec(&value->hardRefCount);
         U_ASSERT(refCount >= 0);
         if (refCount == 0) {
-            --fNumValuesInUse;
+            umtx_atomic_dec(&fNumValuesInUse);
         }
     }
     return refCount;
@@ -512,7 +598,7 @@ int32_t UnifiedCache::addHardRef(const SharedObject *value) const {
         refCount = umtx_atomic_inc(&value->hardRefCount);
         U_ASSERT(refCount >= 1);
         if (refCount == 1) {
-            fNumValuesInUse++;
+            umtx_atomic_inc(&fNumValuesInUse);
         }
     }
     return refCount;
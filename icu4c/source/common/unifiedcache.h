@@ -28,6 +28,7 @@ struct UHashElement;
 U_NAMESPACE_BEGIN
 
 class UnifiedCache;
+struct UnifiedCacheShard;
 
 /**
  * A base class for all cache keys.
@@ -179,6 +180,11 @@ class LocaleCacheKey : public CacheKey<T> {
  * The unified cache. A singleton type.
  * Design doc here:
  * https://docs.google.com/document/d/1RwGQJs4N4tawNbf809iYDRCvXoMKqDJihxzYt1ysmd8/edit?usp=sharing
+ *
+ * Keys are partitioned by hash code into a fixed number of shards, each with
+ * its own hash table and mutex, so that lookups of unrelated keys from
+ * different threads do not contend on a single lock. The counters that drive
+ * the eviction policy are shared by all shards and are updated atomically.
  */
 class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
  public:
@@ -345,38 +351,45 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    virtual ~UnifiedCache();
    
  private:
-   UHashtable *fHashtable;
-   mutable int32_t fEvictPos;
-   mutable int32_t fNumValuesTotal;
-   mutable int32_t fNumValuesInUse;
-   int32_t fMaxUnused;
-   int32_t fMaxPercentageOfInUse;
-   mutable int64_t fAutoEvictedCount;
+   UnifiedCacheShard *fShards;
+   mutable u_atomic_int32_t fEvictShard;
+   mutable u_atomic_int32_t fNumKeys;
+   mutable u_atomic_int32_t fNumValuesTotal;
+   mutable u_atomic_int32_t fNumValuesInUse;
+   mutable u_atomic_int32_t fMaxUnused;
+   mutable u_atomic_int32_t fMaxPercentageOfInUse;
+   mutable std::atomic<int64_t> fAutoEvictedCount;
    SharedObject *fNoValue;
    
    UnifiedCache(const UnifiedCache &other) = delete;
    UnifiedCache &operator=(const UnifiedCache &other) = delete;
    
    /**
-    * Flushes the contents of the cache. If cache values hold references to other
+    * Returns the shard that holds the given key.
+    */
+   UnifiedCacheShard &_shardFor(const CacheKeyBase &key) const;
+
+   /**
+    * Flushes the contents of one shard. If cache values hold references to other
     * cache values then _flush should be called in a loop until it returns false.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, the shard's mutex must be held.
     * On exit, those values with are evictable are flushed.
     * 
+    *  @param shard the shard to flush.
     *  @param all if false flush evictable items only, which are those with no external
     *                    references, plus those that can be safely recreated.<br>
     *            if true, flush all elements. Any values (sharedObjects) with remaining
     *                     hard (external) references are not deleted, but are detached from
     *                     the cache, so that a subsequent removeRefs can delete them.
     *                     _flush is not thread safe when all is true.
-    *   @return true if any value in cache was flushed or false otherwise.
+    *   @return true if any value in the shard was flushed or false otherwise.
     */
-   UBool _flush(UBool all) const;
+   UBool _flush(UnifiedCacheShard &shard, UBool all) const;
    
    /**
     * Gets value out of cache.
-    * On entry. gCacheMutex must not be held. value must be nullptr. status
+    * On entry. No shard mutex may be held. value must be nullptr. status
     * must be U_ZERO_ERROR.
     * On exit. value and status set to what is in cache at key or on cache
     * miss the key's createObject() is called and value and status are set to
@@ -393,7 +406,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
 
     /**
      * Attempts to fetch value and status for key from cache.
-     * On entry, gCacheMutex must not be held value must be nullptr and status must
+     * On entry, no shard mutex may be held, value must be nullptr and status must
      * be U_ZERO_ERROR.
      * On exit, either returns false (In this
      * case caller should try to create the object) or returns true with value
@@ -409,11 +422,13 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     
     /**
      * Places a new value and creationStatus in the cache for the given key.
-     * On entry, gCacheMutex must be held. key must not exist in the cache. 
+     * On entry, the mutex of the key's shard must be held. key must not exist
+     * in the cache. 
      * On exit, value and creation status placed under key. Soft reference added
      * to value on successful add. On error sets status.
      */
     void _putNew(
+        UnifiedCacheShard &shard,
         const CacheKeyBase &key,
         const SharedObject *value,
         const UErrorCode creationStatus,
@@ -424,7 +439,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
      * entry for key is in progress. Otherwise, it leaves the current value and
      * status there.
      * 
-     * On entry. gCacheMutex must not be held. Value must be
+     * On entry. No shard mutex may be held. Value must be
      * included in the reference count of the object to which it points.
      * 
      * On exit, value and status are changed to what was already in the cache if
@@ -438,11 +453,11 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
            UErrorCode &status) const;
 
     /**
-     * Returns the next element in the cache round robin style.
-     * Returns nullptr if the cache is empty.
-     * On entry, gCacheMutex must be held.
+     * Returns the next element in the shard round robin style.
+     * Returns nullptr if the shard is empty.
+     * On entry, the shard's mutex must be held.
      */
-    const UHashElement *_nextElement() const;
+    const UHashElement *_nextElement(UnifiedCacheShard &shard) const;
    
    /**
     * Return the number of cache items that would need to be evicted
@@ -450,15 +465,18 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * 
     * An item corresponds to an entry in the hash table, a hash table element.
     * 
-    * On entry, gCacheMutex must be held.
+    * May be called with or without a shard mutex held; the result is a
+    * snapshot of the shared counters.
     */
    int32_t _computeCountOfItemsToEvict() const;
    
    /**
     * Run an eviction slice.
-    * On entry, gCacheMutex must be held.
+    * On entry, no shard mutex may be held.
     * _runEvictionSlice runs a slice of the evict pipeline by examining the next
     * 10 entries in the cache round robin style evicting them if they are eligible.
+    * Shards are visited in turn, each one locked only while its own entries
+    * are examined.
     */
    void _runEvictionSlice() const;
  
@@ -468,36 +486,46 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
     * produce references to an already existing SharedObject are not primary -
     * they can be evicted and subsequently recreated.
     * 
-    * On entry, gCacheMutex must be held.
+    * On entry, the mutex of the key's shard must be held.
     * On exit, items in use count incremented, entry is marked as a primary
     * entry, and value registered with cache so that subsequent calls to
     * addRef() and removeRef() on it correctly interact with the cache.
     */
    void _registerPrimary(const CacheKeyBase *theKey, const SharedObject *value) const;
-        
+
+   /**
+    * Adds a soft reference to value for the hash entry with key theKey,
+    * and registers that entry as primary if it holds the first soft reference.
+    * The count is checked and incremented in one atomic step because keys
+    * in other shards may concurrently add soft references to the same value.
+    * On entry, the mutex of the key's shard must be held.
+    */
+   void _addSoftRef(const CacheKeyBase *theKey, const SharedObject *value) const;
+
    /**
     * Store a value and creation error status in given hash entry.
-    * On entry, gCacheMutex must be held. Hash entry element must be in progress.
-    * value must be non nullptr.
+    * On entry, the shard's mutex must be held. Hash entry element must be in
+    * progress. value must be non nullptr.
     * On Exit, soft reference added to value. value and status stored in hash
-    * entry. Soft reference removed from previous stored value. Waiting
-    * threads notified.
+    * entry. Soft reference removed from previous stored value. Threads waiting
+    * on the shard notified.
     */
    void _put(
+           UnifiedCacheShard &shard,
            const UHashElement *element,
            const SharedObject *value,
            const UErrorCode status) const;
     /**
      * Remove a soft reference, and delete the SharedObject if no references remain.
      * To be used from within the UnifiedCache implementation only.
-     * gCacheMutex must be held by caller.
+     * The mutex of the shard holding the reference must be held by caller.
      * @param value the SharedObject to be acted on.
      */
    void removeSoftRef(const SharedObject *value) const;
    
    /**
     * Increment the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * A shard mutex must be held by the caller.
     * Update numValuesEvictable on transitions between zero and one reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -507,7 +535,7 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
   /**
     * Decrement the hard reference count of the given SharedObject.
-    * gCacheMutex must be held by the caller.
+    * A shard mutex must be held by the caller.
     * Update numValuesEvictable on transitions between one and zero reference.
     * 
     * @param value The SharedObject to be referenced.
@@ -522,8 +550,9 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
    
    /**
     *  Fetch value and error code from a particular hash entry.
-    *  On entry, gCacheMutex must be held. value must be either nullptr or must be
-    *  included in the ref count of the object to which it points.
+    *  On entry, the mutex of the element's shard must be held. value must be
+    *  either nullptr or must be included in the ref count of the object to
+    *  which it points.
     *  On exit, value and status set to what is in the hash entry. Caller must
     *  eventually call removeRef on value.
     *  If hash entry is in progress, value will be set to gNoValue and status will
@@ -534,19 +563,19 @@ class U_COMMON_API UnifiedCache : public UnifiedCacheBase {
                        
     /**
      * Determine if given hash entry is in progress.
-     * On entry, gCacheMutex must be held.
+     * On entry, the mutex of the element's shard must be held.
      */
    UBool _inProgress(const UHashElement *element) const;
    
    /**
     * Determine if given hash entry is in progress.
-    * On entry, gCacheMutex must be held.
+    * On entry, the mutex of the element's shard must be held.
     */
    UBool _inProgress(const SharedObject *theValue, UErrorCode creationStatus) const;
    
    /**
     * Determine if given hash entry is eligible for eviction.
-    * On entry, gCacheMutex must be held.
+    * On entry, the mutex of the element's shard must be held.
     */
    UBool _isEvictable(const UHashElement *element) const;
 };
@@ -0,0 +1,246 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+**********************************************************************
+*   file name:  ustr_ascii.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Bulk copying of ASCII runs between 8-bit and 16-bit code unit strings.
+*   Used by the UTF-8 transcoding functions and converters to skip the
+*   per-code-point state machines while the input is plain ASCII.
+*   Also bulk spanning of code units below a threshold, which the normalizer
+*   uses to skip text below its minimum "no/maybe" code points.
+*
+*   The functions work on whole blocks only: They stop at the first block
+*   that contains a non-ASCII code unit, or when fewer than a block's worth
+*   of code units remain, and leave the rest to the caller's regular loop.
+*   On x86-64 (SSE2) and AArch64 (NEON) a block is 16 code units and is
+*   handled with vector instructions that are part of the baseline ISA,
+*   so no runtime CPU dispatch is needed. Elsewhere a block is 8 code units
+*   checked as one 64-bit word.
+*/
+
+#ifndef __USTR_ASCII_H__
+#define __USTR_ASCII_H__
+
+#include "unicode/utypes.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define UPRV_ASCII_SSE2 1
+#   include <emmintrin.h>
+#elif (defined(__aarch64__) && defined(__ARM_NEON)) || defined(_M_ARM64)
+#   define UPRV_ASCII_NEON 1
+#   include <arm_neon.h>
+#endif
+
+#include <string.h>
+
+/**
+ * Number of code units that the bulk ASCII functions process at once.
+ * Callers need not bother calling them for shorter inputs.
+ */
+#if defined(UPRV_ASCII_SSE2) || defined(UPRV_ASCII_NEON)
+#   define UPRV_ASCII_BLOCK_LENGTH 16
+#else
+#   define UPRV_ASCII_BLOCK_LENGTH 8
+#endif
+
+/**
+ * Copies leading whole blocks of ASCII bytes (0..0x7f) from src to dest,
+ * widening each byte to a char16_t.
+ * @param src source bytes
+ * @param length number of bytes available in src; dest must have room
+ *               for at least as many char16_t
+ * @param dest destination
+ * @return the number of bytes copied, a multiple of UPRV_ASCII_BLOCK_LENGTH
+ *         and at most length
+ * @internal
+ */
+static inline int32_t
+uprv_copyASCIIToUTF16(const uint8_t *src, int32_t length, char16_t *dest) {
+    int32_t i = 0;
+#if defined(UPRV_ASCII_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; (length - i) >= 16; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        if (_mm_movemask_epi8(bytes) != 0) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 8), _mm_unpackhi_epi8(bytes, zero));
+    }
+#elif defined(UPRV_ASCII_NEON)
+    for (; (length - i) >= 16; i += 16) {
+        uint8x16_t bytes = vld1q_u8(src + i);
+        if (vmaxvq_u8(bytes) >= 0x80) {
+            break;
+        }
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest + i), vmovl_u8(vget_low_u8(bytes)));
+        vst1q_u16(reinterpret_cast<uint16_t *>(dest + i + 8), vmovl_high_u8(bytes));
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        uint64_t word;
+        memcpy(&word, src + i, 8);
+        if ((word & 0x8080808080808080ULL) != 0) {
+            break;
+        }
+        for (int32_t j = 0; j < 8; ++j) {
+            dest[i + j] = src[i + j];
+        }
+    }
+#endif
+    return i;
+}
+
+/**
+ * Copies leading whole blocks of ASCII code units (0..0x7f) from src to dest,
+ * narrowing each char16_t to a byte.
+ * @param src source code units
+ * @param length number of code units available in src; dest must have room
+ *               for at least as many bytes
+ * @param dest destination
+ * @return the number of code units copied, a multiple of UPRV_ASCII_BLOCK_LENGTH
+ *         and at most length
+ * @internal
+ */
+static inline int32_t
+uprv_copyASCIIToUTF8(const char16_t *src, int32_t length, uint8_t *dest) {
+    int32_t i = 0;
+#if defined(UPRV_ASCII_SSE2)
+    const __m128i nonASCII = _mm_set1_epi16(static_cast<short>(0xff80));
+    for (; (length - i) >= 16; i += 16) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+        __m128i high = _mm_and_si128(_mm_or_si128(lo, hi), nonASCII);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xffff) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(UPRV_ASCII_NEON)
+    for (; (length - i) >= 16; i += 16) {
+        uint16x8_t lo = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i));
+        uint16x8_t hi = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i + 8));
+        if (vmaxvq_u16(vorrq_u16(lo, hi)) >= 0x80) {
+            break;
+        }
+        vst1q_u8(dest + i, vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        char16_t bits = 0;
+        for (int32_t j = 0; j < 8; ++j) {
+            bits |= src[i + j];
+        }
+        if (bits >= 0x80) {
+            break;
+        }
+        for (int32_t j = 0; j < 8; ++j) {
+            dest[i + j] = static_cast<uint8_t>(src[i + j]);
+        }
+    }
+#endif
+    return i;
+}
+
+/**
+ * Returns the length of the leading whole blocks of s in which
+ * all code units are less than the threshold.
+ * @param s source code units
+ * @param length number of code units available in s
+ * @param threshold the code unit limit
+ * @return the number of code units spanned, a multiple of UPRV_ASCII_BLOCK_LENGTH
+ *         and at most length
+ * @internal
+ */
+static inline int32_t
+uprv_spanUTF16Below(const char16_t *s, int32_t length, char16_t threshold) {
+    int32_t i = 0;
+    if (threshold == 0) {
+        return 0;
+    }
+#if defined(UPRV_ASCII_SSE2)
+    // Unsigned x < threshold <=> saturating x - (threshold-1) == 0.
+    const __m128i max = _mm_set1_epi16(static_cast<short>(threshold - 1));
+    for (; (length - i) >= 16; i += 16) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i + 8));
+        __m128i above = _mm_or_si128(_mm_subs_epu16(lo, max), _mm_subs_epu16(hi, max));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(above, _mm_setzero_si128())) != 0xffff) {
+            break;
+        }
+    }
+#elif defined(UPRV_ASCII_NEON)
+    for (; (length - i) >= 16; i += 16) {
+        uint16x8_t lo = vld1q_u16(reinterpret_cast<const uint16_t *>(s + i));
+        uint16x8_t hi = vld1q_u16(reinterpret_cast<const uint16_t *>(s + i + 8));
+        if (vmaxvq_u16(vmaxq_u16(lo, hi)) >= threshold) {
+            break;
+        }
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        char16_t max = 0;
+        for (int32_t j = 0; j < 8; ++j) {
+            if (s[i + j] > max) {
+                max = s[i + j];
+            }
+        }
+        if (max >= threshold) {
+            break;
+        }
+    }
+#endif
+    return i;
+}
+
+/**
+ * Returns the length of the leading whole blocks of s in which
+ * all bytes are less than the threshold.
+ * @param s source bytes
+ * @param length number of bytes available in s
+ * @param threshold the byte limit
+ * @return the number of bytes spanned, a multiple of UPRV_ASCII_BLOCK_LENGTH
+ *         and at most length
+ * @internal
+ */
+static inline int32_t
+uprv_spanUTF8Below(const uint8_t *s, int32_t length, uint8_t threshold) {
+    int32_t i = 0;
+    if (threshold == 0) {
+        return 0;
+    }
+#if defined(UPRV_ASCII_SSE2)
+    const __m128i max = _mm_set1_epi8(static_cast<char>(threshold - 1));
+    for (; (length - i) >= 16; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(bytes, max), _mm_setzero_si128())) != 0xffff) {
+            break;
+        }
+    }
+#elif defined(UPRV_ASCII_NEON)
+    for (; (length - i) >= 16; i += 16) {
+        if (vmaxvq_u8(vld1q_u8(s + i)) >= threshold) {
+            break;
+        }
+    }
+#else
+    for (; (length - i) >= 8; i += 8) {
+        uint8_t max = 0;
+        for (int32_t j = 0; j < 8; ++j) {
+            if (s[i + j] > max) {
+                max = s[i + j];
+            }
+        }
+        if (max >= threshold) {
+            break;
+        }
+    }
+#endif
+    return i;
+}
+
+#endif
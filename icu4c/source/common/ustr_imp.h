@@ -58,6 +58,18 @@ u_asciiToUpper(UChar c);
 
 // TODO: Add u_asciiToLower if/when there is a need for it.
 
+struct UText;
+
+/**
+ * If the UText was opened with utext_openUTF8() (or is a clone of one),
+ * then returns a pointer to its UTF-8 string and sets *pLength to the string length.
+ * Otherwise returns nullptr.
+ * The UText native indexes are the string's byte offsets.
+ * Finds the length of a NUL-terminated string if it is not yet known.
+ */
+U_CAPI const char * U_EXPORT2
+utext_getUTF8Contents(struct UText *ut, int32_t *pLength);
+
 /**
  * NUL-terminate a UChar * string if possible.
  * If length  < destCapacity then NUL-terminate.
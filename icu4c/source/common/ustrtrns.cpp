@@ -33,6 +33,7 @@
 #include "unicode/utf16.h"
 #include "cstring.h"
 #include "cmemory.h"
+#include "ustr_ascii.h"
 #include "ustr_imp.h"
 #include "uassert.h"
 
@@ -379,13 +380,24 @@ u_strFromUTF8WithSub(char16_t *dest,
         int32_t i = 0;
         UChar32 c;
         for(;;) {
+            /* Copy a run of ASCII in bulk. */
+            int32_t count = (int32_t)(pDestLimit - pDest);
+            if(count > (srcLength - i)) {
+                count = srcLength - i;
+            }
+            if(count >= UPRV_ASCII_BLOCK_LENGTH) {
+                int32_t asciiLength = uprv_copyASCIIToUTF16((const uint8_t *)src + i, count, pDest);
+                i += asciiLength;
+                pDest += asciiLength;
+            }
+
             /*
              * Each iteration of the inner loop progresses by at most 3 UTF-8
              * bytes and one char16_t, for most characters.
              * For supplementary code points (4 & 2), which are rare,
              * there is an additional adjustment.
              */
-            int32_t count = (int32_t)(pDestLimit - pDest);
+            count = (int32_t)(pDestLimit - pDest);
             int32_t count2 = (srcLength - i) / 3;
             if(count > count2) {
                 count = count2; /* min(remaining dest, remaining src/3) */
@@ -899,6 +911,18 @@ u_strToUTF8WithSub(char *dest,
 
         /* Faster loop without ongoing checking for pSrcLimit and pDestLimit. */
         for(;;) {
+            /* Copy a run of ASCII in bulk. */
+            count = (int32_t)(pDestLimit - pDest);
+            srcLength = (int32_t)(pSrcLimit - pSrc);
+            if(count > srcLength) {
+                count = srcLength;
+            }
+            if(count >= UPRV_ASCII_BLOCK_LENGTH) {
+                int32_t asciiLength = uprv_copyASCIIToUTF8(pSrc, count, pDest);
+                pSrc += asciiLength;
+                pDest += asciiLength;
+            }
+
             /*
              * Each iteration of the inner loop progresses by at most 3 UTF-8
              * bytes and one char16_t, for most characters.
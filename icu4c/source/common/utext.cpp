@@ -1628,6 +1628,16 @@ static const struct UTextFuncs utf8Funcs =
 };
 
 
+U_CAPI const char * U_EXPORT2
+utext_getUTF8Contents(UText *ut, int32_t *pLength) {
+    if (ut->pFuncs != &utf8Funcs) {
+        return nullptr;
+    }
+    *pLength = static_cast<int32_t>(utf8TextLength(ut));
+    return static_cast<const char *>(ut->context);
+}
+
+
 static const char gEmptyString[] = {0};
 
 U_CAPI UText * U_EXPORT2
@@ -0,0 +1,68 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// uthreadpool.h
+// Runs independent tasks on a set of short-lived threads.
+
+#ifndef __UTHREADPOOL_H__
+#define __UTHREADPOOL_H__
+
+#include <thread>
+
+#include "unicode/utypes.h"
+#include "unicode/localpointer.h"
+#include "unicode/uobject.h"
+
+U_NAMESPACE_BEGIN
+
+/** Wraps std::thread so that arrays of threads use ICU's heap functions. */
+struct TaskThread : public UMemory {
+    std::thread thread;
+};
+
+/**
+ * Runs task(0..taskCount-1), with task 0 on the calling thread
+ * and each of the others on a new thread, and returns when all of them are done.
+ * The tasks must not depend on each other.
+ *
+ * If a thread cannot be started, then the tasks that have not been started yet
+ * run on the calling thread; no exception escapes.
+ * Sets U_MEMORY_ALLOCATION_ERROR and runs no task
+ * if the thread objects cannot be allocated.
+ */
+template<typename Task>
+void runTasks(int32_t taskCount, const Task &task, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (taskCount <= 1) {
+        task(0);
+        return;
+    }
+    LocalArray<TaskThread> threads(new TaskThread[taskCount - 1]);
+    if (threads.isNull()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t started = 1;
+    try {
+        for (; started < taskCount; ++started) {
+            threads[started - 1].thread = std::thread(task, started);
+        }
+    } catch (...) {
+        // std::system_error or std::bad_alloc: Fall back to the calling thread.
+        // Catching all avoids a dependency on std::exception's type info.
+    }
+    for (int32_t i = started; i < taskCount; ++i) {
+        task(i);
+    }
+    task(0);
+    // Only the threads that were started are joinable.
+    for (int32_t i = 1; i < started; ++i) {
+        threads[i - 1].thread.join();
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // __UTHREADPOOL_H__
@@ -35,6 +35,7 @@
 #include "uarrsort.h"
 
 #include "cstring.h"
+#include "fphdlimp.h"
 #include "windtfmt.h"
 
 #if defined( U_DEBUG_CALSVC ) || defined (U_DEBUG_CAL)
@@ -282,6 +283,14 @@ DateFormat::format(UDate date, UnicodeString& appendTo, FieldPosition& fieldPosi
         UErrorCode ec = U_ZERO_ERROR;
         // Avoid a heap allocation and corresponding free for the common case
         if (typeid(*fCalendar) == typeid(GregorianCalendar)) {
+            // SimpleDateFormat can usually format the date without a copy of the calendar.
+            if (typeid(*this) == typeid(SimpleDateFormat)) {
+                FieldPositionOnlyHandler handler(fieldPosition);
+                if (static_cast<const SimpleDateFormat*>(this)->fastFormat(
+                        date, *fCalendar, appendTo, handler)) {
+                    return appendTo;
+                }
+            }
             GregorianCalendar cal(*static_cast<GregorianCalendar*>(fCalendar));
             cal.setTime(date, ec);
             if (U_SUCCESS(ec)) {
@@ -349,6 +358,11 @@ DateFormat::parse(const UnicodeString& text,
 {
     UDate d = 0; // Error return UDate is 0 (the epoch)
     if (fCalendar != nullptr) {
+        // SimpleDateFormat can usually parse fixed patterns without a copy of the calendar.
+        if (typeid(*this) == typeid(SimpleDateFormat) &&
+                static_cast<const SimpleDateFormat*>(this)->fastParse(text, pos, d)) {
+            return d;
+        }
         Calendar* calClone = fCalendar->clone();
         if (calClone != nullptr) {
             int32_t start = pos.getIndex();
@@ -7,6 +7,7 @@
 
 #include "formatted_string_builder.h"
 #include "putilimp.h"
+#include "unicode/formattedvalue.h"
 #include "unicode/ustring.h"
 #include "unicode/utf16.h"
 #include "unicode/unum.h" // for UNumberFormatFields literals
@@ -46,8 +47,8 @@ FormattedStringBuilder::FormattedStringBuilder() {
 
 FormattedStringBuilder::~FormattedStringBuilder() {
     if (fUsingHeap) {
-        uprv_free(fChars.heap.ptr);
-        uprv_free(fFields.heap.ptr);
+        freeMemory(fChars.heap.ptr);
+        freeMemory(fFields.heap.ptr);
     }
 }
 
@@ -63,21 +64,20 @@ FormattedStringBuilder &FormattedStringBuilder::operator=(const FormattedStringB
 
     // Continue with deallocation and copying
     if (fUsingHeap) {
-        uprv_free(fChars.heap.ptr);
-        uprv_free(fFields.heap.ptr);
+        freeMemory(fChars.heap.ptr);
+        freeMemory(fFields.heap.ptr);
         fUsingHeap = false;
     }
 
     int32_t capacity = other.getCapacity();
     if (capacity > DEFAULT_CAPACITY) {
-        // FIXME: uprv_malloc
-        // C++ note: malloc appears in two places: here and in prepareForInsertHelper.
-        auto* newChars = static_cast<char16_t*>(uprv_malloc(sizeof(char16_t) * capacity));
-        auto* newFields = static_cast<Field*>(uprv_malloc(sizeof(Field) * capacity));
+        // C++ note: allocation appears in two places: here and in prepareForInsertHelper.
+        auto* newChars = static_cast<char16_t*>(allocateMemory(sizeof(char16_t) * capacity));
+        auto* newFields = static_cast<Field*>(allocateMemory(sizeof(Field) * capacity));
         if (newChars == nullptr || newFields == nullptr) {
             // UErrorCode is not available; fail silently.
-            uprv_free(newChars);
-            uprv_free(newFields);
+            freeMemory(newChars);
+            freeMemory(newFields);
             *this = FormattedStringBuilder();  // can't fail
             return *this;
         }
@@ -307,14 +307,14 @@ int32_t FormattedStringBuilder::prepareForInsertHelper(int32_t index, int32_t co
         int32_t newCapacity = newLength * 2;
         newZero = (newCapacity - newLength) / 2;
 
-        // C++ note: malloc appears in two places: here and in the assignment operator.
+        // C++ note: allocation appears in two places: here and in the assignment operator.
         auto* newChars =
-            static_cast<char16_t*>(uprv_malloc(sizeof(char16_t) * static_cast<size_t>(newCapacity)));
+            static_cast<char16_t*>(allocateMemory(sizeof(char16_t) * static_cast<size_t>(newCapacity)));
         auto* newFields =
-            static_cast<Field*>(uprv_malloc(sizeof(Field) * static_cast<size_t>(newCapacity)));
+            static_cast<Field*>(allocateMemory(sizeof(Field) * static_cast<size_t>(newCapacity)));
         if (newChars == nullptr || newFields == nullptr) {
-            uprv_free(newChars);
-            uprv_free(newFields);
+            freeMemory(newChars);
+            freeMemory(newFields);
             status = U_MEMORY_ALLOCATION_ERROR;
             return -1;
         }
@@ -332,8 +332,8 @@ int32_t FormattedStringBuilder::prepareForInsertHelper(int32_t index, int32_t co
                 sizeof(Field) * (fLength - index));
 
         if (fUsingHeap) {
-            uprv_free(oldChars);
-            uprv_free(oldFields);
+            freeMemory(oldChars);
+            freeMemory(oldFields);
         }
         fUsingHeap = true;
         fChars.heap.ptr = newChars;
@@ -378,6 +378,20 @@ int32_t FormattedStringBuilder::remove(int32_t index, int32_t count) {
     return position;
 }
 
+void *FormattedStringBuilder::allocateMemory(size_t size) {
+    if (fArena != nullptr) {
+        return size <= INT32_MAX ? fArena->allocate(static_cast<int32_t>(size)) : nullptr;
+    }
+    return uprv_malloc(size);
+}
+
+void FormattedStringBuilder::freeMemory(void *memory) {
+    // Arena memory is released all at once by FormattingArena::reset().
+    if (fArena == nullptr) {
+        uprv_free(memory);
+    }
+}
+
 UnicodeString FormattedStringBuilder::toUnicodeString() const {
     return UnicodeString(getCharPtr() + fZero, fLength);
 }
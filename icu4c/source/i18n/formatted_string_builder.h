@@ -18,6 +18,7 @@
 U_NAMESPACE_BEGIN
 
 class FormattedValueStringBuilderImpl;
+class FormattingArena;
 
 /**
  * A StringBuilder optimized for formatting. It implements the following key
@@ -181,8 +182,22 @@ class U_I18N_API FormattedStringBuilder : public UMemory {
 
     bool containsField(Field field) const;
 
+    /**
+     * Makes this builder take memory for its growing buffers from the arena rather than from the heap.
+     * Must be called while the builder is still empty. Copies do not inherit the arena.
+     */
+    void setArena(FormattingArena *arena) {
+        U_ASSERT(!fUsingHeap);
+        fArena = arena;
+    }
+
+    FormattingArena *getArena() const {
+        return fArena;
+    }
+
   private:
     bool fUsingHeap = false;
+    FormattingArena *fArena = nullptr;
     ValueOrHeapArray<char16_t> fChars;
     ValueOrHeapArray<Field> fFields;
     int32_t fZero = DEFAULT_CAPACITY / 2;
@@ -214,6 +229,10 @@ class U_I18N_API FormattedStringBuilder : public UMemory {
 
     int32_t remove(int32_t index, int32_t count);
 
+    void *allocateMemory(size_t size);
+
+    void freeMemory(void *memory);
+
     friend class FormattedValueStringBuilderImpl;
 };
 
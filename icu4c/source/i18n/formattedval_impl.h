@@ -13,6 +13,9 @@
 // Each implementation is defined in its own cpp file in order to split
 // dependencies more modularly.
 
+#include <type_traits>
+#include <utility>
+
 #include "unicode/formattedvalue.h"
 #include "capi_helper.h"
 #include "fphdlimp.h"
@@ -161,6 +164,17 @@ class U_I18N_API_CLASS FormattedValueStringBuilderImpl : public UMemory, public
     }
     void resetString();
 
+    /**
+     * Marks this object as created in the arena (see createFormattedValueData()),
+     * and makes its string take its memory from the arena as well.
+     */
+    inline void setArena(FormattingArena& arena) {
+        fString.setArena(&arena);
+    }
+    inline bool isInArena() const {
+        return fString.getArena() != nullptr;
+    }
+
     /**
      * Adds additional metadata used for span fields.
      *
@@ -186,6 +200,38 @@ class U_I18N_API_CLASS FormattedValueStringBuilderImpl : public UMemory, public
 };
 
 
+/**
+ * Creates the data object of a FormattedValue subclass in the arena,
+ * or returns nullptr if the arena is out of memory.
+ * The type must be a FormattedValueStringBuilderImpl.
+ */
+template<typename T, typename... Args>
+T* createFormattedValueData(FormattingArena& arena, Args&&... args) {
+    void* memory = arena.allocate(static_cast<int32_t>(sizeof(T)));
+    if (memory == nullptr) {
+        return nullptr;
+    }
+    T* data = new(memory) T(std::forward<Args>(args)...);
+    data->setArena(arena);
+    return data;
+}
+
+/**
+ * Deletes the data object of a FormattedValue subclass.
+ * An object in a FormattingArena is destroyed; its memory stays with the arena.
+ */
+template<typename T>
+void deleteFormattedValueData(const T* data) {
+    if constexpr (std::is_base_of_v<FormattedValueStringBuilderImpl, T>) {
+        if (data != nullptr && data->isInArena()) {
+            data->~T();
+            return;
+        }
+    }
+    delete data;
+}
+
+
 // C API Helpers for FormattedValue
 // Magic number as ASCII == "UFV"
 struct UFormattedValueImpl;
@@ -215,11 +261,11 @@ struct UFormattedValueImpl : public UMemory, public UFormattedValueApiHelper {
         src.fErrorCode = U_INVALID_STATE_ERROR; \
     } \
     Name::~Name() { \
-        delete fData; \
+        deleteFormattedValueData(fData); \
         fData = nullptr; \
     } \
     Name& Name::operator=(Name&& src) noexcept { \
-        delete fData; \
+        deleteFormattedValueData(fData); \
         fData = src.fData; \
         src.fData = nullptr; \
         fErrorCode = src.fErrorCode; \
@@ -5,9 +5,12 @@
 
 #if !UCONFIG_NO_FORMATTING
 
+#include <cstddef>
+
 #include "unicode/formattedvalue.h"
 #include "formattedval_impl.h"
 #include "capi_helper.h"
+#include "cmemory.h"
 
 U_NAMESPACE_BEGIN
 
@@ -68,6 +71,104 @@ void ConstrainedFieldPosition::setState(
 FormattedValue::~FormattedValue() = default;
 
 
+namespace {
+
+constexpr int32_t ARENA_ALIGNMENT = static_cast<int32_t>(alignof(std::max_align_t));
+
+/** Heap blocks are at least this large, so that small results share a block. */
+constexpr int32_t ARENA_MIN_BLOCK_SIZE = 4096;
+
+inline int32_t alignArenaSize(int32_t size) {
+    return (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+}
+
+}  // namespace
+
+/** Header of a heap block; the block's memory follows it. */
+struct FormattingArena::Block {
+    Block *next;
+    int32_t capacity;
+
+    static constexpr int32_t kHeaderSize = (sizeof(Block*) + sizeof(int32_t) + ARENA_ALIGNMENT - 1) &
+        ~(ARENA_ALIGNMENT - 1);
+
+    char *getMemory() {
+        return reinterpret_cast<char *>(this) + kHeaderSize;
+    }
+};
+
+FormattingArena::FormattingArena()
+        : fBuffer(nullptr), fBufferLimit(nullptr), fNext(nullptr), fLimit(nullptr) {}
+
+FormattingArena::FormattingArena(void *buffer, int32_t capacity)
+        : fBuffer(nullptr), fBufferLimit(nullptr), fNext(nullptr), fLimit(nullptr) {
+    if (buffer != nullptr && capacity > 0) {
+        // Start at the first aligned address in the buffer.
+        char *limit = static_cast<char *>(buffer) + capacity;
+        uintptr_t address = reinterpret_cast<uintptr_t>(buffer);
+        uintptr_t skip = (ARENA_ALIGNMENT - (address & (ARENA_ALIGNMENT - 1))) & (ARENA_ALIGNMENT - 1);
+        if (skip < static_cast<uintptr_t>(capacity)) {
+            fBuffer = static_cast<char *>(buffer) + skip;
+            fBufferLimit = limit;
+        }
+    }
+    reset();
+}
+
+FormattingArena::~FormattingArena() {
+    while (fBlocks != nullptr) {
+        Block *next = fBlocks->next;
+        uprv_free(fBlocks);
+        fBlocks = next;
+    }
+}
+
+void FormattingArena::reset() {
+    fCurrentBlock = nullptr;
+    fNext = fBuffer;
+    fLimit = fBufferLimit;
+}
+
+void *FormattingArena::allocate(int32_t size) {
+    if (size < 0 || size > INT32_MAX - ARENA_ALIGNMENT - Block::kHeaderSize) {
+        return nullptr;
+    }
+    size = alignArenaSize(size);
+    if (size <= fLimit - fNext) {
+        char *memory = fNext;
+        fNext += size;
+        return memory;
+    }
+    return allocateFromNextBlock(size);
+}
+
+void *FormattingArena::allocateFromNextBlock(int32_t size) {
+    // Continue with the next block that was kept from before the last reset(),
+    // or insert a new one if that is missing or too small.
+    Block *block = fCurrentBlock == nullptr ? fBlocks : fCurrentBlock->next;
+    if (block == nullptr || block->capacity < size) {
+        int32_t capacity = size > ARENA_MIN_BLOCK_SIZE ? size : ARENA_MIN_BLOCK_SIZE;
+        auto *newBlock = static_cast<Block *>(uprv_malloc(Block::kHeaderSize + capacity));
+        if (newBlock == nullptr) {
+            return nullptr;
+        }
+        newBlock->next = block;
+        newBlock->capacity = capacity;
+        if (fCurrentBlock == nullptr) {
+            fBlocks = newBlock;
+        } else {
+            fCurrentBlock->next = newBlock;
+        }
+        block = newBlock;
+    }
+    fCurrentBlock = block;
+    char *memory = block->getMemory();
+    fNext = memory + size;
+    fLimit = memory + block->capacity;
+    return memory;
+}
+
+
 ///////////////////////
 /// C API FUNCTIONS ///
 ///////////////////////
@@ -548,13 +548,26 @@ ListFormatter::~ListFormatter() {
 
 namespace {
 
+FormattedListData* createFormattedListData(FormattingArena* arena, UErrorCode& status) {
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    FormattedListData* data = arena != nullptr
+        ? createFormattedValueData<FormattedListData>(*arena, status)
+        : new FormattedListData(status);
+    if (data == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    return data;
+}
+
 class FormattedListBuilder {
 public:
-    LocalPointer<FormattedListData> data;
+    FormattedListData* data;
 
     /** For lists of length 1+ */
-    FormattedListBuilder(const UnicodeString& start, UErrorCode& status)
-            : data(new FormattedListData(status), status) {
+    FormattedListBuilder(const UnicodeString& start, FormattingArena* arena, UErrorCode& status)
+            : data(createFormattedListData(arena, status)) {
         if (U_SUCCESS(status)) {
             data->getStringRef().append(
                 start,
@@ -565,8 +578,18 @@ class FormattedListBuilder {
     }
 
     /** For lists of length 0 */
-    FormattedListBuilder(UErrorCode& status)
-            : data(new FormattedListData(status), status) {
+    FormattedListBuilder(FormattingArena* arena, UErrorCode& status)
+            : data(createFormattedListData(arena, status)) {
+    }
+
+    ~FormattedListBuilder() {
+        deleteFormattedValueData(data);
+    }
+
+    FormattedListData* orphan() {
+        FormattedListData* result = data;
+        data = nullptr;
+        return result;
     }
 
     void append(const SimpleFormatter& pattern, const UnicodeString& next, int32_t position, UErrorCode& status) {
@@ -664,23 +687,42 @@ FormattedList ListFormatter::formatStringsToValue(
         const UnicodeString items[],
         int32_t nItems,
         UErrorCode& errorCode) const {
+    return formatStringsToValue(items, nItems, nullptr, errorCode);
+}
+
+FormattedList ListFormatter::formatStringsToValue(
+        const UnicodeString items[],
+        int32_t nItems,
+        FormattingArena& arena,
+        UErrorCode& errorCode) const {
+    return formatStringsToValue(items, nItems, &arena, errorCode);
+}
+
+FormattedList ListFormatter::formatStringsToValue(
+        const UnicodeString items[],
+        int32_t nItems,
+        FormattingArena* arena,
+        UErrorCode& errorCode) const {
     if (nItems == 0) {
-        FormattedListBuilder result(errorCode);
+        FormattedListBuilder result(arena, errorCode);
         if (U_FAILURE(errorCode)) {
             return FormattedList(errorCode);
         } else {
-            return FormattedList(result.data.orphan());
+            return FormattedList(result.orphan());
         }
     } else if (nItems == 1) {
-        FormattedListBuilder result(items[0], errorCode);
+        FormattedListBuilder result(items[0], arena, errorCode);
+        if (U_FAILURE(errorCode)) {
+            return FormattedList(errorCode);
+        }
         result.data->getStringRef().writeTerminator(errorCode);
         if (U_FAILURE(errorCode)) {
             return FormattedList(errorCode);
         } else {
-            return FormattedList(result.data.orphan());
+            return FormattedList(result.orphan());
         }
     } else if (nItems == 2) {
-        FormattedListBuilder result(items[0], errorCode);
+        FormattedListBuilder result(items[0], arena, errorCode);
         if (U_FAILURE(errorCode)) {
             return FormattedList(errorCode);
         }
@@ -693,11 +735,11 @@ FormattedList ListFormatter::formatStringsToValue(
         if (U_FAILURE(errorCode)) {
             return FormattedList(errorCode);
         } else {
-            return FormattedList(result.data.orphan());
+            return FormattedList(result.orphan());
         }
     }
 
-    FormattedListBuilder result(items[0], errorCode);
+    FormattedListBuilder result(items[0], arena, errorCode);
     if (U_FAILURE(errorCode)) {
         return FormattedList(errorCode);
     }
@@ -722,7 +764,7 @@ FormattedList ListFormatter::formatStringsToValue(
     if (U_FAILURE(errorCode)) {
         return FormattedList(errorCode);
     } else {
-        return FormattedList(result.data.orphan());
+        return FormattedList(result.orphan());
     }
 }
 
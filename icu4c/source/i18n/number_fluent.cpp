@@ -16,6 +16,7 @@
 #include "number_mapper.h"
 #include "util.h"
 #include "fphdlimp.h"
+#include "unifiedcache.h"
 
 using namespace icu;
 using namespace icu::number;
@@ -460,8 +461,11 @@ UnlocalizedNumberFormatter& UnlocalizedNumberFormatter::operator=(UNF&& src) noe
 }
 
 // Make default copy constructor call the NumberFormatterSettings copy constructor.
+// Unlike that one, which the fluent setters use, it shares a compiled formatter from compile().
 LocalizedNumberFormatter::LocalizedNumberFormatter(const LNF& other)
-        : LNF(static_cast<const NFS<LNF>&>(other)) {}
+        : LNF(static_cast<const NFS<LNF>&>(other)) {
+    shareCompiled(other);
+}
 
 LocalizedNumberFormatter::LocalizedNumberFormatter(const NFS<LNF>& other)
         : NFS<LNF>(other) {
@@ -470,11 +474,17 @@ LocalizedNumberFormatter::LocalizedNumberFormatter(const NFS<LNF>& other)
 }
 
 LocalizedNumberFormatter::LocalizedNumberFormatter(LocalizedNumberFormatter&& src) noexcept
-        : LNF(static_cast<NFS<LNF>&&>(src)) {}
+        : NFS<LNF>(static_cast<NFS<LNF>&&>(src)) {
+    lnfMoveHelper(std::move(src));
+}
 
 LocalizedNumberFormatter::LocalizedNumberFormatter(NFS<LNF>&& src) noexcept
         : NFS<LNF>(std::move(src)) {
     lnfMoveHelper(std::move(static_cast<LNF&&>(src)));
+    // The fluent setters use this constructor and then change a setting,
+    // which the compiled formatter would not reflect.
+    SharedObject::clearPtr(fCompiled);
+    resetCompiled();
 }
 
 LocalizedNumberFormatter& LocalizedNumberFormatter::operator=(const LNF& other) {
@@ -482,6 +492,7 @@ LocalizedNumberFormatter& LocalizedNumberFormatter::operator=(const LNF& other)
     NFS<LNF>::operator=(static_cast<const NFS<LNF>&>(other));
     UErrorCode localStatus = U_ZERO_ERROR; // Can't bubble up the error
     lnfCopyHelper(other, localStatus);
+    shareCompiled(other);
     return *this;
 }
 
@@ -495,17 +506,19 @@ void LocalizedNumberFormatter::resetCompiled() {
     auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
     umtx_storeRelease(*callCount, 0);
     fCompiled = nullptr;
+    fShareCompiled = false;
 }
 
 void LocalizedNumberFormatter::lnfMoveHelper(LNF&& src) {
     // Copy over the compiled formatter and set call count to INT32_MIN as in computeCompiled().
     // Don't copy the call count directly because doing so requires a loadAcquire/storeRelease.
     // The bits themselves appear to be platform-dependent, so copying them might not be safe.
-    delete fCompiled;
+    SharedObject::clearPtr(fCompiled);
     if (src.fCompiled != nullptr) {
         auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
         umtx_storeRelease(*callCount, INT32_MIN);
         fCompiled = src.fCompiled;
+        fShareCompiled = src.fShareCompiled;
         // Reset the source object to leave it in a safe state.
         src.resetCompiled();
     } else {
@@ -519,8 +532,8 @@ void LocalizedNumberFormatter::lnfMoveHelper(LNF&& src) {
 }
 
 void LocalizedNumberFormatter::lnfCopyHelper(const LNF&, UErrorCode& status) {
-    // When copying, always reset the compiled formatter.
-    delete fCompiled;
+    // When copying, reset the compiled formatter; see shareCompiled().
+    SharedObject::clearPtr(fCompiled);
     resetCompiled();
 
     // If MacroProps has a reference to AffixPatternProvider, we need to copy it.
@@ -547,9 +560,136 @@ void LocalizedNumberFormatter::lnfCopyHelper(const LNF&, UErrorCode& status) {
     }
 }
 
+void LocalizedNumberFormatter::shareCompiled(const LNF& src) {
+    if (src.fShareCompiled) {
+        src.fCompiled->addRef();
+        adoptSharedCompiled(src.fCompiled);
+    }
+}
+
+void LocalizedNumberFormatter::adoptSharedCompiled(const SharedNumberFormatterImpl* compiled) {
+    SharedObject::clearPtr(fCompiled);
+    fCompiled = compiled;
+    fShareCompiled = true;
+    auto* callCount = reinterpret_cast<u_atomic_int32_t*>(fUnsafeCallCount);
+    umtx_storeRelease(*callCount, INT32_MIN);
+}
+
+void LocalizedNumberFormatter::compileInPlace(UErrorCode& status) {
+    if (U_FAILURE(status) || fShareCompiled) {
+        return;
+    }
+    // The compiled formatter refers to the affix provider and plural rules
+    // in the MacroProps, which belong to this formatter.
+    bool share = fMacros.affixProvider == nullptr && fMacros.rules == nullptr;
+    if (fCompiled == nullptr) {
+        LocalPointer<SharedNumberFormatterImpl> compiled(
+            new SharedNumberFormatterImpl(fMacros, status), status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        compiled->addRef();
+        adoptSharedCompiled(compiled.orphan());
+    }
+    fShareCompiled = share;
+}
+
+LocalizedNumberFormatter LocalizedNumberFormatter::compile(UErrorCode& status) const& {
+    LocalizedNumberFormatter copy(*this);
+    copy.compileInPlace(status);
+    return copy;
+}
+
+LocalizedNumberFormatter LocalizedNumberFormatter::compile(UErrorCode& status)&& {
+    LocalizedNumberFormatter move(std::move(*this));
+    move.compileInPlace(status);
+    return move;
+}
+
+
+U_NAMESPACE_BEGIN
+
+template<>
+const SharedNumberFormatterImpl* LocaleCacheKey<SharedNumberFormatterImpl>::createObject(
+        const void* /*creationContext*/, UErrorCode& status) const {
+    status = U_UNSUPPORTED_ERROR;
+    return nullptr;
+}
+
+U_NAMESPACE_END
+
+namespace {
+
+/**
+ * Cache key for NumberFormatter::compiledForSkeleton().
+ * The creation context is the MacroProps parsed from the skeleton.
+ */
+class NumberSkeletonCacheKey : public LocaleCacheKey<SharedNumberFormatterImpl> {
+  public:
+    NumberSkeletonCacheKey(const Locale& locale, const UnicodeString& skeleton)
+            : LocaleCacheKey<SharedNumberFormatterImpl>(locale), fSkeleton(skeleton) {}
+
+    NumberSkeletonCacheKey(const NumberSkeletonCacheKey& other) = default;
+
+    ~NumberSkeletonCacheKey() override;
+
+    int32_t hashCode() const override {
+        return static_cast<int32_t>(
+            37u * static_cast<uint32_t>(LocaleCacheKey<SharedNumberFormatterImpl>::hashCode()) +
+            static_cast<uint32_t>(fSkeleton.hashCode()));
+    }
+
+    CacheKeyBase* clone() const override {
+        return new NumberSkeletonCacheKey(*this);
+    }
+
+    const SharedNumberFormatterImpl* createObject(
+            const void* creationContext, UErrorCode& status) const override {
+        LocalPointer<SharedNumberFormatterImpl> compiled(
+            new SharedNumberFormatterImpl(*static_cast<const MacroProps*>(creationContext), status),
+            status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        compiled->addRef();
+        return compiled.orphan();
+    }
+
+  protected:
+    bool equals(const CacheKeyBase& other) const override {
+        if (!LocaleCacheKey<SharedNumberFormatterImpl>::equals(other)) {
+            return false;
+        }
+        // We know that this and other are of the same class if we get this far.
+        return fSkeleton == static_cast<const NumberSkeletonCacheKey&>(other).fSkeleton;
+    }
+
+  private:
+    UnicodeString fSkeleton;
+};
+
+NumberSkeletonCacheKey::~NumberSkeletonCacheKey() = default;
+
+}  // namespace
+
+void LocalizedNumberFormatter::compileForSkeleton(const UnicodeString& skeleton, UErrorCode& status) {
+    const UnifiedCache* cache = UnifiedCache::getInstance(status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    const SharedNumberFormatterImpl* compiled = nullptr;
+    NumberSkeletonCacheKey key(fMacros.locale, skeleton);
+    cache->get(key, &fMacros, compiled, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    // A skeleton does not set an affix provider or plural rules, so the compiled formatter can be shared.
+    U_ASSERT(fMacros.affixProvider == nullptr && fMacros.rules == nullptr);
+    adoptSharedCompiled(compiled);
+}
 
 LocalizedNumberFormatter::~LocalizedNumberFormatter() {
-    delete fCompiled;
+    SharedObject::clearPtr(fCompiled);
     delete fWarehouse;
 }
 
@@ -628,6 +768,129 @@ FormattedNumber LocalizedNumberFormatter::formatDecimal(StringPiece value, UErro
     }
 }
 
+FormattedNumber LocalizedNumberFormatter::formatInt(int64_t value, FormattingArena& arena,
+                                                    UErrorCode& status) const {
+    if (U_FAILURE(status)) { return FormattedNumber(U_ILLEGAL_ARGUMENT_ERROR); }
+    auto* results = createFormattedValueData<UFormattedNumberData>(arena);
+    if (results == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return FormattedNumber(status);
+    }
+    results->quantity.setToLong(value);
+    formatImpl(results, status);
+
+    // Do not save the results object if we encountered a failure.
+    if (U_SUCCESS(status)) {
+        return FormattedNumber(results);
+    } else {
+        deleteFormattedValueData(results);
+        return FormattedNumber(status);
+    }
+}
+
+FormattedNumber LocalizedNumberFormatter::formatDouble(double value, FormattingArena& arena,
+                                                       UErrorCode& status) const {
+    if (U_FAILURE(status)) { return FormattedNumber(U_ILLEGAL_ARGUMENT_ERROR); }
+    auto* results = createFormattedValueData<UFormattedNumberData>(arena);
+    if (results == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return FormattedNumber(status);
+    }
+    results->quantity.setToDouble(value);
+    formatImpl(results, status);
+
+    // Do not save the results object if we encountered a failure.
+    if (U_SUCCESS(status)) {
+        return FormattedNumber(results);
+    } else {
+        deleteFormattedValueData(results);
+        return FormattedNumber(status);
+    }
+}
+
+FormattedNumber LocalizedNumberFormatter::formatDecimal(StringPiece value, FormattingArena& arena,
+                                                        UErrorCode& status) const {
+    if (U_FAILURE(status)) { return FormattedNumber(U_ILLEGAL_ARGUMENT_ERROR); }
+    auto* results = createFormattedValueData<UFormattedNumberData>(arena);
+    if (results == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return FormattedNumber(status);
+    }
+    results->quantity.setToDecNumber(value, status);
+    formatImpl(results, status);
+
+    // Do not save the results object if we encountered a failure.
+    if (U_SUCCESS(status)) {
+        return FormattedNumber(results);
+    } else {
+        deleteFormattedValueData(results);
+        return FormattedNumber(status);
+    }
+}
+
+UnicodeString& LocalizedNumberFormatter::formatInts(const int64_t* values, int32_t count,
+                                                   UnicodeString& appendTo, int32_t* offsets,
+                                                   FieldPositionIterator* posIter,
+                                                   UErrorCode& status) const {
+    return formatBatch(values, nullptr, count, appendTo, offsets, posIter, status);
+}
+
+UnicodeString& LocalizedNumberFormatter::formatDoubles(const double* values, int32_t count,
+                                                      UnicodeString& appendTo, int32_t* offsets,
+                                                      FieldPositionIterator* posIter,
+                                                      UErrorCode& status) const {
+    return formatBatch(nullptr, values, count, appendTo, offsets, posIter, status);
+}
+
+UnicodeString& LocalizedNumberFormatter::formatBatch(const int64_t* ints, const double* doubles,
+                                                    int32_t count, UnicodeString& appendTo,
+                                                    int32_t* offsets, FieldPositionIterator* posIter,
+                                                    UErrorCode& status) const {
+    if (U_FAILURE(status)) { return appendTo; }
+    if (count < 0 || (count > 0 && ints == nullptr && doubles == nullptr)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return appendTo;
+    }
+
+    // Format all values with a compiled formatter, even if this formatter
+    // has not been called often enough yet to keep one of its own.
+    LocalPointer<const NumberFormatterImpl> batchCompiled;
+    const NumberFormatterImpl* compiled;
+    if (computeCompiled(status)) {
+        compiled = &fCompiled->get();
+    } else {
+        batchCompiled.adoptInsteadAndCheckErrorCode(new NumberFormatterImpl(fMacros, status), status);
+        compiled = batchCompiled.getAlias();
+    }
+    if (U_FAILURE(status)) { return appendTo; }
+
+    // One results object serves all values.
+    UFormattedNumberData results;
+    FieldPositionIteratorHandler fpih(posIter, status);
+    if (offsets != nullptr) {
+        offsets[0] = appendTo.length();
+    }
+    for (int32_t i = 0; i < count; i++) {
+        results.resetString();
+        if (ints != nullptr) {
+            results.quantity.setToLong(ints[i]);
+        } else {
+            results.quantity.setToDouble(doubles[i]);
+        }
+        compiled->format(&results, status);
+        if (U_FAILURE(status)) { break; }
+        if (posIter != nullptr) {
+            fpih.setShift(appendTo.length());
+            results.getAllFieldPositions(fpih, status);
+        }
+        appendTo.append(results.getStringRef().toTempUnicodeString());
+        if (offsets != nullptr) {
+            offsets[i + 1] = appendTo.length();
+        }
+    }
+    return appendTo;
+}
+
 FormattedNumber
 LocalizedNumberFormatter::formatDecimalQuantity(const DecimalQuantity& dq, UErrorCode& status) const {
     if (U_FAILURE(status)) { return FormattedNumber(U_ILLEGAL_ARGUMENT_ERROR); }
@@ -650,7 +913,7 @@ LocalizedNumberFormatter::formatDecimalQuantity(const DecimalQuantity& dq, UErro
 
 void LocalizedNumberFormatter::formatImpl(impl::UFormattedNumberData* results, UErrorCode& status) const {
     if (computeCompiled(status)) {
-        fCompiled->format(results, status);
+        fCompiled->get().format(results, status);
     } else {
         NumberFormatterImpl::formatStatic(fMacros, results, status);
     }
@@ -668,7 +931,7 @@ void LocalizedNumberFormatter::getAffixImpl(bool isPrefix, bool isNegative, Unic
     static const StandardPlural::Form plural = StandardPlural::OTHER;
     int32_t prefixLength;
     if (computeCompiled(status)) {
-        prefixLength = fCompiled->getPrefixSuffix(signum, plural, string, status);
+        prefixLength = fCompiled->get().getPrefixSuffix(signum, plural, string, status);
     } else {
         prefixLength = NumberFormatterImpl::getPrefixSuffixStatic(fMacros, signum, plural, string, status);
     }
@@ -703,11 +966,12 @@ bool LocalizedNumberFormatter::computeCompiled(UErrorCode& status) const {
 
     if (currentCount == fMacros.threshold && fMacros.threshold > 0) {
         // Build the data structure and then use it (slow to fast path).
-        const NumberFormatterImpl* compiled = new NumberFormatterImpl(fMacros, status);
+        const SharedNumberFormatterImpl* compiled = new SharedNumberFormatterImpl(fMacros, status);
         if (compiled == nullptr) {
             status = U_MEMORY_ALLOCATION_ERROR;
             return false;
         }
+        compiled->addRef();
         U_ASSERT(fCompiled == nullptr);
         const_cast<LocalizedNumberFormatter*>(this)->fCompiled = compiled;
         umtx_storeRelease(*callCount, INT32_MIN);
@@ -723,7 +987,7 @@ bool LocalizedNumberFormatter::computeCompiled(UErrorCode& status) const {
 }
 
 const impl::NumberFormatterImpl* LocalizedNumberFormatter::getCompiled() const {
-    return fCompiled;
+    return fCompiled == nullptr ? nullptr : &fCompiled->get();
 }
 
 int32_t LocalizedNumberFormatter::getCallCount() const {
@@ -118,6 +118,12 @@ NumberFormatterImpl::NumberFormatterImpl(const MacroProps& macros, bool safe, UE
     fMicroPropsGenerator = macrosToMicroGenerator(macros, safe, status);
 }
 
+SharedNumberFormatterImpl::SharedNumberFormatterImpl(const MacroProps& macros, UErrorCode& status)
+        : fMacros(macros), fImpl(fMacros, status) {
+}
+
+SharedNumberFormatterImpl::~SharedNumberFormatterImpl() = default;
+
 //////////
 
 const MicroPropsGenerator*
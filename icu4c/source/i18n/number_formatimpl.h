@@ -17,6 +17,7 @@
 #include "number_compact.h"
 #include "number_microprops.h"
 #include "number_utypes.h"
+#include "sharedobject.h"
 
 U_NAMESPACE_BEGIN
 namespace number::impl {
@@ -170,6 +171,30 @@ class NumberFormatterImpl : public UMemory {
         UErrorCode &status);
 };
 
+/**
+ * A thread-safe NumberFormatterImpl together with its own copy of the MacroProps it was built from,
+ * which the NumberFormatterImpl refers to. This makes it independent of any LocalizedNumberFormatter,
+ * so that formatters can share it by reference counting, and the UnifiedCache can hold it.
+ *
+ * If the MacroProps have an affixProvider or rules, then the NumberFormatterImpl refers to objects
+ * owned by the LocalizedNumberFormatter that created it, and it must not be shared.
+ */
+class SharedNumberFormatterImpl : public SharedObject {
+  public:
+    SharedNumberFormatterImpl(const MacroProps &macros, UErrorCode &status);
+
+    ~SharedNumberFormatterImpl() override;
+
+    const NumberFormatterImpl &get() const {
+        return fImpl;
+    }
+
+  private:
+    // Must be initialized before fImpl.
+    const MacroProps fMacros;
+    const NumberFormatterImpl fImpl;
+};
+
 } // namespace number::impl
 U_NAMESPACE_END
 
@@ -1812,6 +1812,16 @@ NumberFormatter::forSkeleton(const UnicodeString& skeleton, UParseError& perror,
     return skeleton::create(skeleton, &perror, status);
 }
 
+LocalizedNumberFormatter
+NumberFormatter::compiledForSkeleton(const UnicodeString& skeleton, const Locale& locale,
+                                     UErrorCode& status) {
+    LocalizedNumberFormatter result = forSkeleton(skeleton, status).locale(locale);
+    if (U_SUCCESS(status)) {
+        result.compileForSkeleton(skeleton, status);
+    }
+    return result;
+}
+
 #if (U_PF_WINDOWS <= U_PLATFORM && U_PLATFORM <= U_PF_CYGWIN) && defined(_MSC_VER)
 // Warning 4661.
 #pragma warning(pop)
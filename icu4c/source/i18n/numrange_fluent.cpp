@@ -338,6 +338,36 @@ FormattedNumberRange LocalizedNumberRangeFormatter::formatFormattableRange(
     }
 }
 
+FormattedNumberRange LocalizedNumberRangeFormatter::formatFormattableRange(
+        const Formattable& first, const Formattable& second, FormattingArena& arena,
+        UErrorCode& status) const {
+    if (U_FAILURE(status)) {
+        return FormattedNumberRange(U_ILLEGAL_ARGUMENT_ERROR);
+    }
+
+    auto* results = createFormattedValueData<UFormattedNumberRangeData>(arena);
+    if (results == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return FormattedNumberRange(status);
+    }
+
+    first.populateDecimalQuantity(results->quantity1, status);
+    if (U_SUCCESS(status)) {
+        second.populateDecimalQuantity(results->quantity2, status);
+    }
+    if (U_SUCCESS(status)) {
+        formatImpl(*results, first == second, status);
+    }
+
+    // Do not save the results object if we encountered a failure.
+    if (U_SUCCESS(status)) {
+        return FormattedNumberRange(results);
+    } else {
+        deleteFormattedValueData(results);
+        return FormattedNumberRange(status);
+    }
+}
+
 void LocalizedNumberRangeFormatter::formatImpl(
         UFormattedNumberRangeData& results, bool equalBeforeRounding, UErrorCode& status) const {
     const auto* impl = getFormatter(status);
@@ -296,6 +296,7 @@ OlsonTimeZone& OlsonTimeZone::operator=(const OlsonTimeZone& other) {
     finalStartMillis = other.finalStartMillis;
 
     clearTransitionRules();
+    umtx_storeRelease(lastTransitionIdx, -1);
 
     return *this;
 }
@@ -470,6 +471,22 @@ OlsonTimeZone::transitionTimeInSeconds(int16_t transIdx) const {
 // quick zone transition checking.
 #define MAX_OFFSET_SECONDS 86400
 
+int16_t
+OlsonTimeZone::findTransition(double sec) const {
+    // Binary search for the first transition after sec.
+    int16_t start = 0;
+    int16_t limit = transitionCount();
+    while (start < limit) {
+        int16_t mid = static_cast<int16_t>((start + limit) / 2);
+        if (sec >= transitionTimeInSeconds(mid)) {
+            start = mid + 1;
+        } else {
+            limit = mid;
+        }
+    }
+    return start - 1;
+}
+
 void
 OlsonTimeZone::getHistoricalOffset(UDate date, UBool local,
                                    int32_t NonExistingTimeOpt, int32_t DuplicatedTimeOpt,
@@ -488,10 +505,23 @@ OlsonTimeZone::getHistoricalOffset(UDate date, UBool local,
             rawoff = initialRawOffset() * U_MILLIS_PER_SECOND;
             dstoff = initialDstOffset() * U_MILLIS_PER_SECOND;
         } else {
-            // Linear search from the end is the fastest approach, since
-            // most lookups will happen at/near the end.
+            // Start from the last transition that can apply to sec: For a UTC time,
+            // that is the last one at or before sec. A local time can be
+            // at most MAX_OFFSET_SECONDS before the UTC time of its transition.
             int16_t transIdx;
-            for (transIdx = transCount - 1; transIdx >= 0; transIdx--) {
+            if (local) {
+                transIdx = findTransition(sec + MAX_OFFSET_SECONDS);
+            } else {
+                transIdx = static_cast<int16_t>(umtx_loadAcquire(lastTransitionIdx));
+                if (!(0 <= transIdx && transIdx < transCount &&
+                        sec >= transitionTimeInSeconds(transIdx) &&
+                        (transIdx + 1 == transCount || sec < transitionTimeInSeconds(transIdx + 1)))) {
+                    transIdx = findTransition(sec);
+                    umtx_storeRelease(lastTransitionIdx, transIdx);
+                }
+            }
+            // Search backwards from there, adjusting each transition for local time.
+            for (; transIdx >= 0; transIdx--) {
                 int64_t transition = transitionTimeInSeconds(transIdx);
 
                 if (local && (sec >= (transition - MAX_OFFSET_SECONDS))) {
@@ -304,6 +304,12 @@ class U_I18N_API_CLASS OlsonTimeZone : public BasicTimeZone {
     int64_t transitionTimeInSeconds(int16_t transIdx) const;
     double transitionTime(int16_t transIdx) const;
 
+    /*
+     * Returns the index of the last transition at or before the given time
+     * in seconds, or -1 if the time is before the first transition.
+     */
+    int16_t findTransition(double sec) const;
+
     /*
      * Following 3 methods return an offset at the given transition time index.
      * When the index is negative, return the initial offset.
@@ -401,6 +407,12 @@ class U_I18N_API_CLASS OlsonTimeZone : public BasicTimeZone {
     int16_t             historicRuleCount;
     SimpleTimeZone      *finalZoneWithStartYear; // hack
     UInitOnce           transitionRulesInitOnce {};
+
+    /*
+     * Index of the transition that getHistoricalOffset() last found for a UTC time,
+     * or -1. Consecutive times usually fall into the same transition interval.
+     */
+    mutable u_atomic_int32_t lastTransitionIdx {-1};
 };
 
 inline int16_t
@@ -228,6 +228,38 @@ int16_t TransliterationRule::getIndexValue() const {
     return static_cast<int16_t>(data->lookupMatcher(c) == nullptr ? (c & 0xFF) : -1);
 }
 
+/**
+ * Internal method.  Returns the leading code units of the key that
+ * must match the text literally.  StringMatcher::matches() compares
+ * literal key characters one code unit at a time, so any of these
+ * units that differs from the text before pos.limit is a mismatch.
+ */
+int32_t TransliterationRule::getLiteralKeyPrefix(char16_t* dest, int32_t capacity) const {
+    int32_t length = 0;
+    while (length < keyLength && length < capacity) {
+        char16_t c = pattern.charAt(anteContextLength + length);
+        if (data->lookupMatcher(c) != nullptr) {
+            break;
+        }
+        dest[length++] = c;
+    }
+    return length;
+}
+
+/**
+ * Internal method.  Returns the set that the key starts with, if it
+ * starts with a set that contains no strings.  UnicodeSet::matches()
+ * then matches exactly the code points that the set contains.
+ */
+const UnicodeSet* TransliterationRule::getFirstKeySet() const {
+    if (keyLength == 0) {
+        return nullptr;
+    }
+    const UnicodeSet* set =
+        dynamic_cast<const UnicodeSet*>(data->lookupMatcher(pattern.charAt(anteContextLength)));
+    return (set != nullptr && !set->hasStrings()) ? set : nullptr;
+}
+
 /**
  * Internal method.  Returns true if this rule matches the given
  * index value.  The index value is an 8-bit integer, 0..255,
@@ -25,6 +25,7 @@ class Replaceable;
 class TransliterationRuleData;
 class StringMatcher;
 class UnicodeFunctor;
+class UnicodeSet;
 
 /**
  * A transliteration rule used by
@@ -242,6 +243,29 @@ class TransliterationRule : public UMemory {
      */
     UBool matchesIndexValue(uint8_t v) const;
 
+    /**
+     * Internal method.  Returns the leading code units of the key
+     * that must match the text literally, stopping at the first
+     * set or other matcher, at the end of the key, or at capacity.
+     * If one of these units differs from the text at the same offset
+     * from pos.start, and that offset is before pos.limit, then
+     * matchAndReplace() returns U_MISMATCH.
+     * @param dest      receives the literal code units.
+     * @param capacity  the maximum number of units to return.
+     * @return          the number of units written to dest.
+     */
+    int32_t getLiteralKeyPrefix(char16_t* dest, int32_t capacity) const;
+
+    /**
+     * Internal method.  Returns the set that the key starts with, if
+     * it starts with a set that contains no strings, otherwise nullptr.
+     * If pos.start is before pos.limit and the set does not contain
+     * the code point at pos.start, then matchAndReplace() returns
+     * U_MISMATCH.
+     * @return    the first set of the key, or nullptr.
+     */
+    const UnicodeSet* getFirstKeySet() const;
+
     /**
      * Return true if this rule masks another rule.  If r1 masks r2 then
      * r1 matches any input string that r2 matches.  If r1 masks r2 and r2 masks
@@ -164,7 +164,7 @@ U_NAMESPACE_BEGIN
  * Construct a new empty rule set.
  */
 TransliterationRuleSet::TransliterationRuleSet(UErrorCode& status) :
-        UMemory(), ruleVector(nullptr), rules(nullptr), index {}, maxContextLength(0) {
+        UMemory(), ruleVector(nullptr), rules(nullptr), index {}, keyPrefixes(nullptr), maxContextLength(0) {
     LocalPointer<UVector> lpRuleVector(new UVector(_deleteRule, nullptr, status), status);
     if (U_FAILURE(status)) {
         return;
@@ -179,6 +179,7 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
     UMemory(other),
     ruleVector(nullptr),
     rules(nullptr),
+    keyPrefixes(nullptr),
     maxContextLength(other.maxContextLength) {
 
     int32_t i, len;
@@ -209,6 +210,7 @@ TransliterationRuleSet::TransliterationRuleSet(const TransliterationRuleSet& oth
 TransliterationRuleSet::~TransliterationRuleSet() {
     delete ruleVector; // This deletes the contained rules
     uprv_free(rules);
+    uprv_free(keyPrefixes);
 }
 
 void TransliterationRuleSet::setData(const TransliterationRuleData* d) {
@@ -219,6 +221,10 @@ void TransliterationRuleSet::setData(const TransliterationRuleData* d) {
     for (int32_t i=0; i<len; ++i) {
         rules[i]->setData(d);
     }
+    // The first sets belong to the data object.
+    if (keyPrefixes != nullptr) {
+        setKeyPrefixes();
+    }
 }
 
 /**
@@ -254,6 +260,8 @@ void TransliterationRuleSet::addRule(TransliterationRule* adoptedRule,
 
     uprv_free(rules);
     rules = nullptr;
+    uprv_free(keyPrefixes);
+    keyPrefixes = nullptr;
 }
 
 /**
@@ -333,6 +341,8 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
     /* Freeze things into an array.
      */
     uprv_free(rules); // Contains alias pointers
+    uprv_free(keyPrefixes);
+    keyPrefixes = nullptr;
 
     /* You can't do malloc(0)! */
     if (v.size() == 0) {
@@ -349,6 +359,19 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
         rules[j] = static_cast<TransliterationRule*>(v.elementAt(j));
     }
 
+    /* Extract the key prefixes.  A rule may be stored in several
+     * bins, but its prefix is cheap to compute, so we simply do it
+     * for each entry.
+     */
+    keyPrefixes = static_cast<KeyPrefix*>(uprv_malloc(v.size() * sizeof(KeyPrefix)));
+    if (keyPrefixes == nullptr) {
+        uprv_free(rules);
+        rules = nullptr;
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    setKeyPrefixes();
+
     // TODO Add error reporting that indicates the rules that
     //      are being masked.
     //UnicodeString errors;
@@ -385,6 +408,21 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
     //}
 }
 
+void TransliterationRuleSet::setKeyPrefixes() {
+    int32_t len = index[256];
+    for (int32_t i=0; i<len; ++i) {
+        char16_t units[4];
+        int32_t length = rules[i]->getLiteralKeyPrefix(units, UPRV_LENGTHOF(units));
+        KeyPrefix& prefix = keyPrefixes[i];
+        prefix.units = prefix.mask = 0;
+        for (int32_t k=0; k<length; ++k) {
+            prefix.units |= static_cast<uint64_t>(units[k]) << (16 * k);
+            prefix.mask |= static_cast<uint64_t>(0xffff) << (16 * k);
+        }
+        prefix.firstSet = length == 0 ? rules[i]->getFirstKeySet() : nullptr;
+    }
+}
+
 /**
  * Transliterate the given text with the given UTransPosition
  * indices.  Return true if the transliteration should continue
@@ -401,8 +439,27 @@ void TransliterationRuleSet::freeze(UParseError& parseError,UErrorCode& status)
 UBool TransliterationRuleSet::transliterate(Replaceable& text,
                                             UTransPosition& pos,
                                             UBool incremental) {
-    int16_t indexByte = static_cast<int16_t>(text.char32At(pos.start) & 0xFF);
-    for (int32_t i=index[indexByte]; i<index[indexByte+1]; ++i) {
+    UChar32 c = text.char32At(pos.start);
+    int16_t indexByte = static_cast<int16_t>(c & 0xFF);
+    int32_t i = index[indexByte];
+    int32_t binLimit = index[indexByte+1];
+
+    // Pack the text units before pos.limit like the key prefixes.
+    // A rule whose key prefix differs from them, or whose first set
+    // does not contain c, would only return U_MISMATCH, so we skip it.
+    uint64_t textUnits = 0;
+    uint64_t textMask = 0;
+    int32_t textLength = i < binLimit ? uprv_min(pos.limit - pos.start, 4) : 0;
+    for (int32_t k=0; k<textLength; ++k) {
+        textUnits |= static_cast<uint64_t>(text.charAt(pos.start + k)) << (16 * k);
+        textMask |= static_cast<uint64_t>(0xffff) << (16 * k);
+    }
+    for (; i<binLimit; ++i) {
+        const KeyPrefix& prefix = keyPrefixes[i];
+        if (((textUnits ^ prefix.units) & prefix.mask & textMask) != 0 ||
+                (prefix.firstSet != nullptr && !prefix.firstSet->contains(c))) {
+            continue;
+        }
         UMatchDegree m = rules[i]->matchAndReplace(text, pos, incremental);
         switch (m) {
         case U_MATCH:
@@ -416,7 +473,7 @@ UBool TransliterationRuleSet::transliterate(Replaceable& text,
         }
     }
     // No match or partial match from any rule
-    pos.start += U16_LENGTH(text.char32At(pos.start));
+    pos.start += U16_LENGTH(c);
     _debugOut("no match", nullptr, text, pos);
     return true;
 }
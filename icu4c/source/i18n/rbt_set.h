@@ -58,6 +58,21 @@ class TransliterationRuleSet : public UMemory {
      */
     int32_t index[257];
 
+    /**
+     * What the text at pos.start must look like for each rule in
+     * rules[] to match: up to four leading literal code units of the
+     * key, packed 16 bits each starting at the low end, with a mask
+     * covering them, or else the set that the key starts with.
+     * transliterate() checks these to skip rules without calling them.
+     * Parallel to rules[] and created by freeze().
+     */
+    struct KeyPrefix {
+        uint64_t units;
+        uint64_t mask;
+        const UnicodeSet* firstSet;
+    };
+    KeyPrefix* keyPrefixes;
+
     /**
      * Length of the longest preceding context
      */
@@ -157,6 +172,11 @@ class TransliterationRuleSet : public UMemory {
 
 private:
 
+    /**
+     * Fill in keyPrefixes[] from rules[].
+     */
+    void setKeyPrefixes();
+
     TransliterationRuleSet &operator=(const TransliterationRuleSet &other); // forbid copying of this class
 };
 
@@ -0,0 +1,303 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  refindall.cpp
+//
+//         Contains the implementation of RegexPattern::findAll(),
+//         which searches chunks of the input on several threads
+//         and merges their matches in order.
+//
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include <algorithm>
+
+#include "unicode/localpointer.h"
+#include "unicode/regex.h"
+#include "unicode/utext.h"
+#include "cmemory.h"
+#include "regextxt.h"
+#include "ustr_imp.h"
+#include "uthreadpool.h"
+#include "uvectr64.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+/**
+ * Chunks shorter than this, in native units, are not worth a thread of their own:
+ * Thread startup and the per-chunk matcher would cost more than searching them.
+ */
+constexpr int64_t MIN_CHUNK_LENGTH = 0x10000;
+
+/**
+ * One range of the input, in which the matches start that are found by this chunk.
+ * The matcher's region extends to regionLimit so that those matches are found in full.
+ */
+struct FindChunk : public UMemory {
+    int64_t start = 0;
+    int64_t limit = 0;
+    int64_t regionLimit = 0;
+    LocalPointer<RegexMatcher> matcher;
+    LocalPointer<UVector64> matches;  // Pairs of match start and limit.
+    UErrorCode errorCode = U_ZERO_ERROR;
+};
+
+/**
+ * Returns how far the matches that start in a chunk can extend beyond it,
+ * in native units of the input, or -1 if there is no known bound.
+ */
+int64_t getChunkOverlap(UText *input, int64_t maxMatchLength,
+                        int32_t patternMaxMatchLength, UBool usesBackslashG) {
+    if (usesBackslashG) {
+        // \G depends on where the previous match ended,
+        // which is not known at the start of a chunk.
+        return -1;
+    }
+    if (maxMatchLength >= 0) {
+        return maxMatchLength;
+    }
+    if (patternMaxMatchLength == INT32_MAX) {
+        return -1;
+    }
+    if (UTEXT_USES_U16(input)) {
+        return patternMaxMatchLength;
+    }
+    int32_t length;
+    if (utext_getUTF8Contents(input, &length) != nullptr) {
+        // Each UTF-16 code unit corresponds to at most 3 UTF-8 bytes.
+        return static_cast<int64_t>(patternMaxMatchLength) * 3;
+    }
+    return -1;
+}
+
+/** Returns the code point boundary at or before index. */
+int64_t getBoundary(UText *ut, int64_t index) {
+    utext_setNativeIndex(ut, index);
+    return utext_getNativeIndex(ut);
+}
+
+/** Finds the matches that start in one chunk, as if the search started at the chunk start. */
+void findInChunk(FindChunk &chunk) {
+    RegexMatcher &matcher = *chunk.matcher;
+    UVector64 &matches = *chunk.matches;
+    UErrorCode &errorCode = chunk.errorCode;
+    matcher.region(chunk.start, chunk.regionLimit, errorCode);
+    while (matcher.find(errorCode)) {
+        int64_t start = matcher.start64(errorCode);
+        if (start >= chunk.limit) {
+            break;
+        }
+        matches.addElement(start, errorCode);
+        matches.addElement(matcher.end64(errorCode), errorCode);
+        if (U_FAILURE(errorCode)) {
+            break;
+        }
+    }
+}
+
+/**
+ * Finds all matches of the pattern in the input and appends them to matches
+ * as pairs of start and limit.
+ */
+void findAllMatches(const RegexPattern &pattern, UText *input, int64_t overlap,
+                    int32_t threadCount, UVector64 &matches, UErrorCode &status) {
+    LocalUTextPointer text(utext_clone(nullptr, input, false, true, &status));
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int64_t length = utext_nativeLength(text.getAlias());
+
+    int64_t chunkCount = 1;
+    if (overlap >= 0 && threadCount > 1) {
+        chunkCount = length / std::max(MIN_CHUNK_LENGTH, overlap);
+        chunkCount = std::max<int64_t>(std::min<int64_t>(chunkCount, threadCount), 1);
+    }
+    LocalArray<FindChunk> chunks(new FindChunk[chunkCount]);
+    if (chunks.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int64_t start = 0;
+    for (int32_t i = 0; i < chunkCount; ++i) {
+        FindChunk &chunk = chunks[i];
+        chunk.start = start;
+        if (i + 1 < chunkCount) {
+            chunk.limit = getBoundary(text.getAlias(), length / chunkCount * (i + 1));
+            chunk.regionLimit = getBoundary(text.getAlias(), std::min(chunk.limit + overlap, length));
+        } else {
+            // An empty match at the end of the input also belongs to the last chunk.
+            chunk.limit = INT64_MAX;
+            chunk.regionLimit = length;
+        }
+        start = chunk.limit;
+        chunk.matcher.adoptInsteadAndCheckErrorCode(pattern.matcher(status), status);
+        chunk.matches.adoptInsteadAndCheckErrorCode(new UVector64(status), status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        // Transparent bounds let look-around and \b see beyond the region, and
+        // non-anchoring bounds keep ^ and $ from matching at its edges.
+        chunk.matcher->useTransparentBounds(true);
+        chunk.matcher->useAnchoringBounds(false);
+        chunk.matcher->reset(input);
+    }
+
+    runTasks(static_cast<int32_t>(chunkCount),
+             [&chunks](int32_t i) { findInChunk(chunks[i]); }, status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    for (int32_t i = 0; i < chunkCount; ++i) {
+        if (U_FAILURE(chunks[i].errorCode)) {
+            status = chunks[i].errorCode;
+            return;
+        }
+    }
+
+    // Each chunk searched from its own start, while a sequential search continues
+    // from the end of the previous match.  A match at a given start position does not
+    // depend on where the search started, so a chunk's matches are correct from
+    // the first one that the sequential search also finds.
+    int64_t resumeAt = 0;  // Where a sequential search would look for the next match.
+    for (int32_t i = 0; i < chunkCount; ++i) {
+        FindChunk &chunk = chunks[i];
+        const UVector64 &chunkMatches = *chunk.matches;
+        int32_t size = chunkMatches.size();
+        int32_t next = 0;
+        if (resumeAt >= chunk.limit) {
+            // A previous match extends across this whole chunk.
+            continue;
+        }
+        if (resumeAt > chunk.start) {
+            // A previous match ended inside this chunk. Continue the search from its end
+            // until it arrives at a match that the chunk found as well.
+            int32_t known = 0;
+            next = size;
+            RegexMatcher &matcher = *chunk.matcher;
+            matcher.region(chunk.start, chunk.regionLimit, resumeAt, status);
+            while (matcher.find(status)) {
+                int64_t matchStart = matcher.start64(status);
+                if (matchStart >= chunk.limit) {
+                    break;
+                }
+                while (known < size && chunkMatches.elementAti(known) < matchStart) {
+                    known += 2;
+                }
+                if (known < size && chunkMatches.elementAti(known) == matchStart) {
+                    next = known;
+                    break;
+                }
+                matches.addElement(matchStart, status);
+                matches.addElement(matcher.end64(status), status);
+            }
+        }
+        for (; next < size; ++next) {
+            matches.addElement(chunkMatches.elementAti(next), status);
+        }
+        if (U_FAILURE(status)) {
+            return;
+        }
+        int32_t count = matches.size();
+        if (count > 0) {
+            int64_t lastStart = matches.elementAti(count - 2);
+            resumeAt = matches.elementAti(count - 1);
+            if (lastStart == resumeAt) {
+                // find() does not return two matches at the same position.
+                if (resumeAt >= length) {
+                    break;
+                }
+                utext_setNativeIndex(text.getAlias(), resumeAt);
+                utext_next32(text.getAlias());
+                resumeAt = utext_getNativeIndex(text.getAlias());
+            }
+        }
+    }
+}
+
+}  // namespace
+
+//---------------------------------------------------------------------
+//
+//   findAll
+//
+//---------------------------------------------------------------------
+int32_t RegexPattern::findAll(const UnicodeString &input,
+        int32_t          maxMatchLength,
+        int32_t          threadCount,
+        int32_t          *starts,
+        int32_t          *limits,
+        int32_t          destCapacity,
+        UErrorCode       &status) const
+{
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (destCapacity < 0 || (destCapacity > 0 && (starts == nullptr || limits == nullptr))) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UText text = UTEXT_INITIALIZER;
+    utext_openConstUnicodeString(&text, &input, &status);
+    UVector64 matches(status);
+    if (U_SUCCESS(status)) {
+        int64_t overlap = getChunkOverlap(&text, maxMatchLength, fMaxMatchLen, fUsesBackslashG);
+        findAllMatches(*this, &text, overlap, threadCount, matches, status);
+    }
+    utext_close(&text);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int32_t count = matches.size() / 2;
+    for (int32_t i = 0; i < count && i < destCapacity; ++i) {
+        starts[i] = static_cast<int32_t>(matches.elementAti(2 * i));
+        limits[i] = static_cast<int32_t>(matches.elementAti(2 * i + 1));
+    }
+    if (count > destCapacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+int32_t RegexPattern::findAll(UText *input,
+        int64_t          maxMatchLength,
+        int32_t          threadCount,
+        int64_t          *starts,
+        int64_t          *limits,
+        int32_t          destCapacity,
+        UErrorCode       &status) const
+{
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (input == nullptr || destCapacity < 0 ||
+            (destCapacity > 0 && (starts == nullptr || limits == nullptr))) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UVector64 matches(status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int64_t overlap = getChunkOverlap(input, maxMatchLength, fMaxMatchLen, fUsesBackslashG);
+    findAllMatches(*this, input, overlap, threadCount, matches, status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int32_t count = matches.size() / 2;
+    for (int32_t i = 0; i < count && i < destCapacity; ++i) {
+        starts[i] = matches.elementAti(2 * i);
+        limits[i] = matches.elementAti(2 * i + 1);
+    }
+    if (count > destCapacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return count;
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
@@ -39,6 +39,7 @@
 #include "regexcst.h"   // Contains state table for the regex pattern parser.
                         //   generated by a Perl script.
 #include "regexcmp.h"
+#include "regexnfa.h"
 #include "regexst.h"
 #include "regextxt.h"
 
@@ -305,12 +306,18 @@ void    RegexCompile::compile(
     //   are too short.
     //
     fRXPat->fMinMatchLen = minMatchLength(3, fRXPat->fCompiledPat->size()-1);
+    fRXPat->fMaxMatchLen = maxMatchLength(3, fRXPat->fCompiledPat->size()-1);
 
     //
     // Optimization pass 2: match start type
     //
     matchStartType();
 
+    //
+    // Optimization pass 3: strings that every match must contain, for find()
+    //
+    requiredStrings();
+
     //
     // Set up fast latin-1 range sets
     //
@@ -327,6 +334,12 @@ void    RegexCompile::compile(
         fRXPat->fSets8[i].init(s);
     }
 
+    //
+    // Patterns that need no backtracking state beyond the current position
+    //   get an NFA, and are matched in linear time by RegexDFA.
+    //
+    fRXPat->fNFA = RegexNFA::createForPattern(*fRXPat, *fStatus);
+
 }
 
 
@@ -1201,6 +1214,7 @@ UBool RegexCompile::doParseActions(int32_t action)
     case doBackslashG:
         fixLiterals(false);
         appendOp(URX_BACKSLASH_G, 0);
+        fRXPat->fUsesBackslashG = true;
         break;
 
     case doBackslashH:
@@ -3466,6 +3480,334 @@ int32_t   RegexCompile::minMatchLength(int32_t start, int32_t end) {
     return currentLen;
 }
 
+//------------------------------------------------------------------------------
+//
+//   requiredStrings    Find literal strings, one of which occurs in the input
+//                      text of every match.  find() does not try start positions
+//                      after the last place where one of them occurs.
+//
+//                      An op is mandatory if no forward branch jumps over it,
+//                      so that every path to the end of the pattern goes through
+//                      it.  A run of mandatory literal ops, possibly joined by
+//                      alternations of literals, matches adjacent text.  The
+//                      strings of the run whose shortest string is the longest
+//                      are kept, in fRXPat->fRequiredStrings, each preceded by
+//                      its length.
+//
+//                      Patterns with end-of-input assertions get none.  The
+//                      requireEnd() result of a failed find() can depend on
+//                      the start positions that were tried.
+//
+//------------------------------------------------------------------------------
+static const int32_t MAX_REQUIRED_STRINGS = 8;     // Alternatives kept from one run.
+static const int32_t MAX_REQUIRED_LENGTH  = 32;    // Longer strings are truncated.
+
+void RegexCompile::requiredStrings() {
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+    fRXPat->fRequiredStrings.remove();
+    if (fRXPat->fStartType == START_START) {
+        return;
+    }
+
+    UVector64 *pat = fRXPat->fCompiledPat;
+    int32_t    end = pat->size() - 1;
+    int32_t    loc;
+    int32_t    op;
+    int32_t    opType;
+
+    // Pass 1: count the forward branches that jump over each location, and list
+    //   the locations of the ops.  A look-around block is listed as its start op.
+    //   skipped holds +1 at the first location jumped over and -1 at the
+    //   destination, and is then summed.
+    UVector32  skipped(end+2, *fStatus);
+    UVector32  opLocs(*fStatus);
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+    skipped.setSize(end+2);
+    for (loc=3; loc<=end; loc++) {
+        int32_t opLoc = loc;
+        int32_t dest  = -1;
+        op     = static_cast<int32_t>(pat->elementAti(loc));
+        opType = URX_TYPE(op);
+        opLocs.addElement(loc, *fStatus);
+
+        switch (opType) {
+        case URX_DOLLAR:
+        case URX_DOLLAR_M:
+        case URX_DOLLAR_D:
+        case URX_DOLLAR_MD:
+        case URX_BACKSLASH_Z:
+            return;
+
+        case URX_STATE_SAVE:
+        case URX_JMP:
+        case URX_JMP_SAV:
+        case URX_JMP_SAV_X:
+            dest = URX_VAL(op);
+            break;
+
+        case URX_JMPX:
+            dest = URX_VAL(op);
+            loc++;
+            break;
+
+        case URX_STRING:
+        case URX_STRING_I:
+            loc++;
+            break;
+
+        case URX_CTR_INIT:
+        case URX_CTR_INIT_NG:
+            // A loop with a minimum count of zero branches past its end.
+            if (pat->elementAti(loc+2) == 0) {
+                dest = URX_VAL(static_cast<int32_t>(pat->elementAti(loc+1))) + 1;
+            }
+            loc += 3;
+            break;
+
+        case URX_LA_START:
+        case URX_LB_START:
+            {
+                // Scan to the end of the block, as minMatchLength() does.
+                int32_t  depth = (opType == URX_LA_START? 2: 1);
+                for (;;) {
+                    loc++;
+                    op = static_cast<int32_t>(pat->elementAti(loc));
+                    switch (URX_TYPE(op)) {
+                    case URX_LA_START:
+                        depth += 2;
+                        break;
+                    case URX_LB_START:
+                        depth++;
+                        break;
+                    case URX_LA_END:
+                    case URX_LBN_END:
+                        depth--;
+                        break;
+                    case URX_DOLLAR:
+                    case URX_DOLLAR_M:
+                    case URX_DOLLAR_D:
+                    case URX_DOLLAR_MD:
+                    case URX_BACKSLASH_Z:
+                        return;
+                    default:
+                        break;
+                    }
+                    if (depth == 0) {
+                        break;
+                    }
+                    U_ASSERT(loc < end);
+                }
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        if (dest > opLoc+1) {
+            skipped.setElementAt(skipped.elementAti(opLoc+1) + 1, opLoc+1);
+            skipped.setElementAt(skipped.elementAti(dest) - 1, dest);
+        }
+    }
+    if (U_FAILURE(*fStatus)) {
+        return;
+    }
+    for (loc=4; loc<=end; loc++) {
+        skipped.setElementAt(skipped.elementAti(loc-1) + skipped.elementAti(loc), loc);
+    }
+
+    // Pass 2: build the strings of each run of mandatory literals, and keep the best.
+    UnicodeString  run[MAX_REQUIRED_STRINGS];
+    UnicodeString  alternatives[MAX_REQUIRED_STRINGS];
+    UnicodeString  best[MAX_REQUIRED_STRINGS];
+    int32_t        runCount  = 1;
+    int32_t        bestCount = 0;
+    int32_t        bestLen   = 0;
+    int32_t        i         = 0;
+    int32_t        j;
+    int32_t        k;
+    for (;;) {
+        UBool extended = false;
+        UBool retry    = false;     // An alternation that does not fit the run starts the next.
+        if (i < opLocs.size()) {
+            loc = opLocs.elementAti(i);
+            if (skipped.elementAti(loc) == 0) {
+                UnicodeString  literal;
+                if (appendLiteral(loc, literal)) {
+                    for (j=0; j<runCount; j++) {
+                        run[j].append(literal);
+                    }
+                    extended = true;
+                } else if (URX_TYPE(static_cast<int32_t>(pat->elementAti(loc))) == URX_STATE_SAVE) {
+                    int32_t altCount;
+                    int32_t altEnd = literalAlternation(loc, alternatives, altCount);
+                    if (altEnd > 0 && runCount * altCount > MAX_REQUIRED_STRINGS) {
+                        retry = true;
+                    } else if (altEnd > 0) {
+                        for (j=runCount-1; j>=0; j--) {
+                            for (k=altCount-1; k>=0; k--) {
+                                run[j*altCount + k] = run[j];
+                                run[j*altCount + k].append(alternatives[k]);
+                            }
+                        }
+                        runCount *= altCount;
+                        loc = altEnd;
+                        extended = true;
+                    }
+                }
+            }
+            if (extended) {
+                while (i < opLocs.size() && opLocs.elementAti(i) < loc) {
+                    i++;
+                }
+                continue;
+            }
+        }
+
+        // The run ends.  Keep it if its shortest string is longer than those of the
+        //   best run so far.  Truncate long strings, without splitting a surrogate pair.
+        //   Strings that start or end with part of a surrogate pair could be found
+        //   inside a pair in the input, so the run is not used.
+        int32_t  runLen = INT32_MAX;
+        for (j=0; j<runCount; j++) {
+            if (run[j].length() > MAX_REQUIRED_LENGTH) {
+                run[j].truncate(U16_IS_LEAD(run[j].charAt(MAX_REQUIRED_LENGTH-1)) ?
+                                MAX_REQUIRED_LENGTH-1 : MAX_REQUIRED_LENGTH);
+            }
+            int32_t len = run[j].length();
+            if (len == 0 || U16_IS_TRAIL(run[j].charAt(0)) || U16_IS_LEAD(run[j].charAt(len-1))) {
+                runLen = 0;
+            }
+            runLen = uprv_min(runLen, len);
+        }
+        if (runLen > bestLen || (runLen > 0 && runLen == bestLen && runCount < bestCount)) {
+            for (j=0; j<runCount; j++) {
+                best[j] = run[j];
+            }
+            bestCount = runCount;
+            bestLen   = runLen;
+        }
+        if (i >= opLocs.size()) {
+            break;
+        }
+        run[0].remove();
+        runCount = 1;
+        if (!retry) {
+            i++;
+        }
+    }
+
+    for (j=0; j<bestCount; j++) {
+        fRXPat->fRequiredStrings.append(static_cast<char16_t>(best[j].length()));
+        fRXPat->fRequiredStrings.append(best[j]);
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   appendLiteral      If the op at loc is a case sensitive literal, append its
+//                      text to dest.  Capture group ops count as empty literals.
+//                      Advances loc to the next op.
+//
+//                      Returns false, leaving loc unchanged, for any other op.
+//
+//------------------------------------------------------------------------------
+UBool RegexCompile::appendLiteral(int32_t &loc, UnicodeString &dest) {
+    int32_t op = static_cast<int32_t>(fRXPat->fCompiledPat->elementAti(loc));
+    switch (URX_TYPE(op)) {
+    case URX_ONECHAR:
+        dest.append(static_cast<UChar32>(URX_VAL(op)));
+        loc++;
+        return true;
+
+    case URX_STRING:
+        {
+            int32_t stringLenOp = static_cast<int32_t>(fRXPat->fCompiledPat->elementAti(loc+1));
+            dest.append(fRXPat->fLiteralText, URX_VAL(op), URX_VAL(stringLenOp));
+            loc += 2;
+            return true;
+        }
+
+    case URX_START_CAPTURE:
+    case URX_END_CAPTURE:
+    case URX_NOP:
+        loc++;
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//
+//   literalAlternation   Check for an alternation of non-empty literals,
+//                        starting with the URX_STATE_SAVE at loc.  As compiled,
+//
+//                              STATE_SAVE L1
+//                              literal 1
+//                              JMP E
+//                          L1: STATE_SAVE L2
+//                              literal 2
+//                              JMP E
+//                          L2: literal 3
+//                          E:
+//
+//                        Sets alternatives and count to the literals, and returns
+//                        E, or returns -1 if the ops have some other form.
+//
+//------------------------------------------------------------------------------
+int32_t RegexCompile::literalAlternation(int32_t loc, UnicodeString *alternatives,
+                                         int32_t &count) {
+    UVector64 *pat = fRXPat->fCompiledPat;
+    int32_t    endLoc = -1;
+    count = 0;
+    for (;;) {
+        int32_t op   = static_cast<int32_t>(pat->elementAti(loc));
+        int32_t next = -1;              // Start of the next alternative.
+        int32_t limit;                  // End of the ops of this alternative.
+        if (URX_TYPE(op) == URX_STATE_SAVE) {
+            next = URX_VAL(op);
+            if (next <= loc+1) {
+                return -1;
+            }
+            int32_t jmpOp = static_cast<int32_t>(pat->elementAti(next-1));
+            if (URX_TYPE(jmpOp) != URX_JMP || URX_VAL(jmpOp) <= next ||
+                    (endLoc >= 0 && URX_VAL(jmpOp) != endLoc)) {
+                return -1;
+            }
+            endLoc = URX_VAL(jmpOp);
+            limit  = next-1;
+            loc++;
+        } else {
+            limit  = endLoc;
+        }
+        if (count >= MAX_REQUIRED_STRINGS) {
+            return -1;
+        }
+        UnicodeString &alternative = alternatives[count++];
+        alternative.remove();
+        while (loc < limit) {
+            if (!appendLiteral(loc, alternative)) {
+                return -1;
+            }
+        }
+        if (loc != limit || alternative.isEmpty()) {
+            return -1;
+        }
+        if (next < 0) {
+            return endLoc;
+        }
+        loc = next;
+    }
+}
+
 //------------------------------------------------------------------------------
 //
 //   maxMatchLength    Calculate the length of the longest string that could
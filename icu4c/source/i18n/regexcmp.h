@@ -115,6 +115,10 @@ class U_I18N_API RegexCompile : public UMemory {
     int32_t     maxMatchLength(int32_t start,
                                int32_t end);
     void        matchStartType();
+    void        requiredStrings();
+    UBool       appendLiteral(int32_t &loc, UnicodeString &dest);
+    int32_t     literalAlternation(int32_t loc, UnicodeString *alternatives,
+                                   int32_t &count);
     void        stripNOPs();
 
     void        setEval(int32_t op);
@@ -0,0 +1,770 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  regexdfa.cpp
+//
+//         Contains the implementation of class RegexDFA, the linear time
+//         matching engine that RegexMatcher uses for the patterns that
+//         RegexNFA can translate.
+//
+//         find() first scans with the lazy DFA, which follows all match
+//         attempts together and keeps no capture groups, for the first
+//         position where any thread reaches the end of the pattern.  It also
+//         notes the last position before that where no attempt was under way:
+//         the attempts that the backtracking engine made before that position
+//         all failed without side effects, so the NFA simulation, run() below,
+//         can start there and still produce exactly the result of the
+//         backtracking engine.
+//
+
+#include "unicode/utypes.h"
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/regex.h"
+#include "unicode/uchar.h"
+#include "unicode/uniset.h"
+#include "unicode/utf16.h"
+#include "cmemory.h"
+#include "uarrsort.h"
+#include "uassert.h"
+#include "regeximp.h"
+#include "regexst.h"
+#include "regexnfa.h"
+#include "regexdfa.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Limits on the size of the lazy DFA.  When either is reached,
+// all of the DFA states are discarded and building starts over.
+constexpr int32_t kMaxDFAStates = 512;
+constexpr int32_t kMaxKernelsLength = 1 << 16;
+constexpr int32_t kHashSize = 1024;     // Power of two, at least 2 * kMaxDFAStates.
+
+// What a DFA state knows about the input before its position.
+constexpr uint32_t CONTEXT_PREV_WORD = 1;   // The last non-combining character is a word character.
+constexpr uint32_t CONTEXT_PREV_LT = 2;     // The previous character is a line terminator,
+constexpr uint32_t CONTEXT_PREV_CR = 4;     //   a CR,
+constexpr uint32_t CONTEXT_PREV_LF = 8;     //   or a LF.
+constexpr uint32_t CONTEXT_SEED = 0x10;     // New match attempts may start here.
+
+// Kinds of RegexDFA::Frame.
+enum {
+    FRAME_FOLLOW,           // Follow transitions from state fIndex.
+    FRAME_RESTORE_SLOT,     // Set capture group slot fIndex back to fValue.
+    FRAME_RESTORE_BITS      // Set the progress bits back to fValue.
+};
+
+inline UBool isLineTerminator(UChar32 c) {
+    if (c & ~(0x0a | 0x0b | 0x0c | 0x0d | 0x85 | 0x2028 | 0x2029)) {
+        return false;
+    }
+    return (c<=0x0d && c>=0x0a) || c==0x85 || c==0x2028 || c==0x2029;
+}
+
+inline UBool isWordCombining(UChar32 c) {
+    return u_hasBinaryProperty(c, UCHAR_GRAPHEME_EXTEND) || u_charType(c) == U_FORMAT_CHAR;
+}
+
+// The bits of value that are set in mask, packed together.
+inline int32_t packBits(uint32_t value, uint32_t mask) {
+    int32_t packed = 0;
+    for (int32_t bit = 1; mask != 0; mask &= mask - 1, bit <<= 1) {
+        if (value & mask & (0 - mask)) {
+            packed |= bit;
+        }
+    }
+    return packed;
+}
+
+inline int32_t hashKernel(const int32_t *kernel, int32_t length, uint32_t context) {
+    uint32_t hash = context;
+    for (int32_t i = 0; i < length; ++i) {
+        hash = hash * 31 + static_cast<uint32_t>(kernel[i]);
+    }
+    return static_cast<int32_t>((hash ^ (hash >> 15)) & (kHashSize - 1));
+}
+
+}  // namespace
+
+RegexDFA::RegexDFA(const RegexNFA &nfa, UErrorCode &status) :
+        fNFA(nfa), fPattern(nfa.fPatterns[0]), fSlotCount(1 + 3 * nfa.fPatterns[0].fGroupCount),
+        fGeneration(0), fResultEnd(-1), fResultEffects(0), fEffects(0),
+        fInput(nullptr), fStartPos(0), fTestLen(0), fLineStart(0),
+        fClassCount(nfa.fByteClassCount), fDStateCount(0), fKernelsLength(0),
+        fNextKernelLength(0), fSeenGeneration(0) {
+    fListSize[0] = fListSize[1] = 0;
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t stateCount = nfa.fStateCount;
+    if (fListStates[0].allocateInsteadAndReset(stateCount) == nullptr ||
+            fListStates[1].allocateInsteadAndReset(stateCount) == nullptr ||
+            fListSlots[0].allocateInsteadAndReset(stateCount * fSlotCount) == nullptr ||
+            fListSlots[1].allocateInsteadAndReset(stateCount * fSlotCount) == nullptr ||
+            fListEffects[0].allocateInsteadAndReset(stateCount) == nullptr ||
+            fListEffects[1].allocateInsteadAndReset(stateCount) == nullptr ||
+            fVisited.allocateInsteadAndReset(nfa.fDedupeSlotCount) == nullptr ||
+            fInList.allocateInsteadAndReset(stateCount) == nullptr ||
+            fStack.allocateInsteadAndReset(3 * nfa.fDedupeSlotCount + 2) == nullptr ||
+            fSlots.allocateInsteadAndReset(fSlotCount) == nullptr ||
+            fResult.allocateInsteadAndReset(fSlotCount) == nullptr ||
+            fDKernelStart.allocateInsteadAndReset(kMaxDFAStates) == nullptr ||
+            fDKernelLength.allocateInsteadAndReset(kMaxDFAStates) == nullptr ||
+            fDContext.allocateInsteadAndReset(kMaxDFAStates) == nullptr ||
+            fDHash.allocateInsteadAndReset(kHashSize) == nullptr ||
+            fDTransitions.allocateInsteadAndReset(kMaxDFAStates * fClassCount) == nullptr ||
+            fNextKernel.allocateInsteadAndReset(stateCount) == nullptr ||
+            fCurKernel.allocateInsteadAndReset(stateCount) == nullptr ||
+            fStateStack.allocateInsteadAndReset(2 * stateCount + 2) == nullptr ||
+            fConsuming.allocateInsteadAndReset(stateCount) == nullptr ||
+            fSeen.allocateInsteadAndReset(stateCount) == nullptr ||
+            fInKernel.allocateInsteadAndReset(stateCount) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < fSlotCount; ++i) {
+        fResult[i] = -1;
+    }
+    flushStates();
+}
+
+RegexDFA::~RegexDFA() {
+}
+
+//------------------------------------------------------------------------------
+//
+//   find, matchAt
+//
+//------------------------------------------------------------------------------
+
+UBool RegexDFA::find(const RegexNFAInput &input, int32_t startPos, int32_t testLen,
+                     UErrorCode &status) {
+    fEffects = 0;
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    U_ASSERT(startPos < input.fActiveLimit);
+    fInput = &input;
+    fStartPos = startPos;
+    fTestLen = testLen;
+    if (fPattern.fStartType == START_START) {
+        // A match can only start at the start of the input.
+        if (startPos > input.fActiveStart) {
+            return false;
+        }
+        return run(startPos, -1, true, false);
+    }
+    fLineStart = startPos;
+    if (startPos == input.fAnchorStart) {
+        U16_FWD_1(input.fText, fLineStart, input.fActiveLimit);
+    }
+
+    // Word boundaries look at the code point before the position. If find() starts
+    // in the middle of a surrogate pair, that is not the code point before it
+    // in the DFA's view of the input, so leave out the DFA.
+    int32_t restart = startPos;
+    if (!(startPos > input.fLookStart && U16_IS_TRAIL(input.fText[startPos]) &&
+            U16_IS_LEAD(input.fText[startPos - 1]))) {
+        UBool found = scan(restart, status);
+        if (U_FAILURE(status)) {
+            return false;
+        }
+        if (!found && !fPattern.fHasEndAssertions) {
+            fEffects = RegexNFA::HIT_END;
+            return false;
+        }
+    }
+    int32_t prev = -1;
+    if (restart > startPos) {
+        prev = restart;
+        U16_BACK_1(input.fText, startPos, prev);
+    }
+    UBool found = run(restart, prev, false, false);
+    if (!found) {
+        fEffects |= RegexNFA::HIT_END;
+    }
+    return found;
+}
+
+UBool RegexDFA::matchAt(const RegexNFAInput &input, int32_t startPos, UBool toEnd,
+                        UErrorCode &status) {
+    fEffects = 0;
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    fInput = &input;
+    fStartPos = startPos;
+    fTestLen = startPos;
+    return run(startPos, -1, true, toEnd);
+}
+
+//
+//  attemptAt   Whether RegexMatcher::findUsingChunk() calls MatchChunkAt() at pos,
+//              going by the rules of each start type. prev is the position of the
+//              code point before pos, if pos is after the start position of find().
+//
+UBool RegexDFA::attemptAt(int32_t pos, int32_t prev) const {
+    const RegexNFAInput &input = *fInput;
+    const char16_t *text = input.fText;
+    switch (fPattern.fStartType) {
+    case START_NO_INFO:
+        return pos == fStartPos || prev < fTestLen;
+    case START_CHAR:
+    case START_STRING:
+    case START_SET:
+        {
+            if (pos > fTestLen) {
+                return false;
+            }
+            UChar32 c;
+            U16_NEXT(text, pos, input.fActiveLimit, c);
+            return fPattern.fStartType == START_SET ?
+                fPattern.fInitialChars->contains(c) : c == fPattern.fInitialChar;
+        }
+    case START_LINE:
+        {
+            if (pos == fStartPos && pos == input.fAnchorStart) {
+                return true;
+            }
+            if (pos < fLineStart) {
+                return false;
+            }
+            // find() checks for a line start at each position q, and if it is between
+            // a CR and a LF, tries a match after the LF, at pos.
+            char16_t ch = text[pos - 1];
+            int32_t q = pos;
+            if (fPattern.fUnixLines) {
+                if (ch != 0x0a) {
+                    return false;
+                }
+            } else {
+                if (!isLineTerminator(ch) ||
+                        (ch == 0x0d && pos < input.fActiveLimit && text[pos] == 0x0a)) {
+                    return false;
+                }
+                if (ch == 0x0a && pos - 1 >= fLineStart && text[pos - 2] == 0x0d) {
+                    q = pos - 1;
+                }
+            }
+            return q == fLineStart || (q == pos ? prev : pos - 2) < fTestLen;
+        }
+    default:
+        return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+//
+//   The NFA simulation
+//
+//------------------------------------------------------------------------------
+
+void RegexDFA::nextGeneration() {
+    if (++fGeneration == 0) {
+        uprv_memset(fVisited.getAlias(), 0, fNFA.fDedupeSlotCount * sizeof(uint32_t));
+        uprv_memset(fInList.getAlias(), 0, fNFA.fStateCount * sizeof(uint32_t));
+        fGeneration = 1;
+    }
+}
+
+//
+//  run   Runs the match attempts from start on, in parallel, until the first one to
+//        succeed in the backtracking engine's order is known.  The threads of each
+//        list are in the order that the backtracking engine would try them, and each
+//        carries the side effects of everything that the backtracking engine would
+//        have done before getting to it.
+//
+UBool RegexDFA::run(int32_t start, int32_t prev, UBool anchored, UBool toEnd) {
+    const RegexNFAInput &input = *fInput;
+    const RegexNFAState *states = fNFA.fStates.getAlias();
+    const char16_t *text = input.fText;
+    int32_t seedLimit = anchored ? start : fTestLen + 3;
+    uint32_t allEffects = 0;
+    UBool found = false;
+    int32_t current = 0;
+    fListSize[current] = 0;
+    nextGeneration();
+
+    for (int32_t pos = start;;) {
+        // A new match attempt comes after all of the earlier ones.
+        if (!found && pos <= seedLimit && (anchored ? pos == start : attemptAt(pos, prev))) {
+            for (int32_t i = 0; i < fSlotCount; ++i) {
+                fSlots[i] = -1;
+            }
+            fSlots[0] = pos;
+            uint32_t effects = allEffects;
+            found = addThreads(current, fPattern.fStart, pos, toEnd, effects);
+            allEffects |= effects;
+        }
+        int32_t threadCount = fListSize[current];
+        if (threadCount == 0 && (found || pos >= seedLimit || pos >= input.fActiveLimit)) {
+            break;
+        }
+
+        const int32_t *threadStates = fListStates[current].getAlias();
+        const uint32_t *threadEffects = fListEffects[current].getAlias();
+        uint32_t effects = 0;
+        if (pos >= input.fActiveLimit) {
+            // The consuming states all fail, and set hitEnd.
+            for (int32_t i = 0; i < threadCount; ++i) {
+                effects |= threadEffects[i] | RegexNFA::HIT_END;
+            }
+            allEffects |= effects;
+            if (found) {
+                fResultEffects |= effects;
+            }
+            break;
+        }
+
+        int32_t nextPos = pos;
+        UChar32 c;
+        U16_NEXT(text, nextPos, input.fActiveLimit, c);
+        int32_t next = 1 - current;
+        fListSize[next] = 0;
+        nextGeneration();
+        UBool newMatch = false;
+        for (int32_t i = 0; i < threadCount; ++i) {
+            effects |= threadEffects[i];
+            const RegexNFAState &s = states[threadStates[i]];
+            if (s.fType == RegexNFA::NFA_LF_AFTER_CR ? c == 0x0a : RegexNFA::matchesChar(s, c)) {
+                uprv_memcpy(fSlots.getAlias(), fListSlots[current].getAlias() + i * fSlotCount,
+                            fSlotCount * sizeof(int32_t));
+                if (addThreads(next, s.fNext, nextPos, toEnd, effects)) {
+                    // Later threads come after this match.
+                    found = newMatch = true;
+                    break;
+                }
+            }
+        }
+        allEffects |= effects;
+        if (found && !newMatch) {
+            fResultEffects |= effects;
+        }
+        current = next;
+        prev = pos;
+        pos = nextPos;
+    }
+    fEffects = found ? fResultEffects : allEffects;
+    return found;
+}
+
+//
+//  addThreads   Follows the epsilon transitions from state at pos, in the order that
+//               the backtracking engine would, adding the consuming states that
+//               are reached to a thread list.  Returns true if the end of the
+//               pattern is reached, which ends the search for this position.
+//
+UBool RegexDFA::addThreads(int32_t list, int32_t state, int32_t pos, UBool toEnd,
+                           uint32_t &effects) {
+    const RegexNFAInput &input = *fInput;
+    const RegexNFAState *states = fNFA.fStates.getAlias();
+    const uint32_t *dedupeMask = fNFA.fDedupeMask.getAlias();
+    const int32_t *dedupeSlot = fNFA.fDedupeSlot.getAlias();
+    int32_t *slots = fSlots.getAlias();
+    Frame *stack = fStack.getAlias();
+    int32_t sp = 0;
+    uint32_t bits = 0;
+    stack[sp++] = {FRAME_FOLLOW, state, 0};
+    while (sp > 0) {
+        Frame frame = stack[--sp];
+        if (frame.fKind == FRAME_RESTORE_SLOT) {
+            slots[frame.fIndex] = frame.fValue;
+            continue;
+        }
+        if (frame.fKind == FRAME_RESTORE_BITS) {
+            bits = static_cast<uint32_t>(frame.fValue);
+            continue;
+        }
+        state = frame.fIndex;
+        if (state < 0) {
+            continue;
+        }
+        int32_t slot = dedupeSlot[state];
+        if (dedupeMask[state] != 0) {
+            slot += packBits(bits, dedupeMask[state]);
+        }
+        if (fVisited[slot] == fGeneration) {
+            continue;
+        }
+        fVisited[slot] = fGeneration;
+
+        const RegexNFAState &s = states[state];
+        int32_t next = s.fNext;
+        switch (s.fType) {
+        case RegexNFA::NFA_NOP:
+            break;
+        case RegexNFA::NFA_SPLIT:
+            stack[sp++] = {FRAME_FOLLOW, s.fAlt, 0};
+            break;
+        case RegexNFA::NFA_SAVE:
+            {
+                int32_t groupSlot = 1 + 3 * (s.fValue >> 1);
+                if ((s.fValue & 1) == 0) {
+                    stack[sp++] = {FRAME_RESTORE_SLOT, groupSlot + 2, slots[groupSlot + 2]};
+                    slots[groupSlot + 2] = pos;
+                } else {
+                    stack[sp++] = {FRAME_RESTORE_SLOT, groupSlot, slots[groupSlot]};
+                    stack[sp++] = {FRAME_RESTORE_SLOT, groupSlot + 1, slots[groupSlot + 1]};
+                    slots[groupSlot] = slots[groupSlot + 2];
+                    slots[groupSlot + 1] = pos;
+                }
+            }
+            break;
+        case RegexNFA::NFA_MARK:
+            stack[sp++] = {FRAME_RESTORE_BITS, 0, static_cast<int32_t>(bits)};
+            bits |= static_cast<uint32_t>(1) << s.fValue;
+            break;
+        case RegexNFA::NFA_CHECK:
+            if (bits & (static_cast<uint32_t>(1) << s.fValue)) {
+                // No input consumed since the loop was entered or last repeated.
+                next = s.fAlt;
+            } else {
+                stack[sp++] = {FRAME_RESTORE_BITS, 0, static_cast<int32_t>(bits)};
+                bits |= static_cast<uint32_t>(1) << s.fValue;
+            }
+            break;
+        case RegexNFA::NFA_HIT_END:
+            effects |= RegexNFA::HIT_END;
+            break;
+        case RegexNFA::NFA_MATCH:
+            if (!toEnd || pos == input.fActiveLimit) {
+                uprv_memcpy(fResult.getAlias(), slots, fSlotCount * sizeof(int32_t));
+                fResultEnd = pos;
+                fResultEffects = effects;
+                return true;
+            }
+            next = -1;
+            break;
+        case RegexNFA::NFA_FAIL:
+            next = -1;
+            break;
+        case RegexNFA::NFA_LF_AFTER_CR:
+            if (pos > 0 && input.fText[pos - 1] == 0x0d && pos < input.fActiveLimit &&
+                    input.fText[pos] == 0x0a) {
+                addToList(list, state, effects);
+                next = -1;
+            }
+            break;
+        default:
+            if (s.fType >= RegexNFA::NFA_TEXT_START) {
+                if (!RegexNFA::assertionHolds(s, input, pos, effects)) {
+                    next = -1;
+                }
+            } else {
+                addToList(list, state, effects);
+                next = -1;
+            }
+            break;
+        }
+        if (next >= 0) {
+            stack[sp++] = {FRAME_FOLLOW, next, 0};
+        }
+    }
+    return false;
+}
+
+void RegexDFA::addToList(int32_t list, int32_t state, uint32_t effects) {
+    if (fInList[state] == fGeneration) {
+        return;
+    }
+    fInList[state] = fGeneration;
+    int32_t i = fListSize[list]++;
+    fListStates[list][i] = state;
+    fListEffects[list][i] = effects;
+    uprv_memcpy(fListSlots[list].getAlias() + i * fSlotCount, fSlots.getAlias(),
+                fSlotCount * sizeof(int32_t));
+}
+
+//------------------------------------------------------------------------------
+//
+//   The lazy DFA
+//
+//------------------------------------------------------------------------------
+
+void RegexDFA::flushStates() {
+    fDStateCount = 0;
+    fKernelsLength = 0;
+    for (int32_t i = 0; i < kHashSize; ++i) {
+        fDHash[i] = -1;
+    }
+}
+
+//
+//  addState   The DFA state for a kernel and context, added if it is new.
+//             Returns -1 if the DFA is full.
+//
+int32_t RegexDFA::addState(const int32_t *kernel, int32_t kernelLength, uint32_t context) {
+    int32_t h = hashKernel(kernel, kernelLength, context);
+    for (;; h = (h + 1) & (kHashSize - 1)) {
+        int32_t state = fDHash[h];
+        if (state < 0) {
+            break;
+        }
+        if (fDContext[state] == context && fDKernelLength[state] == kernelLength &&
+                uprv_memcmp(fKernels.getAlias() + fDKernelStart[state], kernel,
+                            kernelLength * sizeof(int32_t)) == 0) {
+            return state;
+        }
+    }
+    if (fDStateCount == kMaxDFAStates || fKernelsLength + kernelLength > kMaxKernelsLength) {
+        return -1;
+    }
+    if (fKernelsLength + kernelLength > fKernels.getCapacity()) {
+        int32_t capacity = 2 * fKernels.getCapacity();
+        while (capacity < fKernelsLength + kernelLength) {
+            capacity *= 2;
+        }
+        if (fKernels.resize(capacity, fKernelsLength) == nullptr) {
+            return -1;
+        }
+    }
+    int32_t state = fDStateCount++;
+    fDKernelStart[state] = fKernelsLength;
+    fDKernelLength[state] = kernelLength;
+    fDContext[state] = context;
+    uprv_memcpy(fKernels.getAlias() + fKernelsLength, kernel, kernelLength * sizeof(int32_t));
+    fKernelsLength += kernelLength;
+    for (int32_t i = 0; i < fClassCount; ++i) {
+        fDTransitions[state * fClassCount + i] = -1;
+    }
+    fDHash[h] = state;
+    return state;
+}
+
+//
+//  seedByRule   Whether a match attempt may start before c, after the first position
+//               of find().  May be true where find() makes no attempt, but not the
+//               other way around.
+//
+UBool RegexDFA::seedByRule(uint32_t context, UChar32 c) const {
+    switch (fPattern.fStartType) {
+    case START_NO_INFO:
+        return true;
+    case START_CHAR:
+    case START_STRING:
+        return c == fPattern.fInitialChar;
+    case START_SET:
+        return c >= 0 && fPattern.fInitialChars->contains(c);
+    case START_LINE:
+        return (context & (fPattern.fUnixLines ? CONTEXT_PREV_LF : CONTEXT_PREV_LT)) != 0;
+    default:
+        return false;
+    }
+}
+
+//
+//  step   Follows the epsilon transitions from the kernel at pos, and from the start
+//         of the pattern if seedHere, then collects the states after c, if c >= 0,
+//         into fNextKernel.  Returns true if the end of the pattern is reached,
+//         in which case fNextKernel is not complete.
+//
+UBool RegexDFA::step(const int32_t *kernel, int32_t kernelLength, int32_t pos, UChar32 c,
+                     UBool seedHere) {
+    const RegexNFAInput &input = *fInput;
+    const RegexNFAState *states = fNFA.fStates.getAlias();
+    if (++fSeenGeneration == 0) {
+        uprv_memset(fSeen.getAlias(), 0, fNFA.fStateCount * sizeof(uint32_t));
+        uprv_memset(fInKernel.getAlias(), 0, fNFA.fStateCount * sizeof(uint32_t));
+        fSeenGeneration = 1;
+    }
+    int32_t *stack = fStateStack.getAlias();
+    int32_t sp = 0;
+    int32_t consumingCount = 0;
+    if (seedHere) {
+        stack[sp++] = fPattern.fStart;
+    }
+    for (int32_t i = kernelLength - 1; i >= 0; --i) {
+        stack[sp++] = kernel[i];
+    }
+    while (sp > 0) {
+        int32_t state = stack[--sp];
+        if (state < 0 || fSeen[state] == fSeenGeneration) {
+            continue;
+        }
+        fSeen[state] = fSeenGeneration;
+        const RegexNFAState &s = states[state];
+        switch (s.fType) {
+        case RegexNFA::NFA_NOP:
+        case RegexNFA::NFA_SAVE:
+        case RegexNFA::NFA_MARK:
+        case RegexNFA::NFA_HIT_END:
+            stack[sp++] = s.fNext;
+            break;
+        case RegexNFA::NFA_SPLIT:
+        case RegexNFA::NFA_CHECK:
+            // Without the progress bits, both ways are possible.
+            stack[sp++] = s.fAlt;
+            stack[sp++] = s.fNext;
+            break;
+        case RegexNFA::NFA_MATCH:
+            return true;
+        case RegexNFA::NFA_FAIL:
+            break;
+        case RegexNFA::NFA_LF_AFTER_CR:
+            if (pos > 0 && input.fText[pos - 1] == 0x0d && pos < input.fActiveLimit &&
+                    input.fText[pos] == 0x0a) {
+                fConsuming[consumingCount++] = state;
+            } else {
+                stack[sp++] = s.fNext;
+            }
+            break;
+        default:
+            if (s.fType >= RegexNFA::NFA_TEXT_START) {
+                uint32_t effects = 0;
+                if (RegexNFA::assertionHolds(s, input, pos, effects)) {
+                    stack[sp++] = s.fNext;
+                }
+            } else {
+                fConsuming[consumingCount++] = state;
+            }
+            break;
+        }
+    }
+
+    fNextKernelLength = 0;
+    if (c < 0) {
+        return false;
+    }
+    for (int32_t i = 0; i < consumingCount; ++i) {
+        const RegexNFAState &s = states[fConsuming[i]];
+        if (s.fNext >= 0 && fInKernel[s.fNext] != fSeenGeneration &&
+                (s.fType == RegexNFA::NFA_LF_AFTER_CR || RegexNFA::matchesChar(s, c))) {
+            fInKernel[s.fNext] = fSeenGeneration;
+            fNextKernel[fNextKernelLength++] = s.fNext;
+        }
+    }
+    if (fNextKernelLength > 1) {
+        UErrorCode sortStatus = U_ZERO_ERROR;
+        uprv_sortArray(fNextKernel.getAlias(), fNextKernelLength, sizeof(int32_t),
+                       uprv_int32Comparator, nullptr, false, &sortStatus);
+    }
+    return false;
+}
+
+//
+//  scan   Runs the DFA from fStartPos until some match attempt reaches the end of
+//         the pattern, which returns true, or until none can.  Sets restart to
+//         the last position before then where no attempt was under way, and
+//         where none of the earlier ones could have had side effects.
+//
+UBool RegexDFA::scan(int32_t &restart, UErrorCode &status) {
+    const RegexNFAInput &input = *fInput;
+    const char16_t *text = input.fText;
+    const UnicodeSet &wordChars = RegexStaticSets::gStaticSets->fPropSets[URX_ISWORD_SET];
+    const uint8_t *byteClass = fNFA.fByteClass;
+    // Before sideEffectStart, a failing match attempt can not set hitEnd or requireEnd.
+    int32_t sideEffectStart = fPattern.fHasEndAssertions ?
+        input.fAnchorLimit - 2 : input.fActiveLimit;
+    // From cacheLimit on, the assertions look at more than the kernel and context.
+    int32_t cacheLimit = sideEffectStart < input.fActiveLimit ? sideEffectStart : input.fActiveLimit;
+    int32_t seedLimit = fTestLen + 3;
+
+    // The context at fStartPos: whether the preceding non-combining character,
+    // back to the start of the look-around bounds, is a word character.
+    uint32_t context = CONTEXT_SEED;
+    for (int32_t i = fStartPos; i > input.fLookStart;) {
+        UChar32 prevChar;
+        U16_PREV(text, input.fLookStart, i, prevChar);
+        if (!isWordCombining(prevChar)) {
+            if (wordChars.contains(prevChar)) {
+                context |= CONTEXT_PREV_WORD;
+            }
+            break;
+        }
+    }
+    int32_t state = -1;     // Before the first step, the kernel is empty.
+    int32_t kernelLength = 0;
+    restart = fStartPos;
+
+    for (int32_t pos = fStartPos;;) {
+        if (state >= 0) {
+            kernelLength = fDKernelLength[state];
+            context = fDContext[state];
+        }
+        if (kernelLength == 0 && pos <= sideEffectStart) {
+            restart = pos;
+        }
+        if (pos >= input.fActiveLimit) {
+            UBool seedHere = (context & CONTEXT_SEED) != 0 && seedByRule(context, -1);
+            return step(fKernels.getAlias() + (state >= 0 ? fDKernelStart[state] : 0),
+                        kernelLength, pos, -1, seedHere);
+        }
+        int32_t nextPos = pos;
+        UChar32 c;
+        U16_NEXT(text, nextPos, input.fActiveLimit, c);
+        UBool cacheable = state >= 0 && pos > fStartPos && pos < cacheLimit && c < 0x100 &&
+            ((context & CONTEXT_SEED) == 0 || pos + 2 <= seedLimit);
+        int32_t *transition = nullptr;
+        if (cacheable) {
+            transition = &fDTransitions[state * fClassCount + byteClass[c]];
+            if (*transition >= 0) {
+                if (*transition & 1) {
+                    return true;
+                }
+                state = *transition >> 1;
+                pos = nextPos;
+                continue;
+            }
+        }
+
+        // Work out the transition at this position.
+        const int32_t *kernel = fCurKernel.getAlias();
+        if (state >= 0) {
+            uprv_memcpy(fCurKernel.getAlias(), fKernels.getAlias() + fDKernelStart[state],
+                        kernelLength * sizeof(int32_t));
+        }
+        UBool seedHere = pos == fStartPos ? attemptAt(pos, -1) :
+            (context & CONTEXT_SEED) != 0 && seedByRule(context, c);
+        if (step(kernel, kernelLength, pos, c, seedHere)) {
+            if (transition != nullptr) {
+                *transition = 1;
+            }
+            return true;
+        }
+        uint32_t nextContext = 0;
+        if (isWordCombining(c)) {
+            nextContext |= context & CONTEXT_PREV_WORD;
+        } else if (wordChars.contains(c)) {
+            nextContext |= CONTEXT_PREV_WORD;
+        }
+        if (isLineTerminator(c)) {
+            nextContext |= CONTEXT_PREV_LT;
+        }
+        if (c == 0x0d) {
+            nextContext |= CONTEXT_PREV_CR;
+        } else if (c == 0x0a) {
+            nextContext |= CONTEXT_PREV_LF;
+        }
+        if ((context & CONTEXT_SEED) != 0 && nextPos <= seedLimit) {
+            nextContext |= CONTEXT_SEED;
+        }
+        if (fNextKernelLength == 0 && (nextContext & CONTEXT_SEED) == 0) {
+            // Nothing is left to match.
+            if (nextPos <= sideEffectStart) {
+                restart = nextPos;
+            }
+            return false;
+        }
+        int32_t nextState = addState(fNextKernel.getAlias(), fNextKernelLength, nextContext);
+        if (nextState < 0) {
+            flushStates();
+            transition = nullptr;
+            nextState = addState(fNextKernel.getAlias(), fNextKernelLength, nextContext);
+            if (nextState < 0) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return false;
+            }
+        }
+        if (transition != nullptr) {
+            *transition = nextState << 1;
+        }
+        state = nextState;
+        pos = nextPos;
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
@@ -0,0 +1,151 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//   file:  regexdfa.h
+//
+//           ICU Regular Expressions,
+//               Linear time matching for the patterns that a RegexNFA can
+//               represent, used by RegexMatcher in place of the backtracking
+//               engine.
+//
+//           A lazily built DFA, whose transitions are cached per class of
+//           Latin-1 characters, scans for the first place where a match could
+//           end.  A simulation of the NFA that keeps the threads in the order
+//           that the backtracking engine would try them, and tracks the capture
+//           groups of each, then runs over just that part of the input to pick
+//           out the same match, groups, hitEnd and requireEnd as
+//           RegexMatcher::MatchChunkAt() would produce.
+//
+
+#ifndef REGEXDFA_H
+#define REGEXDFA_H
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/uobject.h"
+#include "cmemory.h"
+#include "regexnfa.h"
+
+U_NAMESPACE_BEGIN
+
+class RegexDFA : public UMemory {
+public:
+    /**
+     * @param nfa an NFA from RegexNFA::createForPattern().  Not adopted;
+     *            must outlive this RegexDFA.
+     */
+    RegexDFA(const RegexNFA &nfa, UErrorCode &status);
+    ~RegexDFA();
+
+    /**
+     * Finds the first match at or after startPos, trying the same start
+     * positions as RegexMatcher::findUsingChunk() does.
+     * @param input the text and region
+     * @param startPos where find() starts looking; less than input.fActiveLimit
+     * @param testLen the last position where find() would start a match
+     * @return true if there is a match
+     */
+    UBool find(const RegexNFAInput &input, int32_t startPos, int32_t testLen, UErrorCode &status);
+
+    /**
+     * Matches at startPos only, as RegexMatcher::MatchChunkAt() does.
+     * @param toEnd if true, the match must extend to input.fActiveLimit
+     * @return true if there is a match
+     */
+    UBool matchAt(const RegexNFAInput &input, int32_t startPos, UBool toEnd, UErrorCode &status);
+
+    /** Start of the match found by the last find() or matchAt(). */
+    int32_t matchStart() const { return fResult[0]; }
+
+    /** End of the match found by the last find() or matchAt(). */
+    int32_t matchEnd() const { return fResultEnd; }
+
+    /** Start of capture group number group (from 1) in the last match, or -1. */
+    int32_t groupStart(int32_t group) const { return fResult[3 * group - 2]; }
+
+    /** End of capture group number group (from 1) in the last match, or -1. */
+    int32_t groupEnd(int32_t group) const { return fResult[3 * group - 1]; }
+
+    /**
+     * RegexNFA::HIT_END and RegexNFA::REQUIRE_END, if the backtracking
+     * engine would have set them during the last find() or matchAt().
+     */
+    uint32_t effects() const { return fEffects; }
+
+private:
+    RegexDFA(const RegexDFA &other) = delete;
+    RegexDFA &operator=(const RegexDFA &other) = delete;
+
+    // An entry of the stack for following epsilon transitions.
+    struct Frame {
+        int32_t fKind;
+        int32_t fIndex;
+        int32_t fValue;
+    };
+
+    void nextGeneration();
+    UBool attemptAt(int32_t pos, int32_t prev) const;
+    UBool run(int32_t start, int32_t prev, UBool anchored, UBool toEnd);
+    UBool addThreads(int32_t list, int32_t state, int32_t pos, UBool toEnd, uint32_t &effects);
+    void addToList(int32_t list, int32_t state, uint32_t effects);
+
+    UBool scan(int32_t &restart, UErrorCode &status);
+    UBool step(const int32_t *kernel, int32_t kernelLength, int32_t pos, UChar32 c,
+               UBool seedHere);
+    UBool seedByRule(uint32_t context, UChar32 c) const;
+    int32_t addState(const int32_t *kernel, int32_t kernelLength, uint32_t context);
+    void flushStates();
+
+    const RegexNFA         &fNFA;
+    const RegexNFAPattern  &fPattern;
+    int32_t                 fSlotCount;        // Per thread: match start, then for each
+                                               //   group its start, end and unfinished start.
+
+    // The NFA simulation.
+    LocalMemory<int32_t>    fListStates[2];    // Threads, in the order that the backtracking
+    LocalMemory<int32_t>    fListSlots[2];     //   engine would try them.
+    LocalMemory<uint32_t>   fListEffects[2];
+    int32_t                 fListSize[2];
+    LocalMemory<uint32_t>   fVisited;          // By RegexNFA dedupe slot, stamped with fGeneration.
+    LocalMemory<uint32_t>   fInList;           // By state, stamped with fGeneration.
+    uint32_t                fGeneration;
+    LocalMemory<Frame>      fStack;
+    LocalMemory<int32_t>    fSlots;            // Capture groups of the thread being followed.
+    LocalMemory<int32_t>    fResult;
+    int32_t                 fResultEnd;
+    uint32_t                fResultEffects;
+    uint32_t                fEffects;
+
+    // The input of the current find() or matchAt().
+    const RegexNFAInput    *fInput;
+    int32_t                 fStartPos;
+    int32_t                 fTestLen;
+    int32_t                 fLineStart;        // For START_LINE, where find() checks for line starts.
+
+    // The lazy DFA.  A DFA state is the set of NFA states entering an input position,
+    // before following epsilon transitions, with what the assertions and the
+    // match starts need to know about the preceding characters.
+    int32_t                 fClassCount;
+    int32_t                 fDStateCount;
+    LocalMemory<int32_t>    fDKernelStart;
+    LocalMemory<int32_t>    fDKernelLength;
+    LocalMemory<uint32_t>   fDContext;
+    LocalMemory<int32_t>    fDHash;
+    LocalMemory<int32_t>    fDTransitions;     // (target << 1) | match, or -1 if not known yet.
+    MaybeStackArray<int32_t, 256> fKernels;
+    int32_t                 fKernelsLength;
+    LocalMemory<int32_t>    fNextKernel;
+    int32_t                 fNextKernelLength;
+    LocalMemory<int32_t>    fCurKernel;
+    LocalMemory<int32_t>    fStateStack;
+    LocalMemory<int32_t>    fConsuming;
+    LocalMemory<uint32_t>   fSeen;             // By state, stamped with fSeenGeneration.
+    LocalMemory<uint32_t>   fInKernel;
+    uint32_t                fSeenGeneration;
+};
+
+U_NAMESPACE_END
+#endif   // !UCONFIG_NO_REGULAR_EXPRESSIONS
+#endif   // REGEXDFA_H
@@ -15,6 +15,7 @@
 #if !UCONFIG_NO_REGULAR_EXPRESSIONS
 #include "regeximp.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
 
 U_NAMESPACE_BEGIN
 
@@ -64,7 +65,12 @@ UBool CaseFoldingUTextIterator::inExpansion() {
 
 
 CaseFoldingUCharIterator::CaseFoldingUCharIterator(const char16_t *chars, int64_t start, int64_t limit) :
-   fChars(chars), fIndex(start), fLimit(limit), fFoldChars(nullptr), fFoldLength(0) {
+   fChars(chars), fUTF8(nullptr), fIndex(start), fLimit(limit), fFoldChars(nullptr), fFoldLength(0) {
+}
+
+
+CaseFoldingUCharIterator::CaseFoldingUCharIterator(const uint8_t *utf8, int64_t start, int64_t limit) :
+   fChars(nullptr), fUTF8(utf8), fIndex(start), fLimit(limit), fFoldChars(nullptr), fFoldLength(0) {
 }
 
 
@@ -80,7 +86,13 @@ UChar32 CaseFoldingUCharIterator::next() {
         if (fIndex >= fLimit) {
             return U_SENTINEL;
         }
-        U16_NEXT(fChars, fIndex, fLimit, originalC);
+        if (fUTF8 == nullptr) {
+            U16_NEXT(fChars, fIndex, fLimit, originalC);
+        } else {
+            int32_t i = static_cast<int32_t>(fIndex);
+            U8_NEXT_OR_FFFD(fUTF8, i, fLimit, originalC);
+            fIndex = i;
+        }
 
         fFoldLength = ucase_toFullFolding(originalC, &fFoldChars, U_FOLD_CASE_DEFAULT);
         if (fFoldLength >= UCASE_MAX_STRING_LENGTH || fFoldLength < 0) {
@@ -384,13 +384,14 @@ class CaseFoldingUTextIterator: public UMemory {
 
 
 // Case folded char16_t * string iterator.
-//  Wraps a char16_t  *, provides a case-folded enumeration over its contents.
+//  Wraps a char16_t  *, or a UTF-8 string, provides a case-folded enumeration over its contents.
 //  Used in implementing case insensitive matching constructs.
 //  Implementation in rematch.cpp
 
 class CaseFoldingUCharIterator: public UMemory {
       public:
         CaseFoldingUCharIterator(const char16_t *chars, int64_t start, int64_t limit);
+        CaseFoldingUCharIterator(const uint8_t *utf8, int64_t start, int64_t limit);
         ~CaseFoldingUCharIterator();
 
         UChar32 next();           // Next case folded character
@@ -403,6 +404,7 @@ class CaseFoldingUCharIterator: public UMemory {
 
       private:
         const  char16_t   *fChars;
+        const  uint8_t    *fUTF8;         // Used instead of fChars if not nullptr.
         int64_t            fIndex;
         int64_t            fLimit;
         const  char16_t   *fFoldChars;
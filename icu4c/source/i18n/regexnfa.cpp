@@ -0,0 +1,1257 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  regexnfa.cpp
+//
+//         Translation of compiled regular expressions into Thompson NFAs,
+//         and the simulation that matches all of the patterns of a RegexSet
+//         in one pass over the input.
+//
+//         The translation works directly on the p-code from RegexCompile,
+//         mirroring what RegexMatcher::MatchChunkAt() does for each op.
+//         Backtracking choice points (STATE_SAVE, JMP_SAV) become NFA splits,
+//         and the counted loops ({min,max}) are unrolled.  The input positions
+//         that the matcher saves to stop loops that make no progress become
+//         one bit per loop, set by NFA_MARK and tested by NFA_CHECK; only
+//         RegexDFA, which must pick the same match as the backtracking matcher,
+//         looks at them.
+//
+
+#include "unicode/utypes.h"
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/regex.h"
+#include "unicode/uchar.h"
+#include "unicode/uniset.h"
+#include "unicode/ustring.h"
+#include "unicode/utf16.h"
+#include "cmemory.h"
+#include "uassert.h"
+#include "ucase.h"
+#include "ucln_in.h"
+#include "umutex.h"
+#include "uvector.h"
+#include "uvectr32.h"
+#include "uvectr64.h"
+#include "regeximp.h"
+#include "regexst.h"
+#include "regexnfa.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Counted loops are unrolled, so a pattern like (abc){1,5000} produces
+// a large NFA. Patterns that would need more states than this are left
+// to the backtracking matcher.
+constexpr int32_t kMaxStatesPerPattern = 10000;
+
+// Limit on the nesting of counted loops, to bound the recursion.
+constexpr int32_t kMaxLoopDepth = 32;
+
+// Limit on the capture group slots of all of a RegexDFA's threads together.
+constexpr int32_t kMaxThreadSlots = 1 << 18;
+
+// Limit on the progress bits that a state's behaviour can depend on, so that a
+// RegexDFA visits each state at most 1 << kMaxDedupeBits times per input position.
+constexpr int32_t kMaxDedupeBits = 4;
+
+// Code points whose full case folding is a string of more than one
+// code point, like U+00DF sharp s -> "ss".
+UnicodeSet *gFoldExpansionChars = nullptr;
+UInitOnce gFoldExpansionCharsInitOnce {};
+
+UBool U_CALLCONV regexnfa_cleanup() {
+    delete gFoldExpansionChars;
+    gFoldExpansionChars = nullptr;
+    gFoldExpansionCharsInitOnce.reset();
+    return true;
+}
+
+void U_CALLCONV initFoldExpansionChars(UErrorCode &status) {
+    ucln_i18n_registerCleanup(UCLN_I18N_REGEX_NFA, regexnfa_cleanup);
+    // Not Changes_When_Casefolded, which is false for characters like U+1FE7
+    // whose NFD is already case folded.
+    UnicodeSet changes;
+    changes.applyIntPropertyValue(UCHAR_CASE_SENSITIVE, 1, status);
+    LocalPointer<UnicodeSet> expansions(new UnicodeSet(), status);
+    if (U_FAILURE(status)) {
+        return;
+    }
+    for (int32_t r = 0; r < changes.getRangeCount(); ++r) {
+        UChar32 end = changes.getRangeEnd(r);
+        for (UChar32 c = changes.getRangeStart(r); c <= end; ++c) {
+            const char16_t *s;
+            int32_t length = ucase_toFullFolding(c, &s, U_FOLD_CASE_DEFAULT);
+            // Same interpretation of the result as in CaseFoldingUCharIterator.
+            if (length >= 0 && length < UCASE_MAX_STRING_LENGTH && u_countChar32(s, length) > 1) {
+                expansions->add(c);
+            }
+        }
+    }
+    expansions->freeze();
+    gFoldExpansionChars = expansions.orphan();
+}
+
+inline UBool isLineTerminator(UChar32 c) {
+    if (c & ~(0x0a | 0x0b | 0x0c | 0x0d | 0x85 | 0x2028 | 0x2029)) {
+        return false;
+    }
+    return (c<=0x0d && c>=0x0a) || c==0x85 || c==0x2028 || c==0x2029;
+}
+
+// The full case folding of c if it is a single code point, otherwise -1.
+UChar32 foldToCodePoint(UChar32 c) {
+    const char16_t *s;
+    int32_t length = ucase_toFullFolding(c, &s, U_FOLD_CASE_DEFAULT);
+    if (length < 0) {
+        return ~length;
+    }
+    if (length >= UCASE_MAX_STRING_LENGTH) {
+        return length;
+    }
+    if (length > 0) {
+        int32_t i = 0;
+        UChar32 folded;
+        U16_NEXT(s, i, length, folded);
+        if (i == length) {
+            return folded;
+        }
+    }
+    return -1;
+}
+
+inline UBool isWordCombining(UChar32 c) {
+    return u_hasBinaryProperty(c, UCHAR_GRAPHEME_EXTEND) || u_charType(c) == U_FORMAT_CHAR;
+}
+
+}  // namespace
+
+/**
+ * Working memory for RegexNFA::matchAll(): the current and next thread lists,
+ * as sparse sets of states, and the stack for following epsilon transitions.
+ * The sparse arrays are zeroed once; after that, clearing a list is O(1).
+ * The consuming states of each list are also collected separately,
+ * so that advancing over a code point need not skip the epsilon states.
+ */
+struct RegexNFAScratch : public UMemory {
+    int32_t              fCapacity = 0;
+    LocalMemory<int32_t> fDense[2];
+    LocalMemory<int32_t> fSparse[2];
+    int32_t              fSize[2] = {0, 0};
+    LocalMemory<int32_t> fConsuming[2];
+    int32_t              fConsumingSize[2] = {0, 0};
+    LocalMemory<int32_t> fStack;
+    int32_t              fFound = 0;
+
+    UBool init(int32_t capacity) {
+        fCapacity = capacity;
+        return fDense[0].allocateInsteadAndReset(capacity) != nullptr &&
+            fDense[1].allocateInsteadAndReset(capacity) != nullptr &&
+            fSparse[0].allocateInsteadAndReset(capacity) != nullptr &&
+            fSparse[1].allocateInsteadAndReset(capacity) != nullptr &&
+            fConsuming[0].allocateInsteadAndReset(capacity) != nullptr &&
+            fConsuming[1].allocateInsteadAndReset(capacity) != nullptr &&
+            fStack.allocateInsteadAndReset(2 * capacity + 1) != nullptr;
+    }
+
+    inline void clear(int32_t list) {
+        fSize[list] = 0;
+        fConsumingSize[list] = 0;
+    }
+
+    inline UBool contains(int32_t list, int32_t state) const {
+        uint32_t i = static_cast<uint32_t>(fSparse[list][state]);
+        return i < static_cast<uint32_t>(fSize[list]) && fDense[list][i] == state;
+    }
+
+    inline void add(int32_t list, int32_t state) {
+        fSparse[list][state] = fSize[list];
+        fDense[list][fSize[list]++] = state;
+    }
+};
+
+RegexNFA::RegexNFA() :
+        fStateCount(0), fPatternStateStart(0), fPatternIndex(0),
+        fUnsupported(false), fBuildStatus(U_ZERO_ERROR), fProgressBitCount(0),
+        fPatternCount(0), fSeedAlwaysCount(0), fSeedAtStartCount(0), fSeedAtLineCount(0),
+        fSeedNonLatin1Count(0), fDedupeSlotCount(0), fByteClassCount(0), fCachedScratch(nullptr) {
+    uprv_memset(fSeedLatin1Start, 0, sizeof(fSeedLatin1Start));
+    uprv_memset(fByteClass, 0, sizeof(fByteClass));
+}
+
+RegexNFA::~RegexNFA() {
+    delete fCachedScratch.load();
+}
+
+//------------------------------------------------------------------------------
+//
+//   Building the NFA
+//
+//------------------------------------------------------------------------------
+
+int32_t RegexNFA::newState(int32_t type, int32_t next, int32_t value) {
+    if (fUnsupported) {
+        return -1;
+    }
+    if (fStateCount - fPatternStateStart >= kMaxStatesPerPattern) {
+        fUnsupported = true;
+        return -1;
+    }
+    if (fStateCount == fStates.getCapacity() &&
+            fStates.resize(2 * fStates.getCapacity(), fStateCount) == nullptr) {
+        fBuildStatus = U_MEMORY_ALLOCATION_ERROR;
+        fUnsupported = true;
+        return -1;
+    }
+    RegexNFAState &state = fStates[fStateCount];
+    state.fType = type;
+    state.fNext = next;
+    state.fAlt = -1;
+    state.fValue = value;
+    state.fPattern = fPatternIndex;
+    state.fSet = nullptr;
+    state.fSet8 = nullptr;
+    return fStateCount++;
+}
+
+void RegexNFA::setState(int32_t state, int32_t type, int32_t next, int32_t alt, int32_t value) {
+    if (state >= 0) {
+        RegexNFAState &s = fStates[state];
+        s.fType = type;
+        s.fNext = next;
+        s.fAlt = alt;
+        s.fValue = value;
+    }
+}
+
+void RegexNFA::setSet(int32_t state, const UnicodeSet *set, Regex8BitSet *set8) {
+    if (state >= 0) {
+        fStates[state].fSet = set;
+        fStates[state].fSet8 = set8;
+    }
+}
+
+//
+//  progressBit   The progress bit for the loop whose saved input position is
+//                at frameSlot in the matcher's stack frame.
+//
+int32_t RegexNFA::progressBit(int32_t frameSlot) {
+    for (int32_t bit = 0; bit < fProgressBitCount; ++bit) {
+        if (fProgressSlots[bit] == frameSlot) {
+            return bit;
+        }
+    }
+    if (fProgressBitCount == MAX_PROGRESS_BITS) {
+        fUnsupported = true;
+        return 0;
+    }
+    fProgressSlots[fProgressBitCount] = frameSlot;
+    return fProgressBitCount++;
+}
+
+//
+//  groupIndex    The index of the capture group whose variables are at
+//                frameSlot in the matcher's stack frame.
+//
+int32_t RegexNFA::groupIndex(const RegexPattern &pattern, int32_t frameSlot) {
+    for (int32_t i = 0; i < pattern.fGroupMap->size(); ++i) {
+        if (pattern.fGroupMap->elementAti(i) == frameSlot) {
+            return i;
+        }
+    }
+    fUnsupported = true;
+    return 0;
+}
+
+//
+//  emitString   A literal string from URX_STRING or URX_STRING_I.
+//               Case insensitive strings have already been case folded by the
+//               compiler, and are matched against the full case folding of the
+//               input, as in CaseFoldingUCharIterator.  A code point of input
+//               may fold to several code points of the string, so each
+//               position in the string gets a choice between one code point
+//               that folds to the string's code point at that position and
+//               the characters whose folding expands to the string's next few
+//               code points.
+//
+int32_t RegexNFA::emitString(const RegexPattern &pattern, int32_t start, int32_t length,
+                             UBool caseInsensitive, int32_t cont) {
+    const char16_t *s = pattern.fLiteralText.getBuffer() + start;
+    for (int32_t i = 0; i < length;) {
+        UChar32 c;
+        U16_NEXT(s, i, length, c);
+        if (U_IS_SURROGATE(c)) {
+            // RegexMatcher compares strings by code units, and an unpaired
+            // surrogate could match half of a surrogate pair.
+            fUnsupported = true;
+            return -1;
+        }
+    }
+    if (!caseInsensitive) {
+        int32_t next = cont;
+        for (int32_t i = length; i > 0;) {
+            UChar32 c;
+            U16_PREV(s, 0, i, c);
+            next = newState(NFA_CHAR, next, c);
+        }
+        return next;
+    }
+
+    umtx_initOnce(gFoldExpansionCharsInitOnce, &initFoldExpansionChars, fBuildStatus);
+    if (U_FAILURE(fBuildStatus)) {
+        fUnsupported = true;
+        return -1;
+    }
+    MaybeStackArray<int32_t, 32> entries;    // State for each code unit offset in s.
+    if (length + 1 > entries.getCapacity() && entries.resize(length + 1) == nullptr) {
+        fBuildStatus = U_MEMORY_ALLOCATION_ERROR;
+        fUnsupported = true;
+        return -1;
+    }
+    entries[length] = cont;
+    for (int32_t i = length; i > 0;) {
+        int32_t limit = i;
+        UChar32 c;
+        U16_PREV(s, 0, i, c);
+        int32_t entry = newState(NFA_CHAR_FOLD, entries[limit], c);
+        const UnicodeSet &expansionChars = *gFoldExpansionChars;
+        for (int32_t r = 0; r < expansionChars.getRangeCount(); ++r) {
+            UChar32 end = expansionChars.getRangeEnd(r);
+            for (UChar32 e = expansionChars.getRangeStart(r); e <= end; ++e) {
+                const char16_t *folding;
+                int32_t foldingLength = ucase_toFullFolding(e, &folding, U_FOLD_CASE_DEFAULT);
+                if (foldingLength <= length - i &&
+                        uprv_memcmp(s + i, folding, foldingLength * U_SIZEOF_UCHAR) == 0) {
+                    int32_t expansion = newState(NFA_CHAR, entries[i + foldingLength], e);
+                    int32_t split = newState(NFA_SPLIT, entry, 0);
+                    setState(split, NFA_SPLIT, entry, expansion, 0);
+                    entry = split;
+                }
+            }
+        }
+        entries[i] = entry;
+    }
+    return entries[0];
+}
+
+//
+//  emitCountedLoop   A {min,max} loop, from a URX_CTR_INIT or URX_CTR_INIT_NG at loc.
+//                    The loop body is copied min times, followed by either
+//                    max-min optional copies, or a single repeating copy if
+//                    there is no maximum.
+//                    The backtracking matcher stops a loop with no maximum when an
+//                    iteration after the first min does not advance the input,
+//                    which the NFA_MARK at the loop entry and the NFA_CHECK
+//                    after each iteration mirror.
+//
+int32_t RegexNFA::emitCountedLoop(const RegexPattern &pattern, int32_t loc,
+                                  int32_t cont, int32_t depth) {
+    const UVector64 &code = *pattern.fCompiledPat;
+    int32_t initOp = static_cast<int32_t>(code.elementAti(loc));
+    UBool greedy = URX_TYPE(initOp) == URX_CTR_INIT;
+    int32_t loopLoc = URX_VAL(code.elementAti(loc + 1));
+    int32_t minCount = static_cast<int32_t>(code.elementAti(loc + 2));
+    int32_t maxCount = static_cast<int32_t>(code.elementAti(loc + 3));
+    int32_t bodyStart = loc + 4;
+    if (depth > kMaxLoopDepth || minCount < 0 || (maxCount != -1 && maxCount < minCount) ||
+            loopLoc < bodyStart || loopLoc >= code.size()) {
+        fUnsupported = true;
+        return -1;
+    }
+    int32_t loopOp = static_cast<int32_t>(code.elementAti(loopLoc));
+    if (URX_TYPE(loopOp) != (greedy ? URX_CTR_LOOP : URX_CTR_LOOP_NG) || URX_VAL(loopOp) != loc) {
+        fUnsupported = true;
+        return -1;
+    }
+    int64_t copies = maxCount == -1 ? static_cast<int64_t>(minCount) + 1 : maxCount;
+    if (copies * (loopLoc - bodyStart) > kMaxStatesPerPattern) {
+        fUnsupported = true;
+        return -1;
+    }
+
+    int32_t next = cont;
+    int32_t progress = -1;
+    if (maxCount == -1) {
+        // The input position at the loop entry is saved in the frame slot after the counter.
+        progress = progressBit(URX_VAL(initOp) + 1);
+        int32_t loop = newState(NFA_SPLIT, -1, 0);
+        int32_t check = newState(NFA_CHECK, loop, progress);
+        int32_t body = emitRange(pattern, bodyStart, loopLoc, check, depth + 1);
+        if (greedy) {
+            setState(loop, NFA_SPLIT, body, cont, 0);
+        } else {
+            setState(loop, NFA_SPLIT, cont, body, 0);
+        }
+        setState(check, NFA_CHECK, loop, cont, progress);
+        next = minCount == 0 ? loop : check;
+    } else {
+        for (int32_t i = minCount; i < maxCount && !fUnsupported; ++i) {
+            int32_t body = emitRange(pattern, bodyStart, loopLoc, next, depth + 1);
+            next = newState(NFA_SPLIT, -1, 0);
+            if (greedy) {
+                setState(next, NFA_SPLIT, body, cont, 0);
+            } else {
+                setState(next, NFA_SPLIT, cont, body, 0);
+            }
+        }
+    }
+    for (int32_t i = 0; i < minCount && !fUnsupported; ++i) {
+        next = emitRange(pattern, bodyStart, loopLoc, next, depth + 1);
+    }
+    if (progress >= 0) {
+        next = newState(NFA_MARK, next, progress);
+    }
+    return fUnsupported ? -1 : next;
+}
+
+//
+//  emitRange   Translates the ops at [start, limit) of the compiled pattern.
+//              Each op location that is executed or jumped to gets an entry state;
+//              control that reaches limit continues with the cont state.
+//              Returns the entry state for start.
+//
+int32_t RegexNFA::emitRange(const RegexPattern &pattern, int32_t start, int32_t limit,
+                            int32_t cont, int32_t depth) {
+    if (fUnsupported) {
+        return -1;
+    }
+    const UVector64 &code = *pattern.fCompiledPat;
+    int32_t rangeLength = limit - start;
+    MaybeStackArray<int32_t, 64> entries;   // Entry state for each location, or -1.
+    MaybeStackArray<UBool, 64> done;        // Whether the op at each location was translated.
+    if (rangeLength > entries.getCapacity() &&
+            (entries.resize(rangeLength) == nullptr || done.resize(rangeLength) == nullptr)) {
+        fBuildStatus = U_MEMORY_ALLOCATION_ERROR;
+        fUnsupported = true;
+        return -1;
+    }
+    for (int32_t i = 0; i < rangeLength; ++i) {
+        entries[i] = -1;
+        done[i] = false;
+    }
+
+    // The state for a jump target, allocated as a placeholder
+    // the first time that the location is referenced.
+    auto target = [&](int32_t loc) -> int32_t {
+        if (loc == limit) {
+            return cont;
+        }
+        if (loc < start || loc > limit) {
+            fUnsupported = true;
+            return -1;
+        }
+        if (entries[loc - start] < 0) {
+            entries[loc - start] = newState(NFA_NOP, -1, 0);
+        }
+        return entries[loc - start];
+    };
+
+    RegexStaticSets *staticSets = RegexStaticSets::gStaticSets;
+    for (int32_t loc = start; loc < limit && !fUnsupported;) {
+        int32_t op = static_cast<int32_t>(code.elementAti(loc));
+        int32_t opType = URX_TYPE(op);
+        int32_t opValue = URX_VAL(op);
+        int32_t here = target(loc);
+        done[loc - start] = true;
+        int32_t nextLoc = loc + 1;
+
+        switch (opType) {
+        case URX_NOP:
+            setState(here, NFA_NOP, target(nextLoc), -1, 0);
+            break;
+
+        case URX_STO_INP_LOC:
+            // STO_INP_LOC and the following JMPX or JMP_SAV_X stop (x)* loops
+            // with a possibly empty x from looping without advancing the input.
+            setState(here, NFA_MARK, target(nextLoc), -1, progressBit(opValue));
+            break;
+
+        case URX_START_CAPTURE:
+            setState(here, NFA_SAVE, target(nextLoc), -1, groupIndex(pattern, opValue) * 2);
+            break;
+
+        case URX_END_CAPTURE:
+            setState(here, NFA_SAVE, target(nextLoc), -1, groupIndex(pattern, opValue) * 2 + 1);
+            break;
+
+        case URX_JMP:
+            setState(here, NFA_NOP, target(opValue), -1, 0);
+            break;
+
+        case URX_JMPX:
+            {
+                // Jump if the loop made progress, otherwise fail.
+                nextLoc = loc + 2;
+                if (nextLoc > limit) {
+                    fUnsupported = true;
+                    break;
+                }
+                int32_t dataLoc = URX_VAL(code.elementAti(loc + 1));
+                setState(here, NFA_CHECK, target(opValue), -1, progressBit(dataLoc));
+            }
+            break;
+
+        case URX_STATE_SAVE:
+            setState(here, NFA_SPLIT, target(nextLoc), target(opValue), 0);
+            break;
+
+        case URX_JMP_SAV:
+            setState(here, NFA_SPLIT, target(opValue), target(nextLoc), 0);
+            break;
+
+        case URX_JMP_SAV_X:
+            {
+                // Loop back to just after the URX_STO_INP_LOC if the loop made progress,
+                // otherwise fall out of the loop.
+                int32_t stoOp = opValue > start ? static_cast<int32_t>(code.elementAti(opValue - 1)) : 0;
+                if (URX_TYPE(stoOp) != URX_STO_INP_LOC) {
+                    fUnsupported = true;
+                    break;
+                }
+                int32_t loop = newState(NFA_SPLIT, -1, 0);
+                setState(loop, NFA_SPLIT, target(opValue), target(nextLoc), 0);
+                setState(here, NFA_CHECK, loop, target(nextLoc), progressBit(URX_VAL(stoOp)));
+            }
+            break;
+
+        case URX_BACKTRACK:
+        case URX_FAIL:
+            setState(here, NFA_FAIL, -1, -1, 0);
+            break;
+
+        case URX_END:
+            setState(here, NFA_MATCH, -1, -1, 0);
+            break;
+
+        case URX_ONECHAR:
+            setState(here, NFA_CHAR, target(nextLoc), -1, opValue);
+            break;
+
+        case URX_ONECHAR_I:
+            setState(here, NFA_CHAR_I, target(nextLoc), -1, opValue);
+            break;
+
+        case URX_STRING:
+        case URX_STRING_I:
+            {
+                int32_t stringLen = URX_VAL(code.elementAti(loc + 1));
+                nextLoc = loc + 2;
+                int32_t first = emitString(pattern, opValue, stringLen,
+                                           opType == URX_STRING_I, target(nextLoc));
+                setState(here, NFA_NOP, first, -1, 0);
+            }
+            break;
+
+        case URX_SETREF:
+            setState(here, NFA_SET, target(nextLoc), -1, 0);
+            setSet(here, static_cast<const UnicodeSet *>(pattern.fSets->elementAt(opValue)),
+                   &pattern.fSets8[opValue]);
+            break;
+
+        case URX_STATIC_SETREF:
+        case URX_STAT_SETREF_N:
+            {
+                UBool negated = opType == URX_STAT_SETREF_N || (opValue & URX_NEG_SET) != 0;
+                int32_t setIndex = opValue & ~URX_NEG_SET;
+                setState(here, NFA_SET, target(nextLoc), -1, negated);
+                setSet(here, &staticSets->fPropSets[setIndex], &staticSets->fPropSets8[setIndex]);
+            }
+            break;
+
+        case URX_BACKSLASH_D:
+            setState(here, NFA_DIGIT, target(nextLoc), -1, opValue != 0);
+            break;
+
+        case URX_BACKSLASH_H:
+            setState(here, NFA_HSPACE, target(nextLoc), -1, opValue != 0);
+            break;
+
+        case URX_BACKSLASH_V:
+            setState(here, NFA_VSPACE, target(nextLoc), -1, opValue != 0);
+            break;
+
+        case URX_BACKSLASH_R:
+            // Any line terminator, with CR LF consumed together.
+            setState(here, NFA_VSPACE, newState(NFA_LF_AFTER_CR, target(nextLoc), 0), -1, 0);
+            break;
+
+        case URX_DOTANY:
+            setState(here, NFA_DOT, target(nextLoc), -1, 0);
+            break;
+
+        case URX_DOTANY_UNIX:
+            setState(here, NFA_DOT_UNIX, target(nextLoc), -1, 0);
+            break;
+
+        case URX_DOTANY_ALL:
+            setState(here, NFA_ANY, newState(NFA_LF_AFTER_CR, target(nextLoc), 0), -1, 0);
+            break;
+
+        case URX_CARET:
+            setState(here, NFA_TEXT_START, target(nextLoc), -1, 0);
+            break;
+
+        case URX_BACKSLASH_G:
+            setState(here, NFA_LAST_MATCH_END, target(nextLoc), -1, 0);
+            break;
+
+        case URX_CARET_M:
+            setState(here, NFA_LINE_START, target(nextLoc), -1, 0);
+            break;
+
+        case URX_CARET_M_UNIX:
+            setState(here, NFA_LINE_START_UNIX, target(nextLoc), -1, 0);
+            break;
+
+        case URX_DOLLAR:
+            setState(here, NFA_DOLLAR, target(nextLoc), -1, 0);
+            break;
+
+        case URX_DOLLAR_D:
+            setState(here, NFA_DOLLAR_UNIX, target(nextLoc), -1, 0);
+            break;
+
+        case URX_DOLLAR_M:
+            setState(here, NFA_LINE_END, target(nextLoc), -1, 0);
+            break;
+
+        case URX_DOLLAR_MD:
+            setState(here, NFA_LINE_END_UNIX, target(nextLoc), -1, 0);
+            break;
+
+        case URX_BACKSLASH_Z:
+            setState(here, NFA_TEXT_END, target(nextLoc), -1, 0);
+            break;
+
+        case URX_BACKSLASH_B:
+            setState(here, NFA_WORD_BOUNDARY, target(nextLoc), -1, opValue != 0);
+            break;
+
+        case URX_LOOP_SR_I:
+        case URX_LOOP_DOT_I:
+            {
+                // [set]* or .*, always followed by a URX_LOOP_C.
+                if (loc + 1 >= limit || URX_TYPE(code.elementAti(loc + 1)) != URX_LOOP_C) {
+                    fUnsupported = true;
+                    break;
+                }
+                nextLoc = loc + 2;
+                int32_t loop = here;
+                int32_t body;
+                if (opType == URX_LOOP_SR_I) {
+                    body = newState(NFA_SET, loop, 0);
+                    setSet(body, static_cast<const UnicodeSet *>(pattern.fSets->elementAt(opValue)),
+                           &pattern.fSets8[opValue]);
+                } else if ((opValue & 1) != 0) {
+                    // (?s).* skips straight to the end of the input, then backs up.
+                    loop = newState(NFA_SPLIT, -1, 0);
+                    setState(here, NFA_HIT_END, loop, -1, 0);
+                    body = newState(NFA_ANY, newState(NFA_LF_AFTER_CR, loop, 0), 0);
+                } else if ((opValue & 2) != 0) {
+                    body = newState(NFA_DOT_UNIX, loop, 0);
+                } else {
+                    body = newState(NFA_DOT, loop, 0);
+                }
+                setState(loop, NFA_SPLIT, body, target(nextLoc), 0);
+            }
+            break;
+
+        case URX_CTR_INIT:
+        case URX_CTR_INIT_NG:
+            {
+                int32_t loopLoc = URX_VAL(code.elementAti(loc + 1));
+                if (loopLoc < loc + 4 || loopLoc >= limit) {
+                    fUnsupported = true;
+                    break;
+                }
+                nextLoc = loopLoc + 1;
+                setState(here, NFA_NOP, emitCountedLoop(pattern, loc, target(nextLoc), depth), -1, 0);
+            }
+            break;
+
+        default:
+            // Back references, look-around, atomic and possessive constructs,
+            // \X, and \b with UREGEX_UWORD.
+            fUnsupported = true;
+            break;
+        }
+        loc = nextLoc;
+    }
+
+    // Every jump must have gone to the start of a translated op.
+    for (int32_t i = 0; i < rangeLength && !fUnsupported; ++i) {
+        if (entries[i] >= 0 && !done[i]) {
+            fUnsupported = true;
+        }
+    }
+    return fUnsupported ? -1 : target(start);
+}
+
+UBool RegexNFA::addPattern(const RegexPattern &pattern, int32_t index, UErrorCode &status) {
+    if (U_FAILURE(status) || U_FAILURE(pattern.fDeferredStatus)) {
+        return false;
+    }
+    fPatternStateStart = fStateCount;
+    fPatternIndex = index;
+    fUnsupported = false;
+    fBuildStatus = U_ZERO_ERROR;
+    fProgressBitCount = 0;
+    int32_t start = emitRange(pattern, 0, pattern.fCompiledPat->size(), -1, 0);
+    if (!fUnsupported && fPatternCount == fPatterns.getCapacity() &&
+            fPatterns.resize(2 * fPatterns.getCapacity(), fPatternCount) == nullptr) {
+        fBuildStatus = U_MEMORY_ALLOCATION_ERROR;
+        fUnsupported = true;
+    }
+    if (fUnsupported || start < 0) {
+        fStateCount = fPatternStateStart;
+        if (U_FAILURE(fBuildStatus)) {
+            status = fBuildStatus;
+        }
+        return false;
+    }
+    RegexNFAPattern &p = fPatterns[fPatternCount++];
+    p.fIndex = index;
+    p.fStart = start;
+    p.fStartType = pattern.fStartType;
+    p.fMinMatchLen = pattern.fMinMatchLen;
+    p.fInitialChar = pattern.fInitialChar;
+    p.fInitialChars = pattern.fInitialChars;
+    p.fUnixLines = (pattern.fFlags & UREGEX_UNIX_LINES) != 0;
+    p.fGroupCount = pattern.fGroupMap->size();
+    p.fHasEndAssertions = false;
+    for (int32_t i = fPatternStateStart; i < fStateCount; ++i) {
+        int32_t type = fStates[i].fType;
+        if (type == NFA_TEXT_END || type == NFA_DOLLAR || type == NFA_DOLLAR_UNIX ||
+                type == NFA_LINE_END || type == NFA_LINE_END_UNIX) {
+            p.fHasEndAssertions = true;
+        }
+    }
+    return true;
+}
+
+RegexNFA *RegexNFA::createForPattern(const RegexPattern &pattern, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    LocalPointer<RegexNFA> nfa(new RegexNFA(), status);
+    if (U_FAILURE(status) || !nfa->addPattern(pattern, 0, status)) {
+        return nullptr;
+    }
+    nfa->freeze(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    // Each thread of a RegexDFA keeps its own copy of the capture groups.
+    int32_t consuming = 0;
+    for (int32_t i = 0; i < nfa->fStateCount; ++i) {
+        if (nfa->fStates[i].fType <= NFA_LF_AFTER_CR) {
+            ++consuming;
+        }
+    }
+    if (static_cast<int64_t>(consuming) * (3 * nfa->fPatterns[0].fGroupCount + 1) > kMaxThreadSlots) {
+        return nullptr;
+    }
+    if (!nfa->computeDedupeSlots(status)) {
+        return nullptr;
+    }
+    nfa->computeByteClasses();
+    return nfa.orphan();
+}
+
+//
+//  computeDedupeSlots   For each state, the progress bits that can reach an NFA_CHECK
+//                       before the next input is consumed, without an NFA_MARK
+//                       resetting them first.  Two threads that reach a state with
+//                       the same values of those bits behave the same from there on,
+//                       so a RegexDFA keeps only the first one.  Each combination
+//                       of the bits gets its own slot in the RegexDFA's visited set.
+//
+UBool RegexNFA::computeDedupeSlots(UErrorCode &status) {
+    if (fDedupeMask.resize(fStateCount) == nullptr || fDedupeSlot.resize(fStateCount) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return false;
+    }
+    for (int32_t i = 0; i < fStateCount; ++i) {
+        fDedupeMask[i] = 0;
+    }
+    auto maskOf = [&](int32_t state) -> uint32_t {
+        return state >= 0 ? fDedupeMask[state] : 0;
+    };
+    for (UBool changed = fProgressBitCount > 0; changed;) {
+        changed = false;
+        for (int32_t i = fStateCount - 1; i >= 0; --i) {
+            const RegexNFAState &s = fStates[i];
+            uint32_t mask = 0;
+            switch (s.fType) {
+            case NFA_CHECK:
+                mask = static_cast<uint32_t>(1) << s.fValue;
+                mask |= maskOf(s.fAlt);
+                U_FALLTHROUGH;
+            case NFA_NOP:
+            case NFA_SAVE:
+            case NFA_HIT_END:
+            case NFA_LF_AFTER_CR:
+                mask |= maskOf(s.fNext);
+                break;
+            case NFA_SPLIT:
+                mask = maskOf(s.fNext) | maskOf(s.fAlt);
+                break;
+            case NFA_MARK:
+                mask = maskOf(s.fNext) & ~(static_cast<uint32_t>(1) << s.fValue);
+                break;
+            default:
+                if (s.fType >= NFA_TEXT_START) {
+                    mask = maskOf(s.fNext);
+                }
+                break;
+            }
+            if (mask != fDedupeMask[i]) {
+                fDedupeMask[i] = mask;
+                changed = true;
+            }
+        }
+    }
+    fDedupeSlotCount = 0;
+    for (int32_t i = 0; i < fStateCount; ++i) {
+        int32_t bitCount = 0;
+        for (uint32_t mask = fDedupeMask[i]; mask != 0; mask &= mask - 1) {
+            ++bitCount;
+        }
+        if (bitCount > kMaxDedupeBits) {
+            return false;
+        }
+        fDedupeSlot[i] = fDedupeSlotCount;
+        fDedupeSlotCount += 1 << bitCount;
+    }
+    return true;
+}
+
+//
+//  computeByteClasses   Partitions the Latin-1 characters into classes whose members
+//                       no consuming state, assertion or match start can tell apart,
+//                       so that a RegexDFA needs one transition per class, not per char.
+//
+void RegexNFA::computeByteClasses() {
+    uint8_t refined[256][2];
+    auto refine = [&](auto predicate) {
+        uprv_memset(refined, 0xff, sizeof(refined));
+        int32_t count = 0;
+        for (UChar32 c = 0; c < 0x100; ++c) {
+            uint8_t &cls = refined[fByteClass[c]][predicate(c) ? 1 : 0];
+            if (cls == 0xff) {
+                cls = static_cast<uint8_t>(count++);
+            }
+            fByteClass[c] = cls;
+        }
+        fByteClassCount = count;
+    };
+    fByteClassCount = 1;
+    for (int32_t i = 0; i < fStateCount && fByteClassCount < 0x100; ++i) {
+        const RegexNFAState &s = fStates[i];
+        if (s.fType < NFA_LF_AFTER_CR) {
+            refine([&](UChar32 c) { return matchesChar(s, c); });
+        }
+    }
+    const UnicodeSet &wordChars = RegexStaticSets::gStaticSets->fPropSets[URX_ISWORD_SET];
+    refine([](UChar32 c) { return c == 0x0a; });
+    refine([](UChar32 c) { return c == 0x0d; });
+    refine([](UChar32 c) { return isLineTerminator(c); });
+    refine([&](UChar32 c) { return wordChars.contains(c); });
+    refine([](UChar32 c) { return isWordCombining(c); });
+    const RegexNFAPattern &p = fPatterns[0];
+    if (p.fStartType == START_CHAR || p.fStartType == START_STRING) {
+        refine([&](UChar32 c) { return c == p.fInitialChar; });
+    } else if (p.fStartType == START_SET) {
+        refine([&](UChar32 c) { return p.fInitialChars->contains(c); });
+    }
+}
+
+//
+//  freeze   Sort the patterns by how RegexMatcher::find() picks the positions
+//           where it tries to match them.
+//
+void RegexNFA::freeze(UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+    int32_t capacity = fPatternCount > 0 ? fPatternCount : 1;
+    if (fSeedAlways.resize(capacity) == nullptr || fSeedAtStart.resize(capacity) == nullptr ||
+            fSeedAtLine.resize(capacity) == nullptr || fSeedNonLatin1.resize(capacity) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t latin1Count[256] = {};
+    int32_t latin1Total = 0;
+    for (int32_t slot = 0; slot < fPatternCount; ++slot) {
+        const RegexNFAPattern &p = fPatterns[slot];
+        switch (p.fStartType) {
+        case START_START:
+            fSeedAtStart[fSeedAtStartCount++] = slot;
+            break;
+        case START_LINE:
+            fSeedAtLine[fSeedAtLineCount++] = slot;
+            break;
+        case START_CHAR:
+        case START_STRING:
+            if (p.fInitialChar < 0x100) {
+                ++latin1Count[p.fInitialChar];
+                ++latin1Total;
+            } else {
+                fSeedNonLatin1[fSeedNonLatin1Count++] = slot;
+            }
+            break;
+        case START_SET:
+            for (UChar32 c = 0; c < 0x100; ++c) {
+                if (p.fInitialChars->contains(c)) {
+                    ++latin1Count[c];
+                    ++latin1Total;
+                }
+            }
+            if (!p.fInitialChars->containsNone(0x100, 0x10ffff)) {
+                fSeedNonLatin1[fSeedNonLatin1Count++] = slot;
+            }
+            break;
+        default:
+            fSeedAlways[fSeedAlwaysCount++] = slot;
+            break;
+        }
+    }
+
+    if (latin1Total > 0 && fSeedLatin1.resize(latin1Total) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    fSeedLatin1Start[0] = 0;
+    for (int32_t c = 0; c < 0x100; ++c) {
+        fSeedLatin1Start[c + 1] = fSeedLatin1Start[c] + latin1Count[c];
+        latin1Count[c] = fSeedLatin1Start[c];   // Next free index for c.
+    }
+    for (int32_t slot = 0; slot < fPatternCount; ++slot) {
+        const RegexNFAPattern &p = fPatterns[slot];
+        if (p.fStartType == START_CHAR || p.fStartType == START_STRING) {
+            if (p.fInitialChar < 0x100) {
+                fSeedLatin1[latin1Count[p.fInitialChar]++] = slot;
+            }
+        } else if (p.fStartType == START_SET) {
+            for (UChar32 c = 0; c < 0x100; ++c) {
+                if (p.fInitialChars->contains(c)) {
+                    fSeedLatin1[latin1Count[c]++] = slot;
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+//
+//   Matching
+//
+//------------------------------------------------------------------------------
+
+UBool RegexNFA::matchesChar(const RegexNFAState &s, UChar32 c) {
+    switch (s.fType) {
+    case NFA_CHAR:
+        return c == s.fValue;
+    case NFA_CHAR_I:
+        return u_foldCase(c, U_FOLD_CASE_DEFAULT) == s.fValue;
+    case NFA_CHAR_FOLD:
+        return foldToCodePoint(c) == s.fValue;
+    case NFA_SET:
+        return (c < 0x100 ? s.fSet8->contains(c) : s.fSet->contains(c)) != (s.fValue != 0);
+    case NFA_DIGIT:
+        return (u_charType(c) == U_DECIMAL_DIGIT_NUMBER) != (s.fValue != 0);
+    case NFA_HSPACE:
+        return (u_charType(c) == U_SPACE_SEPARATOR || c == 9) != (s.fValue != 0);
+    case NFA_VSPACE:
+        return isLineTerminator(c) != (s.fValue != 0);
+    case NFA_DOT:
+        return !isLineTerminator(c);
+    case NFA_DOT_UNIX:
+        return c != 0x0a;
+    case NFA_ANY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+UBool RegexNFA::assertionHolds(const RegexNFAState &s, const RegexNFAInput &input,
+                               int32_t pos, uint32_t &effects) {
+    const char16_t *text = input.fText;
+    switch (s.fType) {
+    case NFA_TEXT_START:
+        return pos == input.fAnchorStart;
+    case NFA_LAST_MATCH_END:
+        return pos == input.fLastMatchEnd;
+    case NFA_LINE_START:
+        return pos == input.fAnchorStart ||
+            (pos < input.fAnchorLimit && isLineTerminator(text[pos - 1]));
+    case NFA_LINE_START_UNIX:
+        return pos <= input.fAnchorStart || text[pos - 1] == 0x0a;
+    case NFA_TEXT_END:
+        if (pos >= input.fAnchorLimit) {
+            effects |= HIT_END | REQUIRE_END;
+            return true;
+        }
+        return false;
+    case NFA_DOLLAR:
+        // End of input, or before a line terminator (not the LF of a CR LF)
+        // or CR LF at the end of the input.
+        if (pos < input.fAnchorLimit - 2) {
+            return false;
+        }
+        if (pos >= input.fAnchorLimit) {
+            effects |= HIT_END | REQUIRE_END;
+            return true;
+        }
+        if (pos == input.fAnchorLimit - 1) {
+            UChar32 c;
+            U16_GET(text, input.fAnchorStart, pos, input.fAnchorLimit, c);
+            if (isLineTerminator(c) &&
+                    !(c == 0x0a && pos > input.fAnchorStart && text[pos - 1] == 0x0d)) {
+                effects |= HIT_END | REQUIRE_END;
+                return true;
+            }
+        } else if (text[pos] == 0x0d && text[pos + 1] == 0x0a) {
+            effects |= HIT_END | REQUIRE_END;
+            return true;
+        }
+        return false;
+    case NFA_DOLLAR_UNIX:
+        if (pos >= input.fAnchorLimit || (pos == input.fAnchorLimit - 1 && text[pos] == 0x0a)) {
+            effects |= HIT_END | REQUIRE_END;
+            return true;
+        }
+        return false;
+    case NFA_LINE_END:
+        if (pos >= input.fAnchorLimit) {
+            effects |= HIT_END | REQUIRE_END;
+            return true;
+        }
+        return isLineTerminator(text[pos]) &&
+            !(text[pos] == 0x0a && pos > input.fAnchorStart && text[pos - 1] == 0x0d);
+    case NFA_LINE_END_UNIX:
+        if (pos >= input.fAnchorLimit) {
+            effects |= HIT_END | REQUIRE_END;
+            return true;
+        }
+        return text[pos] == 0x0a;
+    case NFA_WORD_BOUNDARY:
+        {
+            // Same as RegexMatcher::isChunkWordBoundary().
+            UBool cIsWord = false;
+            if (pos >= input.fLookLimit) {
+                effects |= HIT_END;
+            } else {
+                UChar32 c;
+                U16_GET(text, input.fLookStart, pos, input.fLookLimit, c);
+                if (isWordCombining(c)) {
+                    return s.fValue != 0;
+                }
+                cIsWord = RegexStaticSets::gStaticSets->fPropSets[URX_ISWORD_SET].contains(c);
+            }
+            UBool prevCIsWord = false;
+            while (pos > input.fLookStart) {
+                UChar32 prevChar;
+                U16_PREV(text, input.fLookStart, pos, prevChar);
+                if (!isWordCombining(prevChar)) {
+                    prevCIsWord = RegexStaticSets::gStaticSets->fPropSets[URX_ISWORD_SET].contains(prevChar);
+                    break;
+                }
+            }
+            return (cIsWord != prevCIsWord) != (s.fValue != 0);
+        }
+    default:
+        return false;
+    }
+}
+
+//
+//  addThread   Adds a state to a thread list, following epsilon transitions.
+//              Assertions are evaluated here, at the current input position.
+//              Whether a set only needs to know if each pattern matches, so
+//              the progress checks of NFA_CHECK are not needed: an extra
+//              iteration of a loop that consumed nothing can not change that.
+//
+void RegexNFA::addThread(RegexNFAScratch &scratch, int32_t list, int32_t state,
+                         const RegexNFAInput &input, int32_t pos, UBool *matched) const {
+    const char16_t *text = input.fText;
+    int32_t *stack = scratch.fStack.getAlias();
+    int32_t sp = 0;
+    stack[sp++] = state;
+    while (sp > 0) {
+        state = stack[--sp];
+        if (state < 0 || scratch.contains(list, state)) {
+            continue;
+        }
+        scratch.add(list, state);
+        const RegexNFAState &s = fStates[state];
+        UBool follow;
+        uint32_t effects = 0;
+        switch (s.fType) {
+        case NFA_NOP:
+        case NFA_SAVE:
+        case NFA_MARK:
+        case NFA_HIT_END:
+            follow = true;
+            break;
+        case NFA_SPLIT:
+        case NFA_CHECK:
+            stack[sp++] = s.fAlt;
+            follow = true;
+            break;
+        case NFA_MATCH:
+            if (!matched[s.fPattern]) {
+                matched[s.fPattern] = true;
+                ++scratch.fFound;
+            }
+            follow = false;
+            break;
+        case NFA_LF_AFTER_CR:
+            // Stays in the list to consume the LF if there is one; see matchAll().
+            follow = !(pos > 0 && text[pos - 1] == 0x0d && pos < input.fActiveLimit && text[pos] == 0x0a);
+            if (!follow) {
+                scratch.fConsuming[list][scratch.fConsumingSize[list]++] = state;
+            }
+            break;
+        case NFA_FAIL:
+            follow = false;
+            break;
+        default:
+            if (s.fType >= NFA_TEXT_START) {
+                follow = assertionHolds(s, input, pos, effects);
+            } else {
+                // Consuming states wait for the next code point.
+                scratch.fConsuming[list][scratch.fConsumingSize[list]++] = state;
+                follow = false;
+            }
+            break;
+        }
+        if (follow) {
+            stack[sp++] = s.fNext;
+        }
+    }
+}
+
+void RegexNFA::seed(RegexNFAScratch &scratch, int32_t list, const int32_t *slots, int32_t count,
+                    const RegexNFAInput &input, int32_t pos, UBool *matched) const {
+    for (int32_t i = 0; i < count; ++i) {
+        const RegexNFAPattern &p = fPatterns[slots[i]];
+        if (!matched[p.fIndex] && p.fMinMatchLen <= input.fActiveLimit - pos) {
+            addThread(scratch, list, p.fStart, input, pos, matched);
+        }
+    }
+}
+
+int32_t RegexNFA::matchAll(const char16_t *text, int32_t length, UBool stopAtFirst,
+                           UBool *matched, UErrorCode &status) const {
+    if (U_FAILURE(status) || fPatternCount == 0) {
+        return 0;
+    }
+    RegexNFAScratch *scratch = fCachedScratch.exchange(nullptr);
+    if (scratch == nullptr) {
+        scratch = new RegexNFAScratch();
+        if (scratch == nullptr || !scratch->init(fStateCount)) {
+            delete scratch;
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return 0;
+        }
+    }
+    RegexNFAInput input = {text, 0, length, 0, length, 0, length, 0};
+    scratch->fFound = 0;
+    int32_t stopCount = stopAtFirst ? 1 : fPatternCount;
+    int32_t current = 0;
+    scratch->clear(current);
+
+    for (int32_t pos = 0;;) {
+        // Start new match attempts at this position, where find() would try them.
+        if (pos == 0) {
+            seed(*scratch, current, fSeedAtStart.getAlias(), fSeedAtStartCount,
+                 input, pos, matched);
+        }
+        if (scratch->fConsumingSize[current] == 0 && fSeedAlwaysCount == 0) {
+            // No match attempt is under way.  Skip ahead to where one could start.
+            while (pos < length) {
+                char16_t u = text[pos];
+                if (u < 0x100 ? fSeedLatin1Start[u + 1] > fSeedLatin1Start[u] : fSeedNonLatin1Count > 0) {
+                    break;
+                }
+                if (fSeedAtLineCount > 0 && (pos == 0 || isLineTerminator(text[pos - 1]))) {
+                    break;
+                }
+                ++pos;
+            }
+        }
+        if (fSeedAtLineCount > 0) {
+            UChar32 prev = pos > 0 ? text[pos - 1] : 0;
+            UBool lineStart = pos == 0 ||
+                (isLineTerminator(prev) && !(prev == 0x0d && pos < length && text[pos] == 0x0a));
+            UBool unixLineStart = pos == 0 || prev == 0x0a;
+            for (int32_t i = 0; i < fSeedAtLineCount; ++i) {
+                const RegexNFAPattern &p = fPatterns[fSeedAtLine[i]];
+                if (p.fUnixLines ? unixLineStart : lineStart) {
+                    seed(*scratch, current, &fSeedAtLine[i], 1, input, pos, matched);
+                }
+            }
+        }
+        seed(*scratch, current, fSeedAlways.getAlias(), fSeedAlwaysCount,
+             input, pos, matched);
+        if (pos >= length || scratch->fFound >= stopCount) {
+            break;
+        }
+
+        int32_t nextPos = pos;
+        UChar32 c;
+        U16_NEXT(text, nextPos, length, c);
+        if (c < 0x100) {
+            seed(*scratch, current, fSeedLatin1.getAlias() + fSeedLatin1Start[c],
+                 fSeedLatin1Start[c + 1] - fSeedLatin1Start[c], input, pos, matched);
+        } else {
+            for (int32_t i = 0; i < fSeedNonLatin1Count; ++i) {
+                const RegexNFAPattern &p = fPatterns[fSeedNonLatin1[i]];
+                if (p.fStartType == START_SET ? p.fInitialChars->contains(c) : c == p.fInitialChar) {
+                    seed(*scratch, current, &fSeedNonLatin1[i], 1, input, pos, matched);
+                }
+            }
+        }
+        if (scratch->fFound >= stopCount) {
+            break;
+        }
+
+        // Advance all threads over c.
+        int32_t next = 1 - current;
+        scratch->clear(next);
+        const int32_t *threads = scratch->fConsuming[current].getAlias();
+        int32_t threadCount = scratch->fConsumingSize[current];
+        for (int32_t i = 0; i < threadCount && scratch->fFound < stopCount; ++i) {
+            const RegexNFAState &s = fStates[threads[i]];
+            if (matched[s.fPattern]) {
+                continue;
+            }
+            UBool isMatch = s.fType == NFA_LF_AFTER_CR ?
+                c == 0x0a && pos > 0 && text[pos - 1] == 0x0d : matchesChar(s, c);
+            if (isMatch) {
+                addThread(*scratch, next, s.fNext, input, nextPos, matched);
+            }
+        }
+        if (scratch->fFound >= stopCount) {
+            break;
+        }
+        current = next;
+        pos = nextPos;
+    }
+
+    int32_t found = scratch->fFound;
+    // Keep the scratch memory for the next call, unless another thread
+    // has put its own there in the meantime.
+    RegexNFAScratch *expected = nullptr;
+    if (!fCachedScratch.compare_exchange_strong(expected, scratch)) {
+        delete scratch;
+    }
+    return found;
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
@@ -0,0 +1,262 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//   file:  regexnfa.h
+//
+//           ICU Regular Expressions,
+//               Translation of compiled regular expression patterns into
+//               Thompson NFAs, and simulation of the NFA for several
+//               patterns at once.  Used by RegexSet, and, for single patterns,
+//               by RegexDFA.
+//
+//           Only patterns whose compiled form needs no backtracking state
+//           beyond the current pattern and input positions can be translated:
+//           anything with back references, look-around, atomic or possessive
+//           groups, \X or UREGEX_UWORD word boundaries is rejected, and must be
+//           matched with the backtracking RegexMatcher instead.
+//
+
+#ifndef REGEXNFA_H
+#define REGEXNFA_H
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include <atomic>
+
+#include "unicode/uobject.h"
+#include "cmemory.h"
+
+U_NAMESPACE_BEGIN
+
+class  RegexPattern;
+class  UnicodeSet;
+struct Regex8BitSet;
+struct RegexNFAScratch;
+class  RegexDFA;
+
+/**
+ * One state of a RegexNFA.
+ * Consuming states match one code point of input; all others are epsilon states.
+ */
+struct RegexNFAState {
+    int32_t       fType;     // One of RegexNFA::StateType.
+    int32_t       fNext;     // Following state, or -1.
+    int32_t       fAlt;      // For SPLIT, the second (lower priority) following state.
+    int32_t       fValue;    // Code point, negation flag, capture group or progress
+                             //   bit, depending on type.
+    int32_t       fPattern;  // The caller's index of the pattern that this state belongs to.
+    const UnicodeSet   *fSet;     // For NFA_SET, the set and its Latin-1 bit map.
+    Regex8BitSet       *fSet8;
+};
+
+/**
+ * Start-of-match information for one pattern in a RegexNFA,
+ * copied from the RegexPattern so that seeding mirrors RegexMatcher::find().
+ */
+struct RegexNFAPattern {
+    int32_t            fIndex;         // Caller's index for the pattern.
+    int32_t            fStart;         // Start state.
+    int32_t            fStartType;     // RegexPattern::fStartType
+    int32_t            fMinMatchLen;
+    UChar32            fInitialChar;
+    const UnicodeSet  *fInitialChars;
+    UBool              fUnixLines;
+    int32_t            fGroupCount;    // Number of capture groups.
+    UBool              fHasEndAssertions;  // Whether any $, \Z or \z states exist.
+};
+
+/**
+ * The input text, and the region bounds that RegexMatcher evaluates
+ * assertions against.  RegexSet matches the whole text.
+ */
+struct RegexNFAInput {
+    const char16_t    *fText;
+    int32_t            fActiveStart;
+    int32_t            fActiveLimit;
+    int32_t            fAnchorStart;   // For ^ and $.
+    int32_t            fAnchorLimit;
+    int32_t            fLookStart;     // For \b.
+    int32_t            fLookLimit;
+    int32_t            fLastMatchEnd;  // For \G.
+};
+
+class RegexNFA : public UMemory {
+public:
+    enum StateType {
+        // Consuming states.
+        NFA_CHAR,               // fValue is the code point.
+        NFA_CHAR_I,             // Simple case folding of the input equals fValue.
+        NFA_CHAR_FOLD,          // Full case folding of the input is the single code point fValue.
+        NFA_SET,                // Input is in fSet, or not if fValue != 0.
+        NFA_DIGIT,              // \d, or \D if fValue != 0.
+        NFA_HSPACE,             // \h, or \H if fValue != 0.
+        NFA_VSPACE,             // \v, or \V if fValue != 0.  Also the line terminators.
+        NFA_DOT,                // Anything but a line terminator.
+        NFA_DOT_UNIX,           // Anything but \n.
+        NFA_ANY,                // Anything.
+        NFA_LF_AFTER_CR,        // Consumes an LF that follows a just-consumed CR,
+                                //   otherwise an epsilon state.
+        // Epsilon states.
+        NFA_NOP,
+        NFA_SPLIT,              // Continue with both fNext and fAlt.
+        NFA_SAVE,               // Capture group boundary; fValue is the group index
+                                //   times two, plus one for the end of the group.
+        NFA_MARK,               // Sets progress bit fValue: no input consumed yet.
+        NFA_CHECK,              // If progress bit fValue is set, continue with fAlt,
+                                //   otherwise set it and continue with fNext.
+                                //   Stops (x)* loops with a possibly empty x after
+                                //   an iteration that consumed nothing.
+        NFA_HIT_END,            // Same as NOP, but sets RegexMatcher's hitEnd, as (?s).*
+                                //   does however much input it consumes.
+        NFA_MATCH,
+        NFA_FAIL,
+        // Assertions.
+        NFA_TEXT_START,         // ^ without MULTILINE, and \A.
+        NFA_LAST_MATCH_END,     // \G
+        NFA_LINE_START,         // ^ in MULTILINE mode.
+        NFA_LINE_START_UNIX,    // ^ in MULTILINE + UNIX_LINES mode.
+        NFA_TEXT_END,           // \z
+        NFA_DOLLAR,             // $ and \Z.
+        NFA_DOLLAR_UNIX,        // $ in UNIX_LINES mode.
+        NFA_LINE_END,           // $ in MULTILINE mode.
+        NFA_LINE_END_UNIX,      // $ in MULTILINE + UNIX_LINES mode.
+        NFA_WORD_BOUNDARY,      // \b, or \B if fValue != 0.
+        NFA_STATE_TYPE_COUNT
+    };
+
+    // Side effects of assertions, as RegexMatcher's hitEnd and requireEnd.
+    static constexpr uint32_t HIT_END = 1;
+    static constexpr uint32_t REQUIRE_END = 2;
+
+    // Limit on the number of (x)* loops with a possibly empty x in one pattern,
+    // one bit each for NFA_MARK and NFA_CHECK.
+    static constexpr int32_t MAX_PROGRESS_BITS = 32;
+
+    RegexNFA();
+    ~RegexNFA();
+
+    /**
+     * Translates the compiled pattern and adds it to the NFA.
+     * @param pattern the pattern
+     * @param index the caller's index for the pattern, reported by matchAll()
+     * @param status error code, set only for memory allocation errors
+     * @return true if the pattern was added, false if it cannot be
+     *         expressed as an NFA and has to be matched with a RegexMatcher
+     */
+    UBool addPattern(const RegexPattern &pattern, int32_t index, UErrorCode &status);
+
+    /**
+     * Builds the tables used to start matches.  Must be called after
+     * the last addPattern() and before the first matchAll().
+     */
+    void freeze(UErrorCode &status);
+
+    /** Number of patterns that were added. */
+    int32_t patternCount() const { return fPatternCount; }
+
+    /**
+     * Translates one compiled pattern, for matching it with a RegexDFA
+     * instead of the backtracking engine.
+     * @return the frozen NFA, or nullptr if the pattern cannot be translated
+     *         or if status is a failure.  The NFA refers to the pattern's sets,
+     *         and must not outlive it.
+     */
+    static RegexNFA *createForPattern(const RegexPattern &pattern, UErrorCode &status);
+
+    /**
+     * Whether consuming state s matches the code point c.
+     * NFA_LF_AFTER_CR is handled by the callers.
+     */
+    static UBool matchesChar(const RegexNFAState &s, UChar32 c);
+
+    /**
+     * Evaluates assertion state s at position pos of the input,
+     * the same way as RegexMatcher::MatchChunkAt(), adding HIT_END
+     * and REQUIRE_END to effects where the matcher would set them.
+     */
+    static UBool assertionHolds(const RegexNFAState &s, const RegexNFAInput &input,
+                                int32_t pos, uint32_t &effects);
+
+    /**
+     * Finds which patterns occur in the text.  For each added pattern
+     * that RegexMatcher::find() would find in the text, sets matched[index]
+     * to true, where index is the one that was passed to addPattern().
+     * Thread safe.
+     * @param text the input text
+     * @param length the length of the text
+     * @param stopAtFirst if true, return after the first pattern that matches
+     * @param matched array indexed by the patterns' indexes
+     * @param status error code
+     * @return the number of patterns that matched
+     */
+    int32_t matchAll(const char16_t *text, int32_t length, UBool stopAtFirst,
+                     UBool *matched, UErrorCode &status) const;
+
+private:
+    RegexNFA(const RegexNFA &other) = delete;
+    RegexNFA &operator=(const RegexNFA &other) = delete;
+
+    int32_t newState(int32_t type, int32_t next, int32_t value);
+    int32_t emitRange(const RegexPattern &pattern, int32_t start, int32_t limit,
+                      int32_t cont, int32_t depth);
+    int32_t emitCountedLoop(const RegexPattern &pattern, int32_t loc,
+                            int32_t cont, int32_t depth);
+    int32_t emitString(const RegexPattern &pattern, int32_t start, int32_t length,
+                       UBool caseInsensitive, int32_t cont);
+    void setState(int32_t state, int32_t type, int32_t next, int32_t alt, int32_t value);
+    void setSet(int32_t state, const UnicodeSet *set, Regex8BitSet *set8);
+    int32_t progressBit(int32_t frameSlot);
+    int32_t groupIndex(const RegexPattern &pattern, int32_t frameSlot);
+    UBool computeDedupeSlots(UErrorCode &status);
+    void computeByteClasses();
+    void addThread(RegexNFAScratch &scratch, int32_t list, int32_t state,
+                   const RegexNFAInput &input, int32_t pos, UBool *matched) const;
+    void seed(RegexNFAScratch &scratch, int32_t list, const int32_t *slots, int32_t count,
+              const RegexNFAInput &input, int32_t pos, UBool *matched) const;
+
+    MaybeStackArray<RegexNFAState, 64>    fStates;
+    int32_t                               fStateCount;
+    int32_t                               fPatternStateStart;   // First state of the pattern being added.
+    int32_t                               fPatternIndex;        // Index of the pattern being added.
+    UBool                                 fUnsupported;         // Set while adding a pattern that
+                                                                //   cannot be translated.
+    UErrorCode                            fBuildStatus;
+    int32_t                               fProgressSlots[MAX_PROGRESS_BITS];  // Frame slots of the
+    int32_t                               fProgressBitCount;  //   progress bits of the pattern being added.
+
+    MaybeStackArray<RegexNFAPattern, 8>   fPatterns;
+    int32_t                               fPatternCount;
+
+    // Patterns, by pattern slot, grouped by how find() chooses match start positions.
+    MaybeStackArray<int32_t, 8>           fSeedAlways;          // START_NO_INFO
+    int32_t                               fSeedAlwaysCount;
+    MaybeStackArray<int32_t, 8>           fSeedAtStart;         // START_START
+    int32_t                               fSeedAtStartCount;
+    MaybeStackArray<int32_t, 8>           fSeedAtLine;          // START_LINE
+    int32_t                               fSeedAtLineCount;
+    MaybeStackArray<int32_t, 8>           fSeedNonLatin1;       // START_CHAR/STRING/SET that may
+    int32_t                               fSeedNonLatin1Count;  //   start with a char >= 0x100.
+    MaybeStackArray<int32_t, 8>           fSeedLatin1;          // START_CHAR/STRING/SET patterns
+    int32_t                               fSeedLatin1Start[257];//   by initial Latin-1 char.
+
+    // For each state, the progress bits that its behaviour depends on, and its first
+    // slot in a RegexDFA's visited set.  Only computed by createForPattern().
+    MaybeStackArray<uint32_t, 64>         fDedupeMask;
+    MaybeStackArray<int32_t, 64>          fDedupeSlot;
+    int32_t                               fDedupeSlotCount;
+
+    // Partition of the Latin-1 characters into classes that no state, assertion
+    // or start of match tells apart.  Only computed by createForPattern().
+    uint8_t                               fByteClass[256];
+    int32_t                               fByteClassCount;
+
+    mutable std::atomic<RegexNFAScratch *> fCachedScratch;
+
+    friend class RegexDFA;
+};
+
+U_NAMESPACE_END
+#endif   // !UCONFIG_NO_REGULAR_EXPRESSIONS
+#endif   // REGEXNFA_H
@@ -0,0 +1,199 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+//  file:  regexset.cpp
+//
+//         Contains the implementation of class RegexSet,
+//         which matches many regular expressions in one pass over the input.
+//
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_REGULAR_EXPRESSIONS
+
+#include "unicode/regex.h"
+#include "cmemory.h"
+#include "uvector.h"
+#include "uvectr32.h"
+#include "regexnfa.h"
+
+U_NAMESPACE_BEGIN
+
+RegexSet::RegexSet() : fPatterns(nullptr), fFallback(nullptr), fNFA(nullptr) {
+}
+
+RegexSet::~RegexSet() {
+    delete fNFA;
+    delete fFallback;
+    delete fPatterns;
+}
+
+//---------------------------------------------------------------------
+//
+//   compile
+//
+//---------------------------------------------------------------------
+RegexSet * U_EXPORT2
+RegexSet::compile(const UnicodeString patterns[],
+                  int32_t              count,
+                  uint32_t             flags,
+                  UParseError          &pe,
+                  int32_t              &errorIndex,
+                  UErrorCode           &status)
+{
+    errorIndex = -1;
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    if (count < 0 || (patterns == nullptr && count > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return nullptr;
+    }
+
+    LocalPointer<RegexSet> set(new RegexSet(), status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    set->fPatterns = new UVector(uprv_deleteUObject, nullptr, count, status);
+    set->fFallback = new UVector32(status);
+    set->fNFA = new RegexNFA();
+    if (U_SUCCESS(status) &&
+            (set->fPatterns == nullptr || set->fFallback == nullptr || set->fNFA == nullptr)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+    }
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+
+    for (int32_t i = 0; i < count; ++i) {
+        RegexPattern *pattern = RegexPattern::compile(patterns[i], flags, pe, status);
+        if (U_FAILURE(status)) {
+            errorIndex = i;
+            return nullptr;
+        }
+        set->fPatterns->adoptElement(pattern, status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        if (!set->fNFA->addPattern(*pattern, i, status)) {
+            set->fFallback->addElement(i, status);
+        }
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+    }
+    set->fNFA->freeze(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return set.orphan();
+}
+
+//
+//   compile with no UParseErr parameter.
+//
+RegexSet * U_EXPORT2
+RegexSet::compile(const UnicodeString patterns[],
+                  int32_t              count,
+                  uint32_t             flags,
+                  UErrorCode           &status)
+{
+    UParseError pe;
+    int32_t errorIndex;
+    return compile(patterns, count, flags, pe, errorIndex, status);
+}
+
+int32_t RegexSet::size() const {
+    return fPatterns->size();
+}
+
+const RegexPattern *RegexSet::getPattern(int32_t index) const {
+    if (index < 0 || index >= fPatterns->size()) {
+        return nullptr;
+    }
+    return static_cast<const RegexPattern *>(fPatterns->elementAt(index));
+}
+
+//---------------------------------------------------------------------
+//
+//   matches, matchesAny
+//
+//---------------------------------------------------------------------
+int32_t RegexSet::matches(const UnicodeString &input, int32_t *dest, int32_t destCapacity,
+                          UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (destCapacity < 0 || (dest == nullptr && destCapacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int32_t count = fPatterns->size();
+    MaybeStackArray<UBool, 64> matched;
+    if (count > matched.getCapacity() && matched.resize(count) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    match(input, false, matched.getAlias(), status);
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int32_t length = 0;
+    for (int32_t i = 0; i < count; ++i) {
+        if (matched[i]) {
+            if (length < destCapacity) {
+                dest[length] = i;
+            }
+            ++length;
+        }
+    }
+    if (length > destCapacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
+UBool RegexSet::matchesAny(const UnicodeString &input, UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    MaybeStackArray<UBool, 64> matched;
+    if (fPatterns->size() > matched.getCapacity() && matched.resize(fPatterns->size()) == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return false;
+    }
+    return match(input, true, matched.getAlias(), status) > 0;
+}
+
+//
+//   match   Sets matched[i] for each pattern i that occurs in the input,
+//           and returns how many do.  The patterns that the NFA can handle
+//           are matched together, then each of the others with a RegexMatcher.
+//
+int32_t RegexSet::match(const UnicodeString &input, UBool stopAtFirst,
+                        UBool *matched, UErrorCode &status) const {
+    if (input.isBogus()) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uprv_memset(matched, 0, fPatterns->size() * sizeof(UBool));
+    int32_t found = fNFA->matchAll(input.getBuffer(), input.length(), stopAtFirst,
+                                   matched, status);
+    for (int32_t i = 0; i < fFallback->size() && !(stopAtFirst && found > 0); ++i) {
+        int32_t index = fFallback->elementAti(i);
+        LocalPointer<RegexMatcher> matcher(getPattern(index)->matcher(input, status));
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        if (matcher->find(status)) {
+            matched[index] = true;
+            ++found;
+        }
+    }
+    return U_SUCCESS(status) ? found : 0;
+}
+
+UOBJECT_DEFINE_RTTI_IMPLEMENTATION(RegexSet)
+
+U_NAMESPACE_END
+#endif  // !UCONFIG_NO_REGULAR_EXPRESSIONS
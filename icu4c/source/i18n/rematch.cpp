@@ -29,10 +29,13 @@
 #include "uvector.h"
 #include "uvectr32.h"
 #include "uvectr64.h"
+#include "regexdfa.h"
 #include "regeximp.h"
+#include "regexnfa.h"
 #include "regexst.h"
 #include "regextxt.h"
 #include "ucase.h"
+#include "ustr_imp.h"
 
 // #include <malloc.h>        // Needed for heapcheck testing
 
@@ -165,6 +168,7 @@ RegexMatcher::~RegexMatcher() {
         fPattern = nullptr;
     }
 
+    delete fDFA;
     delete fInput;
     if (fInputText) {
         utext_close(fInputText);
@@ -222,6 +226,9 @@ void RegexMatcher::init(UErrorCode &status) {
     fData              = fSmallData;
     fWordBreakItr      = nullptr;
     fGCBreakItr        = nullptr;
+    fDFA               = nullptr;
+    fRequiredFrom      = -1;
+    fRequiredLast      = -1;
 
     fStack             = nullptr;
     fInputText         = nullptr;
@@ -915,6 +922,28 @@ UBool RegexMatcher::find(int64_t start, UErrorCode &status) {
 }
 
 
+//--------------------------------------------------------------------------------
+//
+//   lastRequiredStart()   The start of the last occurrence in text[start, limit)
+//                         of any of the strings in required, which is in the form
+//                         of RegexPattern::fRequiredStrings.  -1 if there is none.
+//
+//--------------------------------------------------------------------------------
+static int32_t lastRequiredStart(const UnicodeString &required, const char16_t *text,
+                                 int32_t start, int32_t limit) {
+    int32_t result = -1;
+    for (int32_t i = 0; i < required.length(); i += 1 + required.charAt(i)) {
+        int32_t length = required.charAt(i);
+        const char16_t *found = u_strFindLast(text + start, limit - start,
+                                              required.getBuffer() + i + 1, length);
+        if (found != nullptr) {
+            result = uprv_max(result, static_cast<int32_t>(found - text));
+        }
+    }
+    return result;
+}
+
+
 //--------------------------------------------------------------------------------
 //
 //   findUsingChunk() -- like find(), but with the advance knowledge that the
@@ -970,6 +999,29 @@ UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
         return false;
     }
 
+    // A match must contain one of the pattern's required strings, if it has any,
+    //   so it cannot begin after the last of them.  Skipping start positions
+    //   would skip calls to the progress callbacks, so not when there are any.
+    if (!fPattern->fRequiredStrings.isEmpty() && fCallbackFn == nullptr &&
+            fFindProgressCallbackFn == nullptr) {
+        if (fRequiredFrom < 0 || startPos < fRequiredFrom) {
+            fRequiredFrom = startPos;
+            fRequiredLast = lastRequiredStart(fPattern->fRequiredStrings, inputBuf,
+                                              startPos, static_cast<int32_t>(fActiveLimit));
+        }
+        if (fRequiredLast < startPos) {
+            fMatch = false;
+            fHitEnd = true;
+            return false;
+        }
+        testLen = uprv_min(testLen, fRequiredLast);
+    }
+
+    if (startPos < fActiveLimit && useAutomaton()) {
+        MatchAutomatonAt(startPos, testLen, false, status);
+        return fMatch;
+    }
+
     UChar32  c;
     U_ASSERT(startPos >= 0);
 
@@ -1046,7 +1098,21 @@ UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
         // Match starts on exactly one char.
         U_ASSERT(fPattern->fMinMatchLen > 0);
         UChar32 theChar = fPattern->fInitialChar;
+        // Unless a progress callback needs to see each position, skip directly
+        //   to the next occurrence of a BMP initial char.
+        UBool skipToChar = fFindProgressCallbackFn == nullptr && U_IS_BMP(theChar) &&
+                           !U16_IS_SURROGATE(theChar);
         for (;;) {
+            if (skipToChar) {
+                const char16_t *next = u_memchr(inputBuf + startPos, static_cast<char16_t>(theChar),
+                                                testLen + 1 - startPos);
+                if (next == nullptr) {
+                    fMatch = false;
+                    fHitEnd = true;
+                    return false;
+                }
+                startPos = static_cast<int32_t>(next - inputBuf);
+            }
             int32_t pos = startPos;
             U16_NEXT(inputBuf, startPos, fActiveLimit, c);  // like c = inputBuf[startPos++];
             if (c == theChar) {
@@ -1080,6 +1146,12 @@ UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
             if (fMatch) {
                 return true;
             }
+            if (startPos >= testLen) {
+                // Also keeps an empty input, whose chunk may be unset, from being read.
+                fMatch = false;
+                fHitEnd = true;
+                return false;
+            }
             U16_FWD_1(inputBuf, startPos, fActiveLimit);
         }
 
@@ -1150,6 +1222,86 @@ UBool RegexMatcher::findUsingChunk(UErrorCode &status) {
 }
 
 
+//--------------------------------------------------------------------------------
+//
+//   useAutomaton()   Whether the pattern's RegexNFA, rather than the backtracking
+//                    engine, can be used with the input in the UText's chunk buffer.
+//                    Time limits and callbacks are only implemented by the
+//                    backtracking engine.  A region that starts or ends inside
+//                    a surrogate pair also goes to the backtracking engine, which
+//                    steps over the region bounds there in some cases.
+//
+//--------------------------------------------------------------------------------
+UBool RegexMatcher::useAutomaton() {
+    if (fPattern->fNFA == nullptr || fTimeLimit > 0 || fCallbackFn != nullptr ||
+            fFindProgressCallbackFn != nullptr) {
+        return false;
+    }
+    const char16_t *inputBuf = fInputText->chunkContents;
+    if (fActiveLimit > 0 && U16_IS_LEAD(inputBuf[fActiveLimit - 1])) {
+        return false;
+    }
+    return fActiveStart == 0 || fActiveStart >= fInputLength ||
+        !U16_IS_TRAIL(inputBuf[fActiveStart]) || !U16_IS_LEAD(inputBuf[fActiveStart - 1]);
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   MatchAutomatonAt()   MatchChunkAt(), for patterns that have a RegexNFA.
+//                        With testLen >= 0, does the rest of findUsingChunk() instead:
+//                        finds the first match starting between startIdx and testLen.
+//                        Either way, in time linear in the length of the input.
+//
+//--------------------------------------------------------------------------------
+void RegexMatcher::MatchAutomatonAt(int32_t startIdx, int32_t testLen, UBool toEnd,
+                                    UErrorCode &status) {
+    if (fDFA == nullptr) {
+        LocalPointer<RegexDFA> dfa(new RegexDFA(*fPattern->fNFA, status), status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        fDFA = dfa.orphan();
+    }
+    RegexNFAInput input = {
+        fInputText->chunkContents,
+        static_cast<int32_t>(fActiveStart), static_cast<int32_t>(fActiveLimit),
+        static_cast<int32_t>(fAnchorStart), static_cast<int32_t>(fAnchorLimit),
+        static_cast<int32_t>(fLookStart), static_cast<int32_t>(fLookLimit),
+        fMatch ? static_cast<int32_t>(fMatchEnd) : static_cast<int32_t>(fActiveStart)};
+    UBool isMatch = testLen >= 0 ?
+        fDFA->find(input, startIdx, testLen, status) : fDFA->matchAt(input, startIdx, toEnd, status);
+
+    fFrameSize = fPattern->fFrameSize;
+    REStackFrame *fp = resetStack();
+    if (U_FAILURE(fDeferredStatus)) {
+        status = fDeferredStatus;
+    }
+    if (U_FAILURE(status)) {
+        fMatch = false;
+        return;
+    }
+    fMatch = isMatch;
+    if (isMatch) {
+        fLastMatchEnd = fMatchEnd;
+        fMatchStart   = fDFA->matchStart();
+        fMatchEnd     = fDFA->matchEnd();
+        for (int32_t group = 1; group <= fPattern->fGroupMap->size(); ++group) {
+            int32_t groupOffset = fPattern->fGroupMap->elementAti(group - 1);
+            fp->fExtra[groupOffset]     = fDFA->groupStart(group);
+            fp->fExtra[groupOffset + 1] = fDFA->groupEnd(group);
+        }
+    }
+    if (fDFA->effects() & RegexNFA::HIT_END) {
+        fHitEnd = true;
+    }
+    if (fDFA->effects() & RegexNFA::REQUIRE_END) {
+        fRequireEnd = true;
+    }
+    fFrame = fp;                // Holds the capture groups, as after MatchChunkAt().
+}
+
+
 
 //--------------------------------------------------------------------------------
 //
@@ -1845,6 +1997,7 @@ void RegexMatcher::resetPreserveRegion() {
     fRequireEnd     = false;
     fTime           = 0;
     fTickCounter    = TIMER_INITIAL_VALUE;
+    fRequiredFrom   = -1;
     //resetStack(); // more expensive than it looks...
 }
 
@@ -2550,12 +2703,12 @@ UBool RegexMatcher::isWordBoundary(int64_t pos) {
     UBool isBoundary = false;
     UBool cIsWord    = false;
 
+    UTEXT_SETNATIVEINDEX(fInputText, pos);
     if (pos >= fLookLimit) {
         fHitEnd = true;
     } else {
         // Determine whether char c at current position is a member of the word set of chars.
         // If we're off the end of the string, behave as though we're not at a word char.
-        UTEXT_SETNATIVEINDEX(fInputText, pos);
         UChar32  c = UTEXT_CURRENT32(fInputText);
         if (u_hasBinaryProperty(c, UCHAR_GRAPHEME_EXTEND) || u_charType(c) == U_FORMAT_CHAR) {
             // Current char is a combining one.  Not a boundary.
@@ -2780,6 +2933,192 @@ UnicodeString StringFromUText(UText *ut) {
 #endif // REGEX_DEBUG
 
 
+//--------------------------------------------------------------------------------
+//
+//   UTF16ChunkText, UTF8Text    The input text for MatchChunkAt(): either the
+//                               UText's chunk buffer, when it holds the entire
+//                               input, or the string of a UText opened with
+//                               utext_openUTF8().  Indexes are native indexes
+//                               either way, so the UTF-8 matches are found
+//                               at byte offsets.
+//
+//                               Character reads use the given limit; the
+//                               backward steps stop at the start of the text.
+//
+//--------------------------------------------------------------------------------
+namespace {
+
+class UTF16ChunkText {
+public:
+    // A lookbehind match of n UTF-16 units is at most this many times n units long.
+    static constexpr int32_t kMaxLengthPerUTF16 = 1;
+    // The longest line ending.
+    static constexpr int32_t kMaxLineEndLength = 2;
+    static constexpr bool kIsUTF16 = true;
+
+    explicit UTF16ChunkText(const char16_t *chars) : fChars(chars) {}
+
+    const char16_t *units() const { return fChars; }
+    UChar32 unitAt(int64_t i) const { return fChars[i]; }
+    // The character at i for testing for line endings, which are all single units.
+    UChar32 lineCharAt(int64_t i, int64_t /*limit*/) const { return fChars[i]; }
+    UChar32 lineCharBefore(int64_t i) const { return fChars[i - 1]; }
+
+    UChar32 next(int64_t &i, int64_t limit) const {
+        UChar32 c;
+        U16_NEXT(fChars, i, limit, c);
+        return c;
+    }
+    void fwd1(int64_t &i, int64_t limit) const { U16_FWD_1(fChars, i, limit); }
+    UChar32 prev(int64_t &i) const {
+        UChar32 c;
+        U16_PREV(fChars, 0, i, c);
+        return c;
+    }
+    void back1(int64_t &i) const { U16_BACK_1(fChars, 0, i); }
+    void setCpStart(int64_t &i) const { U16_SET_CP_START(fChars, 0, i); }
+
+    // Matches the literal string s at i.  On success, advances i past it.
+    UBool matchString(int64_t &i, int64_t limit, const char16_t *s, int32_t length,
+                      UBool &hitEnd) const {
+        const char16_t *pInp = fChars + i;
+        const char16_t *pInpLimit = fChars + limit;
+        const char16_t *pEnd = pInp + length;
+        while (pInp < pEnd) {
+            if (pInp >= pInpLimit) {
+                hitEnd = true;
+                return false;
+            }
+            if (*pInp++ != *s++) {
+                return false;
+            }
+        }
+
+        // If the pattern string ends with an unpaired lead surrogate that
+        // matched the lead surrogate of a valid pair in the input text,
+        // this does not count as a match.
+        if (U16_IS_LEAD(*(pInp-1)) && pInp < pInpLimit && U16_IS_TRAIL(*(pInp))) {
+            return false;
+        }
+        i += length;
+        return true;
+    }
+
+    // Matches the text from groupStart to groupEnd at i.  On success, advances i past it.
+    UBool matchBackref(int64_t groupStart, int64_t groupEnd, int64_t &i, int64_t limit,
+                       UBool &hitEnd) const {
+        int64_t inputIndex = i;
+        for (int64_t groupIndex = groupStart; groupIndex < groupEnd; ++groupIndex,++inputIndex) {
+            if (inputIndex >= limit) {
+                hitEnd = true;
+                return false;
+            }
+            if (fChars[groupIndex] != fChars[inputIndex]) {
+                return false;
+            }
+        }
+        if (groupStart < groupEnd && U16_IS_LEAD(fChars[groupEnd-1]) &&
+                inputIndex < limit && U16_IS_TRAIL(fChars[inputIndex])) {
+            // Capture group ended with an unpaired lead surrogate.
+            // Back reference is not permitted to match lead only of a surrogatge pair.
+            return false;
+        }
+        i = inputIndex;
+        return true;
+    }
+
+private:
+    const char16_t *fChars;
+};
+
+class UTF8Text {
+public:
+    // A BMP character takes one UTF-16 unit and up to three bytes.
+    static constexpr int32_t kMaxLengthPerUTF16 = 3;
+    // U+2028 and U+2029 take three bytes.
+    static constexpr int32_t kMaxLineEndLength = 3;
+    static constexpr bool kIsUTF16 = false;
+
+    explicit UTF8Text(const uint8_t *bytes) : fBytes(bytes) {}
+
+    const uint8_t *units() const { return fBytes; }
+    UChar32 unitAt(int64_t i) const { return fBytes[i]; }
+    UChar32 lineCharAt(int64_t i, int64_t limit) const { return next(i, limit); }
+    UChar32 lineCharBefore(int64_t i) const { return prev(i); }
+
+    UChar32 next(int64_t &i, int64_t limit) const {
+        int32_t index = static_cast<int32_t>(i);
+        UChar32 c;
+        U8_NEXT_OR_FFFD(fBytes, index, limit, c);
+        i = index;
+        return c;
+    }
+    void fwd1(int64_t &i, int64_t limit) const {
+        int32_t index = static_cast<int32_t>(i);
+        U8_FWD_1(fBytes, index, limit);
+        i = index;
+    }
+    UChar32 prev(int64_t &i) const {
+        int32_t index = static_cast<int32_t>(i);
+        UChar32 c;
+        U8_PREV_OR_FFFD(fBytes, 0, index, c);
+        i = index;
+        return c;
+    }
+    void back1(int64_t &i) const {
+        int32_t index = static_cast<int32_t>(i);
+        U8_BACK_1(fBytes, 0, index);
+        i = index;
+    }
+    void setCpStart(int64_t &i) const {
+        int32_t index = static_cast<int32_t>(i);
+        U8_SET_CP_START(fBytes, 0, index);
+        i = index;
+    }
+
+    UBool matchString(int64_t &i, int64_t limit, const char16_t *s, int32_t length,
+                      UBool &hitEnd) const {
+        int64_t inputIndex = i;
+        int32_t stringIndex = 0;
+        while (stringIndex < length) {
+            if (inputIndex >= limit) {
+                hitEnd = true;
+                return false;
+            }
+            UChar32 stringChar;
+            U16_NEXT(s, stringIndex, length, stringChar);
+            if (next(inputIndex, limit) != stringChar) {
+                return false;
+            }
+        }
+        i = inputIndex;
+        return true;
+    }
+
+    UBool matchBackref(int64_t groupStart, int64_t groupEnd, int64_t &i, int64_t limit,
+                       UBool &hitEnd) const {
+        int64_t inputIndex = i;
+        while (groupStart < groupEnd) {
+            if (inputIndex >= limit) {
+                hitEnd = true;
+                return false;
+            }
+            if (next(groupStart, groupEnd) != next(inputIndex, limit)) {
+                return false;
+            }
+        }
+        i = inputIndex;
+        return true;
+    }
+
+private:
+    const uint8_t *fBytes;
+};
+
+}  // namespace
+
+
+
 //--------------------------------------------------------------------------------
 //
 //   MatchAt      This is the actual matching engine.
@@ -2809,6 +3148,16 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
         return;
     }
 
+    // UTF-8 input is matched directly from its string, rather than
+    //   one character at a time through the UText.
+    int32_t utf8Length;
+    const char *utf8 = utext_getUTF8Contents(fInputText, &utf8Length);
+    if (utf8 != nullptr) {
+        MatchChunkAt(UTF8Text(reinterpret_cast<const uint8_t *>(utf8)),
+                     static_cast<int32_t>(startIdx), toEnd, status);
+        return;
+    }
+
     //  Cache frequently referenced items from the compiled pattern
     //
     int64_t             *pat           = fPattern->fCompiledPat->getBuffer();
@@ -4296,6 +4645,27 @@ void RegexMatcher::MatchAt(int64_t startIdx, UBool toEnd, UErrorCode &status) {
 //
 //--------------------------------------------------------------------------------
 void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return;
+    }
+
+    if (useAutomaton()) {
+        MatchAutomatonAt(startIdx, -1, toEnd, status);
+        return;
+    }
+
+    MatchChunkAt(UTF16ChunkText(fInputText->chunkContents), startIdx, toEnd, status);
+}
+
+
+//--------------------------------------------------------------------------------
+//
+//   MatchChunkAt   The engine, for input text in a UTF16ChunkText or a UTF8Text.
+//                  MatchAt() uses the UTF8Text version for UTF-8 input.
+//
+//--------------------------------------------------------------------------------
+template<typename Text>
+void RegexMatcher::MatchChunkAt(Text text, int32_t startIdx, UBool toEnd, UErrorCode &status) {
     UBool       isMatch  = false;      // True if the we have a match.
 
     int32_t     backSearchIndex = INT32_MAX; // used after greedy single-character matches for searching backwards
@@ -4323,8 +4693,6 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
     const char16_t      *litText       = fPattern->fLiteralText.getBuffer();
     UVector             *fSets         = fPattern->fSets;
 
-    const char16_t      *inputBuf      = fInputText->chunkContents;
-
     fFrameSize = fPattern->fFrameSize;
     REStackFrame        *fp            = resetStack();
     if (U_FAILURE(fDeferredStatus)) {
@@ -4376,8 +4744,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
         case URX_ONECHAR:
             if (fp->fInputIdx < fActiveLimit) {
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = text.next(fp->fInputIdx, fActiveLimit);
                 if (c == opValue) {
                     break;
                 }
@@ -4403,34 +4770,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 U_ASSERT(opType == URX_STRING_LEN);
                 U_ASSERT(stringLen >= 2);
 
-                const char16_t * pInp = inputBuf + fp->fInputIdx;
-                const char16_t * pInpLimit = inputBuf + fActiveLimit;
-                const char16_t * pPat = litText+stringStartIdx;
-                const char16_t * pEnd = pInp + stringLen;
-                UBool success = true;
-                while (pInp < pEnd) {
-                    if (pInp >= pInpLimit) {
-                        fHitEnd = true;
-                        success = false;
-                        break;
-                    }
-                    if (*pInp++ != *pPat++) {
-                        success = false;
-                        break;
-                    }
-                }
-
-                // If the pattern string ends with an unpaired lead surrogate that
-                // matched the lead surrogate of a valid pair in the input text,
-                // this does not count as a match.
-                if (success && U16_IS_LEAD(*(pInp-1)) &&
-                        pInp < pInpLimit && U16_IS_TRAIL(*(pInp))) {
-                    success = false;
-                }
-
-                if (success) {
-                    fp->fInputIdx += stringLen;
-                } else {
+                if (!text.matchString(fp->fInputIdx, fActiveLimit, litText+stringStartIdx, stringLen, fHitEnd)) {
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
                 }
             }
@@ -4475,7 +4815,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
         case URX_DOLLAR:                   //  $, test for End of line
             //     or for position before new line at end of input
-            if (fp->fInputIdx < fAnchorLimit-2) {
+            if (fp->fInputIdx < fAnchorLimit-Text::kMaxLineEndLength) {
                 // We are no where near the end of input.  Fail.
                 //   This is the common case.  Keep it first.
                 fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
@@ -4490,23 +4830,23 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
             // If we are positioned just before a new-line that is located at the
             //   end of input, succeed.
-            if (fp->fInputIdx == fAnchorLimit-1) {
-                UChar32 c;
-                U16_GET(inputBuf, fAnchorStart, fp->fInputIdx, fAnchorLimit, c);
-
-                if (isLineTerminator(c)) {
-                    if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && inputBuf[fp->fInputIdx-1]==0x0d)) {
-                        // At new-line at end of input. Success
+            {
+                int64_t nextIdx = fp->fInputIdx;
+                UChar32 c = text.next(nextIdx, fAnchorLimit);
+                if (nextIdx == fAnchorLimit) {
+                    if (isLineTerminator(c)) {
+                        if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && text.unitAt(fp->fInputIdx-1)==0x0d)) {
+                            // At new-line at end of input. Success
+                            fHitEnd = true;
+                            fRequireEnd = true;
+                            break;
+                        }
+                    }
+                } else if (nextIdx == fAnchorLimit-1 && c==0x0d && text.unitAt(nextIdx)==0x0a) {
                         fHitEnd = true;
                         fRequireEnd = true;
-                        break;
-                    }
+                        break;                         // At CR/LF at end of input.  Success
                 }
-            } else if (fp->fInputIdx == fAnchorLimit-2 &&
-                inputBuf[fp->fInputIdx]==0x0d && inputBuf[fp->fInputIdx+1]==0x0a) {
-                    fHitEnd = true;
-                    fRequireEnd = true;
-                    break;                         // At CR/LF at end of input.  Success
             }
 
             fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
@@ -4519,7 +4859,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 // Either at the last character of input, or off the end.
                 if (fp->fInputIdx == fAnchorLimit-1) {
                     // At last char of input.  Success if it's a new line.
-                    if (inputBuf[fp->fInputIdx] == 0x0a) {
+                    if (text.unitAt(fp->fInputIdx) == 0x0a) {
                         fHitEnd = true;
                         fRequireEnd = true;
                         break;
@@ -4547,12 +4887,12 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 }
                 // If we are positioned just before a new-line, succeed.
                 // It makes no difference where the new-line is within the input.
-                UChar32 c = inputBuf[fp->fInputIdx];
+                UChar32 c = text.lineCharAt(fp->fInputIdx, fAnchorLimit);
                 if (isLineTerminator(c)) {
                     // At a line end, except for the odd chance of  being in the middle of a CR/LF sequence
                     //  In multi-line mode, hitting a new-line just before the end of input does not
                     //   set the hitEnd or requireEnd flags
-                    if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && inputBuf[fp->fInputIdx-1]==0x0d)) {
+                    if ( !(c==0x0a && fp->fInputIdx>fAnchorStart && text.unitAt(fp->fInputIdx-1)==0x0d)) {
                         break;
                     }
                 }
@@ -4572,7 +4912,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 }
                 // If we are not positioned just before a new-line, the test fails; backtrack out.
                 // It makes no difference where the new-line is within the input.
-                if (inputBuf[fp->fInputIdx] != 0x0a) {
+                if (text.unitAt(fp->fInputIdx) != 0x0a) {
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
                 }
             }
@@ -4594,7 +4934,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 }
                 // Check whether character just before the current pos is a new-line
                 //   unless we are at the end of input
-                char16_t  c = inputBuf[fp->fInputIdx - 1];
+                UChar32  c = text.lineCharBefore(fp->fInputIdx);
                 if ((fp->fInputIdx < fAnchorLimit) &&
                     isLineTerminator(c)) {
                     //  It's a new-line.  ^ is true.  Success.
@@ -4616,7 +4956,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 }
                 // Check whether character just before the current pos is a new-line
                 U_ASSERT(fp->fInputIdx <= fAnchorLimit);
-                char16_t  c = inputBuf[fp->fInputIdx - 1];
+                UChar32  c = text.unitAt(fp->fInputIdx - 1);
                 if (c != 0x0a) {
                     // Not at the start of a line.  Back-track out.
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
@@ -4626,7 +4966,8 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
         case URX_BACKSLASH_B:          // Test for word boundaries
             {
-                UBool success = isChunkWordBoundary(static_cast<int32_t>(fp->fInputIdx));
+                UBool success = Text::kIsUTF16 ? isChunkWordBoundary(static_cast<int32_t>(fp->fInputIdx)) :
+                                                 isWordBoundary(fp->fInputIdx);
                 success ^= static_cast<UBool>(opValue != 0); // flip sense for \B
                 if (!success) {
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
@@ -4654,8 +4995,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     break;
                 }
 
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = text.next(fp->fInputIdx, fActiveLimit);
                 int8_t ctype = u_charType(c);     // TODO:  make a unicode set for this.  Will be faster.
                 UBool success = (ctype == U_DECIMAL_DIGIT_NUMBER);
                 success ^= static_cast<UBool>(opValue != 0); // flip sense for \D
@@ -4680,8 +5020,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
                     break;
                 }
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = text.next(fp->fInputIdx, fActiveLimit);
                 int8_t ctype = u_charType(c);
                 UBool success = (ctype == U_SPACE_SEPARATOR || c == 9);  // SPACE_SEPARATOR || TAB
                 success ^= static_cast<UBool>(opValue != 0);  // flip sense for \H
@@ -4699,16 +5038,12 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
                     break;
                 }
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = text.next(fp->fInputIdx, fActiveLimit);
                 if (isLineTerminator(c)) {
-                    if (c == 0x0d && fp->fInputIdx < fActiveLimit) {
+                    if (c == 0x0d && fp->fInputIdx < fActiveLimit &&
+                            text.unitAt(fp->fInputIdx) == 0x0a) {
                         // Check for CR/LF sequence. Consume both together when found.
-                        char16_t c2;
-                        U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c2);
-                        if (c2 != 0x0a) {
-                            U16_PREV(inputBuf, 0, fp->fInputIdx, c2);
-                        }
+                        fp->fInputIdx++;
                     }
                 } else {
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
@@ -4724,8 +5059,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
                     break;
                 }
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = text.next(fp->fInputIdx, fActiveLimit);
                 UBool success = isLineTerminator(c);
                 success ^= static_cast<UBool>(opValue != 0); // flip sense for \V
                 if (!success) {
@@ -4781,8 +5115,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 opValue &= ~URX_NEG_SET;
                 U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
 
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = text.next(fp->fInputIdx, fActiveLimit);
                 if (c < 256) {
                     Regex8BitSet &s8 = RegexStaticSets::gStaticSets->fPropSets8[opValue];
                     if (s8.contains(c)) {
@@ -4813,8 +5146,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
                 U_ASSERT(opValue > 0 && opValue < URX_LAST_SET);
 
-                UChar32  c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32  c = text.next(fp->fInputIdx, fActiveLimit);
                 if (c < 256) {
                     Regex8BitSet &s8 = RegexStaticSets::gStaticSets->fPropSets8[opValue];
                     if (s8.contains(c) == false) {
@@ -4842,8 +5174,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 U_ASSERT(opValue > 0 && opValue < fSets->size());
 
                 // There is input left.  Pick up one char and test it for set membership.
-                UChar32  c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32  c = text.next(fp->fInputIdx, fActiveLimit);
                 if (c<256) {
                     Regex8BitSet *s8 = &fPattern->fSets8[opValue];
                     if (s8->contains(c)) {
@@ -4875,8 +5206,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 }
 
                 // There is input left.  Advance over one char, unless we've hit end-of-line
-                UChar32  c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32  c = text.next(fp->fInputIdx, fActiveLimit);
                 if (isLineTerminator(c)) {
                     // End of line in normal mode.   . does not match.
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
@@ -4898,12 +5228,11 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
                 // There is input left.  Advance over one char, except if we are
                 //   at a cr/lf, advance over both of them.
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = text.next(fp->fInputIdx, fActiveLimit);
                 if (c==0x0d && fp->fInputIdx < fActiveLimit) {
                     // In the case of a CR/LF, we need to advance over both.
-                    if (inputBuf[fp->fInputIdx] == 0x0a) {
-                        U16_FWD_1(inputBuf, fp->fInputIdx, fActiveLimit);
+                    if (text.unitAt(fp->fInputIdx) == 0x0a) {
+                        text.fwd1(fp->fInputIdx, fActiveLimit);
                     }
                 }
             }
@@ -4922,8 +5251,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 }
 
                 // There is input left.  Advance over one char, unless we've hit end-of-line
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = text.next(fp->fInputIdx, fActiveLimit);
                 if (c == 0x0a) {
                     // End of line in normal mode.   '.' does not match the \n
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize));
@@ -5146,24 +5474,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize)); // FAIL, no match.
                     break;
                 }
-                UBool success = true;
-                for (int64_t groupIndex = groupStartIdx; groupIndex < groupEndIdx; ++groupIndex,++inputIndex) {
-                    if (inputIndex >= fActiveLimit) {
-                        success = false;
-                        fHitEnd = true;
-                        break;
-                    }
-                    if (inputBuf[groupIndex] != inputBuf[inputIndex]) {
-                        success = false;
-                        break;
-                    }
-                }
-                if (success && groupStartIdx < groupEndIdx && U16_IS_LEAD(inputBuf[groupEndIdx-1]) &&
-                        inputIndex < fActiveLimit && U16_IS_TRAIL(inputBuf[inputIndex])) {
-                    // Capture group ended with an unpaired lead surrogate.
-                    // Back reference is not permitted to match lead only of a surrogatge pair.
-                    success = false;
-                }
+                UBool success = text.matchBackref(groupStartIdx, groupEndIdx, inputIndex, fActiveLimit, fHitEnd);
                 if (success) {
                     fp->fInputIdx = inputIndex;
                 } else {
@@ -5183,8 +5494,8 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     fp = reinterpret_cast<REStackFrame*>(fStack->popFrame(fFrameSize)); // FAIL, no match.
                     break;
                 }
-                CaseFoldingUCharIterator captureGroupItr(inputBuf, groupStartIdx, groupEndIdx);
-                CaseFoldingUCharIterator inputItr(inputBuf, fp->fInputIdx, fActiveLimit);
+                CaseFoldingUCharIterator captureGroupItr(text.units(), groupStartIdx, groupEndIdx);
+                CaseFoldingUCharIterator inputItr(text.units(), fp->fInputIdx, fActiveLimit);
 
                 //   Note: if the capture group match was of an empty string the backref
                 //         match succeeds.  Verified by testing:  Perl matches succeed
@@ -5294,8 +5605,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
         case URX_ONECHAR_I:
             if (fp->fInputIdx < fActiveLimit) {
-                UChar32 c;
-                U16_NEXT(inputBuf, fp->fInputIdx, fActiveLimit, c);
+                UChar32 c = text.next(fp->fInputIdx, fActiveLimit);
                 if (u_foldCase(c, U_FOLD_CASE_DEFAULT) == opValue) {
                     break;
                 }
@@ -5324,7 +5634,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 UChar32      cPattern;
                 UBool        success = true;
                 int32_t      patternStringIdx  = 0;
-                CaseFoldingUCharIterator inputIterator(inputBuf, fp->fInputIdx, fActiveLimit);
+                CaseFoldingUCharIterator inputIterator(text.units(), fp->fInputIdx, fActiveLimit);
                 while (patternStringIdx < patternStringLen) {
                     U16_NEXT(patternString, patternStringIdx, patternStringLen, cPattern);
                     cText = inputIterator.next();
@@ -5376,7 +5686,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 // Fetch the min and max possible match lengths.  They are the operands
                 //   of this op in the pattern.
                 int32_t minML = static_cast<int32_t>(pat[fp->fPatIdx++]);
-                int32_t maxML = static_cast<int32_t>(pat[fp->fPatIdx++]);
+                int32_t maxML = static_cast<int32_t>(pat[fp->fPatIdx++]) * Text::kMaxLengthPerUTF16;
                 U_ASSERT(minML <= maxML);
                 U_ASSERT(minML >= 0);
 
@@ -5387,7 +5697,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     // First time through loop.
                     lbStartIdx = fp->fInputIdx - minML;
                     if (lbStartIdx > 0 && lbStartIdx < fInputLength) {
-                        U16_SET_CP_START(inputBuf, 0, lbStartIdx);
+                        text.setCpStart(lbStartIdx);
                     }
                 } else {
                     // 2nd through nth time through the loop.
@@ -5395,7 +5705,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     if (lbStartIdx == 0) {
                         lbStartIdx--;
                     } else {
-                        U16_BACK_1(inputBuf, 0, lbStartIdx);
+                        text.back1(lbStartIdx);
                     }
                 }
 
@@ -5450,7 +5760,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
                 // Fetch the extra parameters of this op.
                 int32_t minML = static_cast<int32_t>(pat[fp->fPatIdx++]);
-                int32_t maxML = static_cast<int32_t>(pat[fp->fPatIdx++]);
+                int32_t maxML = static_cast<int32_t>(pat[fp->fPatIdx++]) * Text::kMaxLengthPerUTF16;
                 int32_t continueLoc = static_cast<int32_t>(pat[fp->fPatIdx++]);
                 continueLoc = URX_VAL(continueLoc);
                 U_ASSERT(minML <= maxML);
@@ -5464,7 +5774,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     // First time through loop.
                     lbStartIdx = fp->fInputIdx - minML;
                     if (lbStartIdx > 0 && lbStartIdx < fInputLength) {
-                        U16_SET_CP_START(inputBuf, 0, lbStartIdx);
+                        text.setCpStart(lbStartIdx);
                     }
                 } else {
                     // 2nd through nth time through the loop.
@@ -5472,7 +5782,7 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                     if (lbStartIdx == 0) {
                         lbStartIdx--;   // Because U16_BACK is unsafe starting at 0.
                     } else {
-                        U16_BACK_1(inputBuf, 0, lbStartIdx);
+                        text.back1(lbStartIdx);
                     }
                 }
 
@@ -5546,22 +5856,21 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
 
                 // Loop through input, until either the input is exhausted or
                 //   we reach a character that is not a member of the set.
-                int32_t ix = static_cast<int32_t>(fp->fInputIdx);
+                int64_t ix = fp->fInputIdx;
                 for (;;) {
                     if (ix >= fActiveLimit) {
                         fHitEnd = true;
                         break;
                     }
-                    UChar32   c;
-                    U16_NEXT(inputBuf, ix, fActiveLimit, c);
+                    UChar32   c = text.next(ix, fActiveLimit);
                     if (c<256) {
                         if (s8->contains(c) == false) {
-                            U16_BACK_1(inputBuf, 0, ix);
+                            text.back1(ix);
                             break;
                         }
                     } else {
                         if (s->contains(c) == false) {
-                            U16_BACK_1(inputBuf, 0, ix);
+                            text.back1(ix);
                             break;
                         }
                     }
@@ -5600,29 +5909,28 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
             {
                 // Loop through input until the input is exhausted (we reach an end-of-line)
                 // In DOTALL mode, we can just go straight to the end of the input.
-                int32_t ix;
+                int64_t ix;
                 if ((opValue & 1) == 1) {
                     // Dot-matches-All mode.  Jump straight to the end of the string.
-                    ix = static_cast<int32_t>(fActiveLimit);
+                    ix = fActiveLimit;
                     fHitEnd = true;
                 } else {
                     // NOT DOT ALL mode.  Line endings do not match '.'
                     // Scan forward until a line ending or end of input.
-                    ix = static_cast<int32_t>(fp->fInputIdx);
+                    ix = fp->fInputIdx;
                     for (;;) {
                         if (ix >= fActiveLimit) {
                             fHitEnd = true;
                             break;
                         }
-                        UChar32   c;
-                        U16_NEXT(inputBuf, ix, fActiveLimit, c);   // c = inputBuf[ix++]
+                        UChar32   c = text.next(ix, fActiveLimit);
                         if ((c & 0x7f) <= 0x29) {          // Fast filter of non-new-line-s
                             if ((c == 0x0a) ||             //  0x0a is newline in both modes.
                                 (((opValue & 2) == 0) &&    // IF not UNIX_LINES mode
                                    isLineTerminator(c))) {
                                 //  char is a line ending.  Put the input pos back to the
                                 //    line ending char, and exit the scanning loop.
-                                U16_BACK_1(inputBuf, 0, ix);
+                                text.back1(ix);
                                 break;
                             }
                         }
@@ -5672,16 +5980,15 @@ void RegexMatcher::MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &statu
                 //   (We're going backwards because this loop emulates stack unwinding, not
                 //    the initial scan forward.)
                 U_ASSERT(fp->fInputIdx > 0);
-                UChar32 prevC;
-                U16_PREV(inputBuf, 0, fp->fInputIdx, prevC); // !!!: should this 0 be one of f*Limit?
+                UChar32 prevC = text.prev(fp->fInputIdx); // !!!: should this 0 be one of f*Limit?
 
                 if (prevC == 0x0a &&
                     fp->fInputIdx > backSearchIndex &&
-                    inputBuf[fp->fInputIdx-1] == 0x0d) {
+                    text.unitAt(fp->fInputIdx-1) == 0x0d) {
                     int32_t prevOp = static_cast<int32_t>(pat[fp->fPatIdx - 2]);
                     if (URX_TYPE(prevOp) == URX_LOOP_DOT_I) {
                         // .*, stepping back over CRLF pair.
-                        U16_BACK_1(inputBuf, 0, fp->fInputIdx);
+                        text.back1(fp->fInputIdx);
                     }
                 }
 
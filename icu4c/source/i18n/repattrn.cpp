@@ -25,6 +25,7 @@
 #include "uvectr64.h"
 #include "regexcmp.h"
 #include "regeximp.h"
+#include "regexnfa.h"
 #include "regexst.h"
 
 U_NAMESPACE_BEGIN
@@ -95,6 +96,8 @@ RegexPattern &RegexPattern::operator = (const RegexPattern &other) {
     fFlags            = other.fFlags;
     fLiteralText      = other.fLiteralText;
     fMinMatchLen      = other.fMinMatchLen;
+    fMaxMatchLen      = other.fMaxMatchLen;
+    fUsesBackslashG   = other.fUsesBackslashG;
     fFrameSize        = other.fFrameSize;
     fDataSize         = other.fDataSize;
 
@@ -105,6 +108,7 @@ RegexPattern &RegexPattern::operator = (const RegexPattern &other) {
     fInitialChar      = other.fInitialChar;
     *fInitialChars8   = *other.fInitialChars8;
     fNeedsAltInput    = other.fNeedsAltInput;
+    fRequiredStrings  = other.fRequiredStrings;
 
     //  Copy the pattern.  It's just values, nothing deep to copy.
     fCompiledPat->assign(*other.fCompiledPat, fDeferredStatus);
@@ -152,6 +156,11 @@ RegexPattern &RegexPattern::operator = (const RegexPattern &other) {
             }
         }
     }
+
+    // The NFA refers to the sets of its own pattern, so translate the copy anew.
+    if (other.fNFA != nullptr && U_SUCCESS(fDeferredStatus)) {
+        fNFA = RegexNFA::createForPattern(*this, fDeferredStatus);
+    }
     return *this;
 }
 
@@ -170,6 +179,8 @@ void RegexPattern::init() {
     fSets8            = nullptr;
     fDeferredStatus   = U_ZERO_ERROR;
     fMinMatchLen      = 0;
+    fMaxMatchLen      = INT32_MAX;
+    fUsesBackslashG   = false;
     fFrameSize        = 0;
     fDataSize         = 0;
     fGroupMap         = nullptr;
@@ -181,6 +192,8 @@ void RegexPattern::init() {
     fInitialChars8    = nullptr;
     fNeedsAltInput    = false;
     fNamedCaptureMap  = nullptr;
+    fNFA              = nullptr;
+    fRequiredStrings.remove();
 
     fPattern          = nullptr; // will be set later
     fPatternString    = nullptr; // may be set later
@@ -227,6 +240,8 @@ bool RegexPattern::initNamedCaptureMap() {
 //
 //--------------------------------------------------------------------------
 void RegexPattern::zap() {
+    delete fNFA;
+    fNFA = nullptr;
     delete fCompiledPat;
     fCompiledPat = nullptr;
     int i;
@@ -469,6 +484,16 @@ uint32_t RegexPattern::flags() const {
 }
 
 
+//---------------------------------------------------------------------
+//
+//   getEngine
+//
+//---------------------------------------------------------------------
+URegexEngine RegexPattern::getEngine() const {
+    return fNFA != nullptr ? UREGEX_ENGINE_AUTOMATON : UREGEX_ENGINE_BACKTRACKING;
+}
+
+
 //---------------------------------------------------------------------
 //
 //   matcher(UnicodeString, err)
@@ -825,6 +850,7 @@ void RegexPattern::dumpPattern() const {
     }
     printf("Original Pattern:  \"%s\"\n", CStr(patStr)());
     printf("   Min Match Length:  %d\n", fMinMatchLen);
+    printf("   Max Match Length:  %d\n", fMaxMatchLen);
     printf("   Match Start Type:  %s\n", START_OF_MATCH_STR(fStartType));
     if (fStartType == START_STRING) {
         UnicodeString initialString(fLiteralText,fInitialStringIdx, fInitialStringLen);
@@ -1331,24 +1331,158 @@ RuleBasedCollator::getSortKey(const char16_t *s, int32_t length,
     return U_SUCCESS(errorCode) ? sink.NumberOfBytesAppended() : 0;
 }
 
+int32_t
+RuleBasedCollator::getSortKeys(const char16_t *const *sources, const int32_t *sourceLengths,
+                               int32_t count,
+                               uint8_t *dest, int32_t capacity, int32_t *offsets,
+                               UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(count < 0 || (sources == nullptr && count > 0) ||
+            capacity < 0 || (dest == nullptr && capacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    // Set up one iterator for the whole batch and only point it at each string in turn.
+    UBool numeric = settings->isNumeric();
+    UBool dontCheckFCD = settings->dontCheckFCD();
+    UTF16CollationIterator iter(data, numeric, nullptr, nullptr, nullptr);
+    FCDUTF16CollationIterator fcdIter(data, numeric, nullptr, nullptr, nullptr);
+    uint8_t noDest[1] = { 0 };
+    int32_t totalLength = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        const char16_t *s = sources[i];
+        int32_t length = sourceLengths != nullptr ? sourceLengths[i] : -1;
+        if(s == nullptr && length != 0) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return 0;
+        }
+        const char16_t *limit = (length >= 0) ? s + length : nullptr;
+        if(offsets != nullptr) {
+            offsets[i] = totalLength;
+        }
+        // Keep counting the length once the buffer is full.
+        FixedSortKeyByteSink sink(
+            reinterpret_cast<char *>(totalLength < capacity ? dest + totalLength : noDest),
+            totalLength < capacity ? capacity - totalLength : 0);
+        if(dontCheckFCD) {
+            iter.setText(s, limit);
+            writeSortKey(iter, s, limit, sink, errorCode);
+        } else {
+            fcdIter.setText(s, limit);
+            writeSortKey(fcdIter, s, limit, sink, errorCode);
+        }
+        if(U_FAILURE(errorCode)) { return 0; }
+        int32_t keyLength = sink.NumberOfBytesAppended();
+        if(keyLength > INT32_MAX - totalLength) {
+            errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        totalLength += keyLength;
+    }
+    if(offsets != nullptr) {
+        offsets[count] = totalLength;
+    }
+    if(totalLength > capacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return totalLength;
+}
+
+void
+RuleBasedCollator::getSortKeyPrefixes(const char16_t *const *sources, const int32_t *sourceLengths,
+                                      int32_t count, uint8_t *prefixes, int32_t prefixLength,
+                                      UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return; }
+    if(count < 0 || (count > 0 && (sources == nullptr || prefixes == nullptr)) ||
+            prefixLength <= 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    UBool numeric = settings->isNumeric();
+    UBool dontCheckFCD = settings->dontCheckFCD();
+    UTF16CollationIterator iter(data, numeric, nullptr, nullptr, nullptr);
+    FCDUTF16CollationIterator fcdIter(data, numeric, nullptr, nullptr, nullptr);
+    for(int32_t i = 0; i < count; ++i) {
+        const char16_t *s = sources[i];
+        int32_t length = sourceLengths != nullptr ? sourceLengths[i] : -1;
+        if(s == nullptr && length != 0) {
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+        const char16_t *limit = (length >= 0) ? s + length : nullptr;
+        uint8_t *prefix = prefixes + static_cast<size_t>(i) * prefixLength;
+        FixedSortKeyByteSink sink(reinterpret_cast<char *>(prefix), prefixLength);
+        if(dontCheckFCD) {
+            iter.setText(s, limit);
+            writeSortKeyPrefix(iter, s, limit, sink, errorCode);
+        } else {
+            fcdIter.setText(s, limit);
+            writeSortKeyPrefix(fcdIter, s, limit, sink, errorCode);
+        }
+        if(U_FAILURE(errorCode)) { return; }
+        int32_t keyLength = sink.NumberOfBytesAppended();
+        if(keyLength < prefixLength) {
+            uprv_memset(prefix + keyLength, 0, prefixLength - keyLength);
+        }
+    }
+}
+
 void
 RuleBasedCollator::writeSortKey(const char16_t *s, int32_t length,
                                 SortKeyByteSink &sink, UErrorCode &errorCode) const {
     if(U_FAILURE(errorCode)) { return; }
     const char16_t *limit = (length >= 0) ? s + length : nullptr;
     UBool numeric = settings->isNumeric();
-    CollationKeys::LevelCallback callback;
     if(settings->dontCheckFCD()) {
         UTF16CollationIterator iter(data, numeric, s, s, limit);
-        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
-                                                  sink, Collation::PRIMARY_LEVEL,
-                                                  callback, true, errorCode);
+        writeSortKey(iter, s, limit, sink, errorCode);
     } else {
         FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
-        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
-                                                  sink, Collation::PRIMARY_LEVEL,
-                                                  callback, true, errorCode);
+        writeSortKey(iter, s, limit, sink, errorCode);
+    }
+}
+
+void
+RuleBasedCollator::writeSortKey(CollationIterator &iter, const char16_t *s, const char16_t *limit,
+                                SortKeyByteSink &sink, UErrorCode &errorCode) const {
+    CollationKeys::LevelCallback callback;
+    CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                              sink, Collation::PRIMARY_LEVEL,
+                                              callback, true, errorCode);
+    if(settings->getStrength() == UCOL_IDENTICAL) {
+        writeIdenticalLevel(s, limit, sink, errorCode);
     }
+    static const char terminator = 0;  // TERMINATOR_BYTE
+    sink.Append(&terminator, 1);
+}
+
+namespace {
+
+/** Stops writing levels once the sink is full. */
+class PrefixLevelCallback : public CollationKeys::LevelCallback {
+public:
+    PrefixLevelCallback(const SortKeyByteSink &s) : sink(s) {}
+    virtual ~PrefixLevelCallback() {}
+    virtual UBool needToWrite(Collation::Level /*level*/) override {
+        return !sink.Overflowed();
+    }
+
+private:
+    const SortKeyByteSink &sink;
+};
+
+}  // namespace
+
+void
+RuleBasedCollator::writeSortKeyPrefix(CollationIterator &iter,
+                                      const char16_t *s, const char16_t *limit,
+                                      SortKeyByteSink &sink, UErrorCode &errorCode) const {
+    PrefixLevelCallback callback(sink);
+    // preflight=false: Stop on the primary level when the sink overflows.
+    CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                              sink, Collation::PRIMARY_LEVEL,
+                                              callback, false, errorCode);
+    if(U_FAILURE(errorCode) || sink.Overflowed()) { return; }
     if(settings->getStrength() == UCOL_IDENTICAL) {
         writeIdenticalLevel(s, limit, sink, errorCode);
     }
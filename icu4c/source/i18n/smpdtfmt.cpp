@@ -60,6 +60,7 @@
 #include "olsontz.h"
 #include "patternprops.h"
 #include "fphdlimp.h"
+#include "gregoimp.h"
 #include "hebrwcal.h"
 #include "cstring.h"
 #include "uassert.h"
@@ -238,6 +239,41 @@ static const int32_t HEBREW_CAL_CUR_MILLENIUM_START_YEAR = 5000;
 static const int32_t HEBREW_CAL_CUR_MILLENIUM_END_YEAR = 6000;
 static constexpr const char16_t HEBREW_CALENDAR_VALUE[] = u"hebr";
 
+// Pattern characters of the Gregorian fields that fastSubFormat() handles.
+static constexpr const char16_t FAST_FIELD_CHARS[] = u"yMLdEaHkhKmsS";
+// fastSubFormat() is used for dates before 10000-01-01 (local time).
+static constexpr double FAST_FORMAT_LIMIT_MILLIS = 253402300800000.0;
+
+struct SimpleDateFormat::FastFields {
+    char16_t zeroDigit;
+    int32_t year;
+    int32_t month;          // 0-based
+    int32_t dayOfMonth;
+    int32_t dayOfWeek;      // 1-based, 1 == Sunday
+    int32_t millisInDay;
+};
+
+// fastParse() handles patterns with up to this many fields and literal texts.
+static constexpr int32_t FAST_PARSE_MAX_ITEMS = 24;
+
+struct SimpleDateFormat::FastParsePattern : public UMemory {
+    struct Item {
+        char16_t ch;            // pattern character of a field, or 0 for literal text
+        int16_t count;          // number of pattern characters of a field
+        int32_t patternOffset;  // start of the field or of the literal text in the pattern
+        UBool obeyCount;        // numeric field in a run of abutting numeric fields
+    };
+
+    /**
+     * Returns the pattern compiled for fastParse(), or nullptr if fastParse()
+     * does not handle it.
+     */
+    static FastParsePattern *create(const UnicodeString &pattern);
+
+    Item items[FAST_PARSE_MAX_ITEMS];
+    int32_t itemCount = 0;
+};
+
 /**
  * Maximum range for detecting daylight offset of a time zone when parsed time zone
  * string indicates it's daylight saving time, but the detected time zone does not
@@ -339,6 +375,7 @@ SimpleDateFormat::~SimpleDateFormat()
     }
     delete fTimeZoneFormat;
     delete fSimpleNumberFormatter;
+    delete fFastParsePattern;
 
 #if !UCONFIG_NO_BREAK_ITERATION
     delete fCapitalizationBrkIter;
@@ -565,6 +602,12 @@ SimpleDateFormat& SimpleDateFormat::operator=(const SimpleDateFormat& other)
     fPattern = other.fPattern;
     fHasMinute = other.fHasMinute;
     fHasSecond = other.fHasSecond;
+    fHasOnlyFastFields = other.fHasOnlyFastFields;
+    delete fFastParsePattern;
+    fFastParsePattern = nullptr;
+    if (other.fFastParsePattern != nullptr) {
+        fFastParsePattern = new FastParsePattern(*other.fFastParsePattern);
+    }
 
     fLocale = other.fLocale;
 
@@ -1072,6 +1115,16 @@ SimpleDateFormat::_format(Calendar& cal, UnicodeString& appendTo,
         }
     }
 
+    // Gregorian dates can usually be formatted without computing all of the calendar fields.
+    if (fHasOnlyFastFields && typeid(*workCal) == typeid(GregorianCalendar)) {
+        UErrorCode localStatus = U_ZERO_ERROR;
+        UDate date = workCal->getTime(localStatus);
+        if (U_SUCCESS(localStatus) && fastFormat(date, *workCal, appendTo, handler)) {
+            delete calClone;
+            return appendTo;
+        }
+    }
+
     UBool inQuote = false;
     char16_t prevCh = 0;
     int32_t count = 0;
@@ -2085,6 +2138,250 @@ SimpleDateFormat::subFormat(UnicodeString &appendTo,
 
 //----------------------------------------------------------------------
 
+/**
+ * Appends value with at least minDigits and at most maxDigits digits,
+ * the same as zeroPaddingNumber() with fSimpleNumberFormatter.
+ */
+static void
+_appendPaddedNumber(UnicodeString& appendTo, char16_t zeroDigit,
+                    int32_t value, int32_t minDigits, int32_t maxDigits) {
+    U_ASSERT(value >= 0 && maxDigits <= 10);
+    if (minDigits > maxDigits) {
+        minDigits = maxDigits;
+    }
+    // Write the digits backwards from the end of the buffer.
+    char16_t digits[10];
+    int32_t start = UPRV_LENGTHOF(digits);
+    do {
+        digits[--start] = static_cast<char16_t>(zeroDigit + value % 10);
+        value /= 10;
+    } while (value > 0 && start > UPRV_LENGTHOF(digits) - maxDigits);
+    while (start > UPRV_LENGTHOF(digits) - minDigits) {
+        digits[--start] = zeroDigit;
+    }
+    appendTo.append(digits + start, 0, UPRV_LENGTHOF(digits) - start);
+}
+
+UBool
+SimpleDateFormat::computeFastFields(UDate date, const Calendar& cal, FastFields& fields) const
+{
+    if (!fHasOnlyFastFields || typeid(cal) != typeid(GregorianCalendar) ||
+            fSimpleNumberFormatter == nullptr || fSharedNumberFormatters != nullptr) {
+        return false;
+    }
+#if !UCONFIG_NO_BREAK_ITERATION
+    if (fCapitalizationBrkIter != nullptr) {
+        // Leave titlecasing the first field to subFormat().
+        return false;
+    }
+#endif
+    // fSimpleNumberFormatter is only created for a DecimalFormat.
+    UChar32 zeroDigit =
+        static_cast<const DecimalFormat*>(fNumberFormat)->getDecimalFormatSymbols()->getCodePointZero();
+    if (zeroDigit < 0 || zeroDigit > 0xFFFF) {
+        return false;
+    }
+
+    // Compute the local time the same way as Calendar::computeFields().
+    // Any error is left for the Calendar to report.
+    UErrorCode localStatus = U_ZERO_ERROR;
+    int32_t rawOffset, dstOffset;
+    cal.getTimeZone().getOffset(date, false, rawOffset, dstOffset, localStatus);
+    double localMillis = date + rawOffset + dstOffset;
+    // Before the Gregorian change, GregorianCalendar uses the Julian calendar.
+    // Far future dates are left to the Calendar, which limits the range of dates.
+    if (U_FAILURE(localStatus) ||
+            !(localMillis >= static_cast<const GregorianCalendar&>(cal).getGregorianChange() &&
+              localMillis < FAST_FORMAT_LIMIT_MILLIS)) {
+        return false;
+    }
+    int8_t month, dayOfMonth, dayOfWeek;
+    Grego::timeToFields(localMillis, fields.year, month, dayOfMonth, dayOfWeek,
+                        fields.millisInDay, localStatus);
+    if (U_FAILURE(localStatus) || fields.year < 1) {
+        // BC years need the era.
+        return false;
+    }
+    fields.zeroDigit = static_cast<char16_t>(zeroDigit);
+    fields.month = month;
+    fields.dayOfMonth = dayOfMonth;
+    fields.dayOfWeek = dayOfWeek;
+    return true;
+}
+
+UBool
+SimpleDateFormat::fastFormat(UDate date, const Calendar& cal, UnicodeString& appendTo,
+                             FieldPositionHandler& handler) const
+{
+    FastFields fields;
+    if (!computeFastFields(date, cal, fields)) {
+        return false;
+    }
+
+    // Same as the loop in _format(), with fastSubFormat() for subFormat().
+    UBool inQuote = false;
+    char16_t prevCh = 0;
+    int32_t count = 0;
+    int32_t patternLength = fPattern.length();
+    for (int32_t i = 0; i < patternLength; ++i) {
+        char16_t ch = fPattern[i];
+        if (ch != prevCh && count > 0) {
+            fastSubFormat(appendTo, prevCh, count, fields, handler);
+            count = 0;
+        }
+        if (ch == QUOTE) {
+            if ((i+1) < patternLength && fPattern[i+1] == QUOTE) {
+                appendTo += QUOTE;
+                ++i;
+            } else {
+                inQuote = ! inQuote;
+            }
+        }
+        else if (!inQuote && isSyntaxChar(ch)) {
+            prevCh = ch;
+            ++count;
+        }
+        else {
+            appendTo += ch;
+        }
+    }
+    if (count > 0) {
+        fastSubFormat(appendTo, prevCh, count, fields, handler);
+    }
+    return true;
+}
+
+void
+SimpleDateFormat::fastSubFormat(UnicodeString &appendTo,
+                                char16_t ch,
+                                int32_t count,
+                                const FastFields& fields,
+                                FieldPositionHandler& handler) const
+{
+    static constexpr int32_t maxIntCount = 10;
+
+    int32_t beginOffset = appendTo.length();
+    char16_t zero = fields.zeroDigit;
+    int32_t hourOfDay = fields.millisInDay / U_MILLIS_PER_HOUR;
+
+    // Each case produces the same output as the corresponding case in subFormat().
+    switch (ch) {
+    case u'y':
+        if (count == 2) {
+            _appendPaddedNumber(appendTo, zero, fields.year, 2, 2);
+        } else {
+            _appendPaddedNumber(appendTo, zero, fields.year, count, maxIntCount);
+        }
+        break;
+
+    case u'M':
+        if (count == 5) {
+            _appendSymbol(appendTo, fields.month, fSymbols->fNarrowMonths, fSymbols->fNarrowMonthsCount);
+        } else if (count == 4) {
+            _appendSymbol(appendTo, fields.month, fSymbols->fMonths, fSymbols->fMonthsCount);
+        } else if (count == 3) {
+            _appendSymbol(appendTo, fields.month, fSymbols->fShortMonths, fSymbols->fShortMonthsCount);
+        } else {
+            _appendPaddedNumber(appendTo, zero, fields.month + 1, count, maxIntCount);
+        }
+        break;
+
+    case u'L':
+        if (count == 5) {
+            _appendSymbol(appendTo, fields.month, fSymbols->fStandaloneNarrowMonths,
+                          fSymbols->fStandaloneNarrowMonthsCount);
+        } else if (count == 4) {
+            _appendSymbol(appendTo, fields.month, fSymbols->fStandaloneMonths,
+                          fSymbols->fStandaloneMonthsCount);
+        } else if (count == 3) {
+            _appendSymbol(appendTo, fields.month, fSymbols->fStandaloneShortMonths,
+                          fSymbols->fStandaloneShortMonthsCount);
+        } else {
+            _appendPaddedNumber(appendTo, zero, fields.month + 1, count, maxIntCount);
+        }
+        break;
+
+    case u'd':
+        _appendPaddedNumber(appendTo, zero, fields.dayOfMonth, count, maxIntCount);
+        break;
+
+    case u'E':
+        if (count == 5) {
+            _appendSymbol(appendTo, fields.dayOfWeek, fSymbols->fNarrowWeekdays,
+                          fSymbols->fNarrowWeekdaysCount);
+        } else if (count == 4) {
+            _appendSymbol(appendTo, fields.dayOfWeek, fSymbols->fWeekdays,
+                          fSymbols->fWeekdaysCount);
+        } else if (count == 6) {
+            _appendSymbol(appendTo, fields.dayOfWeek, fSymbols->fShorterWeekdays,
+                          fSymbols->fShorterWeekdaysCount);
+        } else {
+            _appendSymbol(appendTo, fields.dayOfWeek, fSymbols->fShortWeekdays,
+                          fSymbols->fShortWeekdaysCount);
+        }
+        break;
+
+    case u'a':
+        if (count == 4) {
+            _appendSymbol(appendTo, hourOfDay / 12, fSymbols->fWideAmPms, fSymbols->fWideAmPmsCount);
+        } else if (count == 5) {
+            _appendSymbol(appendTo, hourOfDay / 12, fSymbols->fNarrowAmPms, fSymbols->fNarrowAmPmsCount);
+        } else {
+            _appendSymbol(appendTo, hourOfDay / 12, fSymbols->fAmPms, fSymbols->fAmPmsCount);
+        }
+        break;
+
+    case u'H':
+        _appendPaddedNumber(appendTo, zero, hourOfDay, count, maxIntCount);
+        break;
+
+    case u'k':
+        _appendPaddedNumber(appendTo, zero, hourOfDay == 0 ? 24 : hourOfDay, count, maxIntCount);
+        break;
+
+    case u'h':
+        _appendPaddedNumber(appendTo, zero, hourOfDay % 12 == 0 ? 12 : hourOfDay % 12, count, maxIntCount);
+        break;
+
+    case u'K':
+        _appendPaddedNumber(appendTo, zero, hourOfDay % 12, count, maxIntCount);
+        break;
+
+    case u'm':
+        _appendPaddedNumber(appendTo, zero, fields.millisInDay / U_MILLIS_PER_MINUTE % 60,
+                            count, maxIntCount);
+        break;
+
+    case u's':
+        _appendPaddedNumber(appendTo, zero, fields.millisInDay / U_MILLIS_PER_SECOND % 60,
+                            count, maxIntCount);
+        break;
+
+    case u'S':
+        // Fractional seconds left-justify
+        {
+            int32_t value = fields.millisInDay % U_MILLIS_PER_SECOND;
+            if (count == 1) {
+                value /= 100;
+            } else if (count == 2) {
+                value /= 10;
+            }
+            _appendPaddedNumber(appendTo, zero, value, (count > 3) ? 3 : count, maxIntCount);
+            if (count > 3) {
+                _appendPaddedNumber(appendTo, zero, 0, count - 3, maxIntCount);
+            }
+        }
+        break;
+
+    default:
+        UPRV_UNREACHABLE_EXIT;
+    }
+
+    handler.addAttribute(DateFormatSymbols::getPatternCharIndex(ch), beginOffset, appendTo.length());
+}
+
+//----------------------------------------------------------------------
+
 void SimpleDateFormat::adoptNumberFormat(NumberFormat *formatToAdopt) {
     // Null out the fast formatter, it references fNumberFormat which we're
     // about to invalidate
@@ -3014,6 +3311,309 @@ matchStringWithOptionalDot(const UnicodeString &text,
     return 0;
 }
 
+/**
+ * Same matching as in matchString() without a month pattern:
+ * Returns the length of the longest match in the text, or 0 if there is none,
+ * and sets bestMatch to the index of the matching data string.
+ */
+static int32_t
+matchLongestString(const UnicodeString &text, int32_t start,
+                   const UnicodeString *data, int32_t dataCount, int32_t firstIndex,
+                   int32_t &bestMatch) {
+    int32_t bestMatchLength = 0;
+    char16_t first = text.charAt(start);
+    for (int32_t i = firstIndex; i < dataCount; ++i) {
+        // The case folding of ASCII characters is ASCII,
+        // so different first ASCII letters cannot start a match.
+        char16_t dataFirst = data[i].charAt(0);
+        if (first < 0x80 && dataFirst < 0x80 &&
+                uprv_asciitolower(static_cast<char>(first)) !=
+                    uprv_asciitolower(static_cast<char>(dataFirst))) {
+            continue;
+        }
+        int32_t matchLen = matchStringWithOptionalDot(text, start, data[i]);
+        if (matchLen > bestMatchLength) {
+            bestMatch = i;
+            bestMatchLength = matchLen;
+        }
+    }
+    return bestMatchLength;
+}
+
+int32_t
+SimpleDateFormat::fastSubParse(const UnicodeString& text, int32_t start, char16_t ch,
+                               int32_t count, UBool obeyCount, char16_t zeroDigit,
+                               int32_t fields[]) const
+{
+    // Skip whitespace as subParse() does.
+    for (;;) {
+        if (start >= text.length()) {
+            return -1;
+        }
+        UChar32 c = text.char32At(start);
+        if (!u_isUWhiteSpace(c) && !PatternProps::isWhiteSpace(c)) {
+            break;
+        }
+        start += U16_LENGTH(c);
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    UDateFormatField patternCharIndex = DateFormatSymbols::getPatternCharIndex(ch);
+    UCalendarDateFields field = fgPatternIndexToCalendarField[patternCharIndex];
+
+    if (isNumeric(ch, count)) {
+        // Only the digits of the NumberFormat. Leave anything else that the
+        // NumberFormat might parse, like other digits or signs, to subParse().
+        int32_t limit = text.length();
+        if (obeyCount) {
+            if (start + count > limit) {
+                return -1;
+            }
+            limit = start + count;
+        }
+        int32_t pos = start;
+        int32_t value = 0;
+        for (; pos < limit; ++pos) {
+            uint32_t digit = static_cast<uint32_t>(text.charAt(pos)) - zeroDigit;
+            if (digit > 9) {
+                break;
+            }
+            if (pos - start == 9) {
+                return -1;
+            }
+            value = value * 10 + static_cast<int32_t>(digit);
+        }
+        if (pos == start || (pos < limit && u_isdigit(text.char32At(pos)))) {
+            return -1;
+        }
+        // subParse() handles d, m, and s as "generic" fields.
+        UBool isGeneric = patternCharIndex == UDAT_DATE_FIELD ||
+            patternCharIndex == UDAT_MINUTE_FIELD || patternCharIndex == UDAT_SECOND_FIELD;
+        if (isGeneric && obeyCount && !isLenient() && pos < limit) {
+            return -1;
+        }
+        if (!getBooleanAttribute(isGeneric ? UDAT_PARSE_ALLOW_NUMERIC : UDAT_PARSE_ALLOW_WHITESPACE,
+                                 status)) {
+            // Check the range of the value
+            int32_t bias = gFieldRangeBias[patternCharIndex];
+            if (bias >= 0 && (value > fCalendar->getMaximum(field) + bias ||
+                              value < fCalendar->getMinimum(field) + bias)) {
+                return -1;
+            }
+        }
+        switch (patternCharIndex) {
+        case UDAT_YEAR_FIELD:
+            if (count < 3 && pos - start == 2 && fHaveDefaultCentury) {
+                int32_t ambiguousTwoDigitYear = fDefaultCenturyStartYear % 100;
+                if (value == ambiguousTwoDigitYear) {
+                    // parse() compares the whole date with the default century start.
+                    return -1;
+                }
+                value += (fDefaultCenturyStartYear/100)*100 +
+                        (value < ambiguousTwoDigitYear ? 100 : 0);
+            }
+            break;
+        case UDAT_MONTH_FIELD:
+        case UDAT_STANDALONE_MONTH_FIELD:
+            value -= 1;
+            break;
+        case UDAT_HOUR_OF_DAY1_FIELD:
+            if (value == 24) {
+                value = 0;
+            }
+            break;
+        case UDAT_HOUR1_FIELD:
+            if (value == 12) {
+                value = 0;
+            }
+            break;
+        case UDAT_FRACTIONAL_SECOND_FIELD:
+            // Fractional seconds left-justify
+            for (int32_t i = pos - start; i < 3; ++i) {
+                value *= 10;
+            }
+            for (int32_t i = pos - start; i > 3; --i) {
+                value /= 10;
+            }
+            break;
+        default:
+            break;
+        }
+        fields[field] = value;
+        return pos;
+    }
+
+    UBool multiplePatterns = getBooleanAttribute(UDAT_PARSE_MULTIPLE_PATTERNS_FOR_MATCH, status);
+    int32_t index = -1;
+    int32_t matchLength = 0;
+    switch (patternCharIndex) {
+    case UDAT_MONTH_FIELD:
+    case UDAT_STANDALONE_MONTH_FIELD: {
+        // The same order of symbols as in subParse().
+        const UnicodeString *wide = fSymbols->fMonths;
+        const UnicodeString *abbrev = fSymbols->fShortMonths;
+        int32_t wideCount = fSymbols->fMonthsCount;
+        int32_t abbrevCount = fSymbols->fShortMonthsCount;
+        if (patternCharIndex == UDAT_STANDALONE_MONTH_FIELD) {
+            wide = fSymbols->fStandaloneMonths;
+            abbrev = fSymbols->fStandaloneShortMonths;
+            wideCount = fSymbols->fStandaloneMonthsCount;
+            abbrevCount = fSymbols->fStandaloneShortMonthsCount;
+        }
+        if (multiplePatterns && count <= 4 && wideCount == abbrevCount) {
+            // Like matchAlphaMonthStrings().
+            matchLength = matchLongestString(text, start, wide, wideCount, 0, index);
+            int32_t abbrevIndex = -1;
+            int32_t abbrevLength = matchLongestString(text, start, abbrev, abbrevCount, 0, abbrevIndex);
+            if (abbrevLength > matchLength) {
+                index = abbrevIndex;
+                matchLength = abbrevLength;
+            }
+        }
+        if (matchLength == 0 && (multiplePatterns || count == 4)) {
+            matchLength = matchLongestString(text, start, wide, wideCount, 0, index);
+        }
+        if (matchLength == 0 && (multiplePatterns || count == 3)) {
+            matchLength = matchLongestString(text, start, abbrev, abbrevCount, 0, index);
+        }
+        break;
+    }
+    case UDAT_DAY_OF_WEEK_FIELD:
+        if (multiplePatterns || count == 4) {
+            matchLength = matchLongestString(text, start, fSymbols->fWeekdays,
+                                             fSymbols->fWeekdaysCount, 1, index);
+        }
+        if (matchLength == 0 && (multiplePatterns || count == 3)) {
+            matchLength = matchLongestString(text, start, fSymbols->fShortWeekdays,
+                                             fSymbols->fShortWeekdaysCount, 1, index);
+        }
+        if (matchLength == 0 && (multiplePatterns || count == 6)) {
+            matchLength = matchLongestString(text, start, fSymbols->fShorterWeekdays,
+                                             fSymbols->fShorterWeekdaysCount, 1, index);
+        }
+        if (matchLength == 0 && (multiplePatterns || count == 5)) {
+            matchLength = matchLongestString(text, start, fSymbols->fNarrowWeekdays,
+                                             fSymbols->fNarrowWeekdaysCount, 1, index);
+        }
+        break;
+    case UDAT_AM_PM_FIELD:
+        if (multiplePatterns || count == 4) {
+            matchLength = matchLongestString(text, start, fSymbols->fWideAmPms,
+                                             fSymbols->fWideAmPmsCount, 0, index);
+        }
+        if (matchLength == 0 && (multiplePatterns || count <= 3)) {
+            matchLength = matchLongestString(text, start, fSymbols->fAmPms,
+                                             fSymbols->fAmPmsCount, 0, index);
+        }
+        if (matchLength == 0 && (multiplePatterns || count >= 5)) {
+            matchLength = matchLongestString(text, start, fSymbols->fNarrowAmPms,
+                                             fSymbols->fNarrowAmPmsCount, 0, index);
+        }
+        break;
+    default:
+        break;
+    }
+    if (matchLength == 0) {
+        return -1;
+    }
+    fields[field] = index;
+    return start + matchLength;
+}
+
+UBool
+SimpleDateFormat::fastParse(const UnicodeString& text, ParsePosition& parsePos, UDate& date) const
+{
+    const FastParsePattern *compiled = fFastParsePattern;
+    if (compiled == nullptr || typeid(*fCalendar) != typeid(GregorianCalendar) ||
+            fSimpleNumberFormatter == nullptr || fSharedNumberFormatters != nullptr ||
+            fSymbols->fLeapMonthPatterns != nullptr) {
+        return false;
+    }
+    const TimeZone &tz = fCalendar->getTimeZone();
+    const BasicTimeZone *btz = nullptr;
+    if (dynamic_cast<const OlsonTimeZone *>(&tz) != nullptr
+        || dynamic_cast<const SimpleTimeZone *>(&tz) != nullptr
+        || dynamic_cast<const RuleBasedTimeZone *>(&tz) != nullptr
+        || dynamic_cast<const VTimeZone *>(&tz) != nullptr) {
+        btz = static_cast<const BasicTimeZone *>(&tz);
+    } else {
+        return false;
+    }
+    // fSimpleNumberFormatter is only created for a DecimalFormat.
+    UChar32 zeroDigit =
+        static_cast<const DecimalFormat*>(fNumberFormat)->getDecimalFormatSymbols()->getCodePointZero();
+    int32_t pos = parsePos.getIndex();
+    if (zeroDigit < 0 || zeroDigit > 0xFFFF || pos < 0) {
+        return false;
+    }
+
+    UErrorCode status = U_ZERO_ERROR;
+    UBool whitespaceLenient = getBooleanAttribute(UDAT_PARSE_ALLOW_WHITESPACE, status);
+    UBool partialMatchLenient = getBooleanAttribute(UDAT_PARSE_PARTIAL_LITERAL_MATCH, status);
+    int32_t fields[UCAL_FIELD_COUNT] = {};
+    for (int32_t i = 0; i < compiled->itemCount; ++i) {
+        const FastParsePattern::Item &item = compiled->items[i];
+        if (item.ch == 0) {
+            int32_t patternOffset = item.patternOffset;
+            if (!matchLiterals(fPattern, patternOffset, text, pos, whitespaceLenient,
+                               partialMatchLenient, isLenient())) {
+                return false;
+            }
+        } else {
+            pos = fastSubParse(text, pos, item.ch, item.count, item.obeyCount,
+                               static_cast<char16_t>(zeroDigit), fields);
+            if (pos < 0) {
+                return false;
+            }
+        }
+    }
+    // Special hack for trailing "." after non-numeric field, as in parse().
+    if (text.charAt(pos) == 0x2e && whitespaceLenient &&
+            isAfterNonNumericField(fPattern, fPattern.length())) {
+        pos++;
+    }
+
+    // Compute the time the same way as Calendar::computeTime().
+    // Far future dates, and dates before the Gregorian change which
+    // use the Julian calendar, are left to the Calendar.
+    int32_t year = fields[UCAL_YEAR];
+    int32_t month = fields[UCAL_MONTH];
+    int32_t dayOfMonth = fields[UCAL_DATE];
+    int32_t hour = fields[UCAL_HOUR] + 12 * fields[UCAL_AM_PM] + fields[UCAL_HOUR_OF_DAY];
+    const GregorianCalendar *cal = static_cast<const GregorianCalendar *>(fCalendar);
+    if (year >= 10000 || year <= Grego::timeToYear(cal->getGregorianChange(), status) ||
+            month < 0 || month > 11 || dayOfMonth < 1 ||
+            dayOfMonth > Grego::monthLength(year, month) ||
+            fields[UCAL_HOUR] > 11 || hour > 23 ||
+            fields[UCAL_MINUTE] > 59 || fields[UCAL_SECOND] > 59) {
+        return false;
+    }
+    double localMillis = static_cast<double>(Grego::fieldsToDay(year, month, dayOfMonth)) * U_MILLIS_PER_DAY +
+        ((static_cast<double>(hour) * 60 + fields[UCAL_MINUTE]) * 60 + fields[UCAL_SECOND]) * 1000 +
+        fields[UCAL_MILLISECOND];
+    // Same options as in Calendar::computeZoneOffset().
+    UTimeZoneLocalOption duplicatedTimeOpt =
+        (cal->getRepeatedWallTimeOption() == UCAL_WALLTIME_FIRST) ? UCAL_TZ_LOCAL_FORMER : UCAL_TZ_LOCAL_LATTER;
+    UTimeZoneLocalOption nonExistingTimeOpt =
+        (cal->getSkippedWallTimeOption() == UCAL_WALLTIME_FIRST) ? UCAL_TZ_LOCAL_LATTER : UCAL_TZ_LOCAL_FORMER;
+    int32_t rawOffset, dstOffset;
+    btz->getOffsetFromLocal(localMillis, nonExistingTimeOpt, duplicatedTimeOpt, rawOffset, dstOffset, status);
+    UDate time = localMillis - (rawOffset + dstOffset);
+    if (!cal->isLenient() || cal->getSkippedWallTimeOption() == UCAL_WALLTIME_NEXT_VALID) {
+        // A wall time in a skipped range is an error, or is adjusted by the Calendar.
+        int32_t raw, dst;
+        tz.getOffset(time, false, raw, dst, status);
+        if (rawOffset + dstOffset != raw + dst) {
+            return false;
+        }
+    }
+    if (U_FAILURE(status)) {
+        return false;
+    }
+    parsePos.setIndex(pos);
+    date = time;
+    return true;
+}
+
 //----------------------------------------------------------------------
 
 void
@@ -4092,6 +4692,7 @@ SimpleDateFormat::applyLocalizedPattern(const UnicodeString& pattern,
     translatePattern(pattern, fPattern,
                      fSymbols->fLocalPatternChars,
                      UnicodeString(DateFormatSymbols::getPatternUChars()), status);
+    parsePattern();
 }
 
 //----------------------------------------------------------------------
@@ -4409,6 +5010,7 @@ void SimpleDateFormat::parsePattern() {
     fHasMinute = false;
     fHasSecond = false;
     fHasHanYearChar = false;
+    fHasOnlyFastFields = true;
 
     int len = fPattern.length();
     UBool inQuote = false;
@@ -4427,8 +5029,89 @@ void SimpleDateFormat::parsePattern() {
             if (ch == 0x73) {  // 0x73 == 's'
                 fHasSecond = true;
             }
+            if (isSyntaxChar(ch) && u_strchr(FAST_FIELD_CHARS, ch) == nullptr) {
+                fHasOnlyFastFields = false;
+            }
+        }
+    }
+
+    delete fFastParsePattern;
+    fFastParsePattern = fHasOnlyFastFields ? FastParsePattern::create(fPattern) : nullptr;
+}
+
+SimpleDateFormat::FastParsePattern *
+SimpleDateFormat::FastParsePattern::create(const UnicodeString &pattern) {
+    LocalPointer<FastParsePattern> result(new FastParsePattern());
+    if (result.isNull()) {
+        return nullptr;
+    }
+    // Each calendar field may be set only once, and the date must be complete,
+    // so that the result does not depend on how the Calendar resolves its fields.
+    uint32_t calendarFields = 0;
+    int32_t length = pattern.length();
+    // Same segmentation as in parse().
+    for (int32_t i = 0; i < length; ++i) {
+        if (result->itemCount == FAST_PARSE_MAX_ITEMS) {
+            return nullptr;
+        }
+        Item &item = result->items[result->itemCount++];
+        char16_t ch = pattern.charAt(i);
+        item.patternOffset = i;
+        item.obeyCount = false;
+        if (isSyntaxChar(ch)) {
+            int32_t count = 1;
+            while ((i + 1) < length && pattern.charAt(i + 1) == ch) {
+                ++count;
+                ++i;
+            }
+            if (count > INT16_MAX) {
+                return nullptr;
+            }
+            item.ch = ch;
+            item.count = static_cast<int16_t>(count);
+            UCalendarDateFields field =
+                fgPatternIndexToCalendarField[DateFormatSymbols::getPatternCharIndex(ch)];
+            if ((calendarFields & (1 << field)) != 0) {
+                return nullptr;
+            }
+            calendarFields |= 1 << field;
+            // Like isAtNumericField() in parse(), for both fields of an abutting pair.
+            if (result->itemCount >= 2 && isNumeric(ch, count)) {
+                Item &previous = result->items[result->itemCount - 2];
+                if (previous.ch != 0 && isNumeric(previous.ch, previous.count)) {
+                    previous.obeyCount = true;
+                    item.obeyCount = true;
+                }
+            }
+        } else {
+            // The literal text up to the next field, as in matchLiterals().
+            item.ch = 0;
+            item.count = 0;
+            UBool inQuote = false;
+            for (; i < length; ++i) {
+                ch = pattern.charAt(i);
+                if (!inQuote && isSyntaxChar(ch)) {
+                    break;
+                }
+                if (ch == QUOTE) {
+                    if ((i + 1) < length && pattern.charAt(i + 1) == QUOTE) {
+                        ++i;
+                    } else {
+                        inQuote = !inQuote;
+                    }
+                }
+            }
+            --i;
         }
     }
+    constexpr uint32_t dateFields = (1 << UCAL_YEAR) | (1 << UCAL_MONTH) | (1 << UCAL_DATE);
+    constexpr uint32_t hour24Field = 1 << UCAL_HOUR_OF_DAY;
+    constexpr uint32_t hour12Fields = (1 << UCAL_HOUR) | (1 << UCAL_AM_PM);
+    if ((calendarFields & dateFields) != dateFields ||
+            ((calendarFields & hour24Field) != 0 && (calendarFields & hour12Fields) != 0)) {
+        return nullptr;
+    }
+    return result.orphan();
 }
 
 U_NAMESPACE_END
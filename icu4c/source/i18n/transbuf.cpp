@@ -0,0 +1,190 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_TRANSLITERATION
+
+#include "unicode/ustring.h"
+#include "unicode/utf16.h"
+#include "cmemory.h"
+#include "putilimp.h"
+#include "transbuf.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Initial gap, to absorb the first few replacements that lengthen the text.
+constexpr int32_t kMinGap = 32;
+
+}  // namespace
+
+TransliterationBuffer::TransliterationBuffer(const char16_t *src, int32_t length,
+                                             UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    int32_t gap = uprv_max(kMinGap, length / 8);
+    if (length > INT32_MAX - gap) {
+        errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+        return;
+    }
+    fBuffer = static_cast<char16_t *>(uprv_malloc(static_cast<size_t>(length + gap) * U_SIZEOF_UCHAR));
+    if (fBuffer == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    fCapacity = length + gap;
+    fGapLimit = gap;
+    u_memcpy(fBuffer + fGapLimit, src, length);
+}
+
+TransliterationBuffer::~TransliterationBuffer() {
+    uprv_free(fBuffer);
+}
+
+void TransliterationBuffer::appendTo(UnicodeString &dest, UErrorCode &errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (fOutOfMemory) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    dest.append(fBuffer, 0, fGapStart).append(fBuffer, fGapLimit, fCapacity - fGapLimit);
+    if (dest.isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+    }
+}
+
+int32_t TransliterationBuffer::getLength() const {
+    return fCapacity - (fGapLimit - fGapStart);
+}
+
+char16_t TransliterationBuffer::getCharAt(int32_t offset) const {
+    if (offset < 0) {
+        return 0xffff;
+    } else if (offset < fGapStart) {
+        return fBuffer[offset];
+    }
+    offset += fGapLimit - fGapStart;
+    return offset < fCapacity ? fBuffer[offset] : 0xffff;
+}
+
+UChar32 TransliterationBuffer::getChar32At(int32_t offset) const {
+    // Same as U16_GET() on a contiguous string.
+    int32_t length = getLength();
+    if (offset < 0 || offset >= length) {
+        return 0xffff;
+    }
+    UChar32 c = getCharAt(offset);
+    if (U16_IS_LEAD(c)) {
+        char16_t c2;
+        if (offset + 1 < length && U16_IS_TRAIL(c2 = getCharAt(offset + 1))) {
+            c = U16_GET_SUPPLEMENTARY(c, c2);
+        }
+    } else if (U16_IS_TRAIL(c)) {
+        char16_t c2;
+        if (offset > 0 && U16_IS_LEAD(c2 = getCharAt(offset - 1))) {
+            c = U16_GET_SUPPLEMENTARY(c2, c);
+        }
+    }
+    return c;
+}
+
+void TransliterationBuffer::handleReplaceBetween(int32_t start,
+                                                 int32_t limit,
+                                                 const UnicodeString &text) {
+    if (fOutOfMemory) {
+        return;
+    }
+    // Pin the indexes like UnicodeString does.
+    int32_t length = getLength();
+    start = uprv_max(0, uprv_min(start, length));
+    limit = uprv_max(start, uprv_min(limit, length));
+    moveGap(limit);
+    fGapStart = start;  // Removes [start, limit).
+    int32_t textLength = text.length();
+    if (!ensureGap(textLength)) {
+        return;
+    }
+    u_memcpy(fBuffer + fGapStart, text.getBuffer(), textLength);
+    fGapStart += textLength;
+}
+
+void TransliterationBuffer::extractBetween(int32_t start,
+                                           int32_t limit,
+                                           UnicodeString &target) const {
+    int32_t length = getLength();
+    start = uprv_max(0, uprv_min(start, length));
+    limit = uprv_max(start, uprv_min(limit, length));
+    target.remove();
+    if (start < fGapStart) {
+        target.append(fBuffer, start, uprv_min(limit, fGapStart) - start);
+    }
+    if (limit > fGapStart) {
+        int32_t gapLength = fGapLimit - fGapStart;
+        int32_t afterGap = uprv_max(start, fGapStart);
+        target.append(fBuffer, afterGap + gapLength, limit - afterGap);
+    }
+}
+
+void TransliterationBuffer::copy(int32_t start, int32_t limit, int32_t dest) {
+    if (limit <= start) {
+        return;
+    }
+    UnicodeString text;
+    extractBetween(start, limit, text);
+    handleReplaceBetween(dest, dest, text);
+}
+
+UBool TransliterationBuffer::hasMetaData() const {
+    return false;
+}
+
+void TransliterationBuffer::moveGap(int32_t index) {
+    if (index < fGapStart) {
+        int32_t count = fGapStart - index;
+        u_memmove(fBuffer + fGapLimit - count, fBuffer + index, count);
+        fGapStart = index;
+        fGapLimit -= count;
+    } else if (index > fGapStart) {
+        int32_t count = index - fGapStart;
+        u_memmove(fBuffer + fGapStart, fBuffer + fGapLimit, count);
+        fGapStart = index;
+        fGapLimit += count;
+    }
+}
+
+UBool TransliterationBuffer::ensureGap(int32_t length) {
+    int32_t gapLength = fGapLimit - fGapStart;
+    if (length <= gapLength) {
+        return true;
+    }
+    int32_t textLength = fCapacity - gapLength;
+    if (textLength > INT32_MAX - length) {
+        fOutOfMemory = true;
+        return false;
+    }
+    int32_t minCapacity = textLength + length;
+    int32_t newCapacity = (minCapacity <= INT32_MAX / 2) ? 2 * minCapacity : INT32_MAX;
+    char16_t *newBuffer =
+        static_cast<char16_t *>(uprv_malloc(static_cast<size_t>(newCapacity) * U_SIZEOF_UCHAR));
+    if (newBuffer == nullptr) {
+        fOutOfMemory = true;
+        return false;
+    }
+    int32_t afterGap = fCapacity - fGapLimit;
+    u_memcpy(newBuffer, fBuffer, fGapStart);
+    u_memcpy(newBuffer + newCapacity - afterGap, fBuffer + fGapLimit, afterGap);
+    uprv_free(fBuffer);
+    fBuffer = newBuffer;
+    fCapacity = newCapacity;
+    fGapLimit = newCapacity - afterGap;
+    return true;
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_TRANSLITERATION
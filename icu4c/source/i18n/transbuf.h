@@ -0,0 +1,82 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+#ifndef TRANSBUF_H
+#define TRANSBUF_H
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_TRANSLITERATION
+
+#include "unicode/rep.h"
+#include "unicode/unistr.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Text that a transliterator transforms into a new string.
+ *
+ * Transliterators work in place on a Replaceable, replacing each match as
+ * they advance through the text.  In a UnicodeString each replacement that
+ * changes the length moves all of the following text, so that transforming
+ * a long string takes quadratic time.  This buffer keeps a gap at the end
+ * of the last replacement instead: the text before the gap is the output so
+ * far, and the text after it is the source that has not been reached yet.
+ * A replacement just after the previous one only fills or widens the gap.
+ * Each transliterator of a compound transliterator makes another forward
+ * pass over the same buffer, which moves the gap back once.
+ */
+class TransliterationBuffer : public Replaceable {
+public:
+    /**
+     * Starts with a copy of the source text after the gap.
+     */
+    TransliterationBuffer(const char16_t *src, int32_t length, UErrorCode &errorCode);
+
+    virtual ~TransliterationBuffer();
+
+    /**
+     * Appends the text to dest.
+     * Sets U_MEMORY_ALLOCATION_ERROR if a replacement could not be made.
+     */
+    void appendTo(UnicodeString &dest, UErrorCode &errorCode) const;
+
+    virtual void handleReplaceBetween(int32_t start,
+                                      int32_t limit,
+                                      const UnicodeString &text) override;
+
+    virtual void extractBetween(int32_t start,
+                                int32_t limit,
+                                UnicodeString &target) const override;
+
+    virtual void copy(int32_t start, int32_t limit, int32_t dest) override;
+
+    virtual UBool hasMetaData() const override;
+
+protected:
+    virtual int32_t getLength() const override;
+
+    virtual char16_t getCharAt(int32_t offset) const override;
+
+    virtual UChar32 getChar32At(int32_t offset) const override;
+
+private:
+    TransliterationBuffer(const TransliterationBuffer &other) = delete;
+    TransliterationBuffer &operator=(const TransliterationBuffer &other) = delete;
+
+    /** Moves the gap to the text index. */
+    void moveGap(int32_t index);
+    /** Makes the gap at least this long. */
+    UBool ensureGap(int32_t length);
+
+    char16_t *fBuffer = nullptr;
+    int32_t fCapacity = 0;
+    int32_t fGapStart = 0;
+    int32_t fGapLimit = 0;
+    UBool fOutOfMemory = false;
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_TRANSLITERATION
+#endif  // TRANSBUF_H
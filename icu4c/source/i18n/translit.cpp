@@ -26,12 +26,14 @@
 #include "unicode/uniset.h"
 #include "unicode/uscript.h"
 #include "unicode/strenum.h"
+#include "unicode/ustring.h"
 #include "unicode/utf16.h"
 #include "cpdtrans.h"
 #include "nultrans.h"
 #include "rbt_data.h"
 #include "rbt_pars.h"
 #include "rbt.h"
+#include "transbuf.h"
 #include "transreg.h"
 #include "name2uni.h"
 #include "nortrans.h"
@@ -212,6 +214,28 @@ void Transliterator::transliterate(Replaceable& text) const {
     transliterate(text, 0, text.length());
 }
 
+UnicodeString& Transliterator::transliterate(ConstChar16Ptr src, int32_t srcLength,
+                                             UnicodeString& dest, UErrorCode& errorCode) const {
+    if (U_FAILURE(errorCode)) {
+        return dest;
+    }
+    const char16_t* s = src;
+    if ((s == nullptr && srcLength != 0) || srcLength < -1) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return dest;
+    }
+    if (srcLength < 0) {
+        srcLength = u_strlen(s);
+    }
+    TransliterationBuffer buffer(s, srcLength, errorCode);
+    if (U_FAILURE(errorCode)) {
+        return dest;
+    }
+    transliterate(buffer, 0, srcLength);
+    buffer.appendTo(dest, errorCode);
+    return dest;
+}
+
 /**
  * Transliterates the portion of the text buffer that can be
  * transliterated unambiguosly after new text has been inserted,
@@ -32,6 +32,7 @@ typedef enum ECleanupI18NType {
     UCLN_I18N_SPOOF,
     UCLN_I18N_SPOOFDATA,
     UCLN_I18N_TRANSLITERATOR,
+    UCLN_I18N_REGEX_NFA,
     UCLN_I18N_REGEX,
     UCLN_I18N_JAPANESE_CALENDAR,
     UCLN_I18N_ISLAMIC_CALENDAR,
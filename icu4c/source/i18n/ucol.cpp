@@ -215,6 +215,111 @@ ucol_getSortKey(const    UCollator    *coll,
     return keySize;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const char16_t *const *sources,
+                 const int32_t *sourceLengths,
+                 int32_t count,
+                 uint8_t *result,
+                 int32_t resultCapacity,
+                 int32_t *offsets,
+                 UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return 0;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != nullptr) {
+        return rbc->getSortKeys(sources, sourceLengths, count,
+                                result, resultCapacity, offsets, *status);
+    }
+
+    // Other Collator subclasses: one sort key at a time.
+    if(count < 0 || (sources == nullptr && count > 0) ||
+            resultCapacity < 0 || (result == nullptr && resultCapacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const Collator *collator = Collator::fromUCollator(coll);
+    int32_t totalLength = 0;
+    for(int32_t i = 0; i < count; ++i) {
+        if(offsets != nullptr) {
+            offsets[i] = totalLength;
+        }
+        int32_t capacity = totalLength < resultCapacity ? resultCapacity - totalLength : 0;
+        int32_t keyLength = collator->getSortKey(
+            sources[i], sourceLengths != nullptr ? sourceLengths[i] : -1,
+            capacity > 0 ? result + totalLength : nullptr, capacity);
+        if(keyLength == 0) {
+            *status = U_INTERNAL_PROGRAM_ERROR;
+            return 0;
+        }
+        if(keyLength > INT32_MAX - totalLength) {
+            *status = U_INDEX_OUTOFBOUNDS_ERROR;
+            return 0;
+        }
+        totalLength += keyLength;
+    }
+    if(offsets != nullptr) {
+        offsets[count] = totalLength;
+    }
+    if(totalLength > resultCapacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return totalLength;
+}
+
+U_CAPI void U_EXPORT2
+ucol_getSortKeyPrefixes(const UCollator *coll,
+                        const char16_t *const *sources,
+                        const int32_t *sourceLengths,
+                        int32_t count,
+                        uint8_t *prefixes,
+                        int32_t prefixLength,
+                        UErrorCode *status)
+{
+    if(U_FAILURE(*status)) {
+        return;
+    }
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != nullptr) {
+        rbc->getSortKeyPrefixes(sources, sourceLengths, count, prefixes, prefixLength, *status);
+        return;
+    }
+
+    // Other Collator subclasses: whole sort keys, truncated.
+    if(count < 0 || (count > 0 && (sources == nullptr || prefixes == nullptr)) ||
+            prefixLength <= 0) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    const Collator *collator = Collator::fromUCollator(coll);
+    MaybeStackArray<uint8_t, 256> key;
+    for(int32_t i = 0; i < count; ++i) {
+        const char16_t *s = sources[i];
+        int32_t length = sourceLengths != nullptr ? sourceLengths[i] : -1;
+        int32_t keyLength = collator->getSortKey(s, length, key.getAlias(), key.getCapacity());
+        if(keyLength > key.getCapacity()) {
+            if(key.resize(keyLength) == nullptr) {
+                *status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            keyLength = collator->getSortKey(s, length, key.getAlias(), key.getCapacity());
+        }
+        if(keyLength == 0) {
+            *status = U_INTERNAL_PROGRAM_ERROR;
+            return;
+        }
+        uint8_t *prefix = prefixes + static_cast<size_t>(i) * prefixLength;
+        if(keyLength >= prefixLength) {
+            uprv_memcpy(prefix, key.getAlias(), prefixLength);
+        } else {
+            uprv_memcpy(prefix, key.getAlias(), keyLength);
+            uprv_memset(prefix + keyLength, 0, prefixLength - keyLength);
+        }
+    }
+}
+
 U_CAPI int32_t U_EXPORT2
 ucol_nextSortKeyPart(const UCollator *coll,
                      UCharIterator *iter,
@@ -0,0 +1,224 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  ucol_sort.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   Sorting arrays of strings with a collator, optionally on several threads.
+*   Each chunk of strings gets its sort keys from one ucol_getSortKeys() call
+*   and is sorted by comparing those keys; sorted chunks are then merged
+*   pairwise until one run remains.
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include <algorithm>
+
+#include "unicode/localpointer.h"
+#include "unicode/uobject.h"
+#include "unicode/ucol.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "uthreadpool.h"
+
+U_NAMESPACE_USE
+
+namespace {
+
+/**
+ * Chunks shorter than this are not worth a thread of their own:
+ * Thread startup would cost more than computing their sort keys.
+ */
+constexpr int32_t MIN_CHUNK_LENGTH = 1024;
+
+/** Initial sort key buffer capacity per string; grown if needed. */
+constexpr int32_t SORT_KEY_CAPACITY_PER_STRING = 32;
+
+/**
+ * Orders string indexes by their sort keys, and equal keys by index.
+ * Comparing the indexes makes std::sort() and std::merge() stable.
+ */
+class SortKeyLess {
+public:
+    explicit SortKeyLess(const uint8_t *const *keys) : keys(keys) {}
+    bool operator()(int32_t a, int32_t b) const {
+        int32_t cmp = uprv_strcmp(reinterpret_cast<const char *>(keys[a]),
+                                  reinterpret_cast<const char *>(keys[b]));
+        return cmp < 0 || (cmp == 0 && a < b);
+    }
+private:
+    const uint8_t *const *keys;
+};
+
+/** One range of strings with its sort keys. */
+struct SortChunk : public UMemory {
+    int32_t start = 0;
+    int32_t limit = 0;
+    LocalMemory<uint8_t> keyBuffer;
+    LocalMemory<int32_t> offsets;
+    UErrorCode errorCode = U_ZERO_ERROR;
+};
+
+/** Shared state for all of the threads of one ucol_sortStrings() call. */
+struct SortContext {
+    const UCollator *coll;
+    const char16_t *const *strings;
+    const int32_t *lengths;
+    int32_t *indexes;
+    int32_t *temp;
+    const uint8_t **keys;
+    SortChunk *chunks;
+    int32_t chunkCount;
+};
+
+/**
+ * Computes the sort keys for one chunk, sets keys[] for its strings,
+ * and sorts the chunk's part of indexes[].
+ */
+void sortChunk(SortContext &context, int32_t chunkIndex) {
+    SortChunk &chunk = context.chunks[chunkIndex];
+    UErrorCode &errorCode = chunk.errorCode;
+    int32_t length = chunk.limit - chunk.start;
+    const int32_t *lengths =
+        context.lengths != nullptr ? context.lengths + chunk.start : nullptr;
+    if (chunk.offsets.allocateInsteadAndReset(length + 1) == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    int32_t capacity = length <= INT32_MAX / SORT_KEY_CAPACITY_PER_STRING ?
+        length * SORT_KEY_CAPACITY_PER_STRING : INT32_MAX;
+    for (;;) {
+        if (chunk.keyBuffer.allocateInsteadAndReset(capacity) == nullptr) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+        int32_t keysLength = ucol_getSortKeys(
+            context.coll, context.strings + chunk.start, lengths, length,
+            chunk.keyBuffer.getAlias(), capacity, chunk.offsets.getAlias(), &errorCode);
+        if (errorCode != U_BUFFER_OVERFLOW_ERROR) {
+            break;
+        }
+        errorCode = U_ZERO_ERROR;
+        capacity = keysLength;
+    }
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    const uint8_t *keyBuffer = chunk.keyBuffer.getAlias();
+    const int32_t *offsets = chunk.offsets.getAlias();
+    for (int32_t i = 0; i < length; ++i) {
+        context.keys[chunk.start + i] = keyBuffer + offsets[i];
+    }
+    int32_t *indexes = context.indexes;
+    for (int32_t i = chunk.start; i < chunk.limit; ++i) {
+        indexes[i] = i;
+    }
+    std::sort(indexes + chunk.start, indexes + chunk.limit, SortKeyLess(context.keys));
+}
+
+/**
+ * Merges the sorted runs of chunks [first, first+width[ and [first+width, first+2*width[
+ * from src into dest. A lone last run is copied.
+ */
+void mergeRuns(const SortContext &context, const int32_t *src, int32_t *dest,
+               int32_t first, int32_t width) {
+    const SortChunk *chunks = context.chunks;
+    int32_t middleChunk = std::min(first + width, context.chunkCount);
+    int32_t limitChunk = std::min(first + 2 * width, context.chunkCount);
+    int32_t start = chunks[first].start;
+    int32_t middle = chunks[middleChunk - 1].limit;
+    int32_t limit = chunks[limitChunk - 1].limit;
+    if (middle == limit) {
+        uprv_memcpy(dest + start, src + start, (limit - start) * sizeof(int32_t));
+    } else {
+        std::merge(src + start, src + middle, src + middle, src + limit,
+                   dest + start, SortKeyLess(context.keys));
+    }
+}
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const char16_t *const *strings,
+                 const int32_t *lengths,
+                 int32_t count,
+                 int32_t *indexes,
+                 int32_t threadCount,
+                 UErrorCode *status) {
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    if (coll == nullptr || count < 0 ||
+            (count > 0 && (strings == nullptr || indexes == nullptr))) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    int32_t chunkCount = count / MIN_CHUNK_LENGTH;
+    if (threadCount > chunkCount) {
+        threadCount = chunkCount;
+    }
+    if (threadCount <= 1) {
+        threadCount = chunkCount = 1;
+    } else {
+        chunkCount = threadCount;
+    }
+
+    LocalMemory<const uint8_t *> keys;
+    LocalMemory<int32_t> temp;
+    LocalArray<SortChunk> chunks(new SortChunk[chunkCount]);
+    if (keys.allocateInsteadAndReset(count) == nullptr ||
+            (chunkCount > 1 && temp.allocateInsteadAndReset(count) == nullptr) ||
+            chunks.isNull()) {
+        *status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    for (int32_t i = 0; i < chunkCount; ++i) {
+        chunks[i].start = static_cast<int32_t>(static_cast<int64_t>(count) * i / chunkCount);
+        chunks[i].limit = static_cast<int32_t>(static_cast<int64_t>(count) * (i + 1) / chunkCount);
+    }
+    SortContext context = {
+        coll, strings, lengths, indexes, temp.getAlias(), keys.getAlias(),
+        chunks.getAlias(), chunkCount
+    };
+
+    runTasks(chunkCount, [&context](int32_t i) { sortChunk(context, i); }, *status);
+    if (U_FAILURE(*status)) {
+        return;
+    }
+    for (int32_t i = 0; i < chunkCount; ++i) {
+        if (U_FAILURE(chunks[i].errorCode)) {
+            *status = chunks[i].errorCode;
+            return;
+        }
+    }
+
+    // Merge pairs of sorted runs, doubling the run width each round,
+    // alternating between indexes[] and temp[].
+    int32_t *src = indexes;
+    int32_t *dest = context.temp;
+    for (int32_t width = 1; width < chunkCount; width *= 2) {
+        int32_t pairCount = (chunkCount + 2 * width - 1) / (2 * width);
+        runTasks(pairCount, [&context, src, dest, width](int32_t pair) {
+            mergeRuns(context, src, dest, pair * 2 * width, width);
+        }, *status);
+        if (U_FAILURE(*status)) {
+            return;
+        }
+        std::swap(src, dest);
+    }
+    if (src != indexes) {
+        uprv_memcpy(indexes, src, static_cast<size_t>(count) * sizeof(int32_t));
+    }
+}
+
+#endif  // !UCONFIG_NO_COLLATION
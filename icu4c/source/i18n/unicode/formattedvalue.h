@@ -309,6 +309,97 @@ class U_I18N_API FormattedValue /* not : public UObject because this is an inter
     virtual UBool nextPosition(ConstrainedFieldPosition& cfpos, UErrorCode& status) const = 0;
 };
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Memory for formatting results, such as FormattedNumber and FormattedList,
+ * handed out by advancing a pointer and released all at once.
+ *
+ * Formatters that accept a FormattingArena create their result objects and
+ * string buffers in it rather than on the heap. The memory comes from a
+ * caller-supplied buffer, and then from heap blocks owned by the arena.
+ * reset() makes all of the memory available again but keeps the blocks, so that
+ * formatting many values, then calling reset() and repeating, soon runs without
+ * any heap allocations for the results.
+ *
+ * Results formatted with an arena must be destroyed before the arena is reset
+ * or destroyed. Their memory is not reused until reset().
+ *
+ * A FormattingArena must not be used by multiple threads at the same time.
+ *
+ * Example:
+ * <pre>
+ * char buffer[4096];
+ * FormattingArena arena(buffer, sizeof(buffer));
+ * for (double value : values) {
+ *     FormattedNumber result = formatter.formatDouble(value, arena, status);
+ *     sink.append(result.toTempString(status));
+ * }
+ * </pre>
+ *
+ * @draft ICU 79
+ */
+class U_I18N_API FormattingArena : public UMemory {
+  public:
+    /**
+     * Constructs an arena that allocates its memory from the heap.
+     *
+     * @draft ICU 79
+     */
+    FormattingArena();
+
+    /**
+     * Constructs an arena that uses the buffer first,
+     * and then memory from the heap if the buffer is full.
+     * The buffer must remain valid for the lifetime of the arena.
+     *
+     * @param buffer The memory to use.
+     * @param capacity The size of the buffer in bytes.
+     * @draft ICU 79
+     */
+    FormattingArena(void *buffer, int32_t capacity);
+
+    /**
+     * Destructor. Releases the heap memory owned by the arena.
+     *
+     * @draft ICU 79
+     */
+    ~FormattingArena();
+
+    /**
+     * Makes all of the memory available for new results.
+     * All results that were formatted with this arena must have been destroyed.
+     *
+     * @draft ICU 79
+     */
+    void reset();
+
+#ifndef U_HIDE_INTERNAL_API
+    /**
+     * Returns size bytes of memory, aligned for any type, or nullptr if out of memory.
+     * The memory is valid until reset() or the destructor.
+     *
+     * @internal
+     */
+    void *allocate(int32_t size);
+#endif  /* U_HIDE_INTERNAL_API */
+
+  private:
+    struct Block;
+
+    FormattingArena(const FormattingArena &other) = delete;
+    FormattingArena &operator=(const FormattingArena &other) = delete;
+
+    void *allocateFromNextBlock(int32_t size);
+
+    char *fBuffer;
+    char *fBufferLimit;
+    Block *fBlocks = nullptr;        // Heap blocks, in the order in which they are used.
+    Block *fCurrentBlock = nullptr;  // The block in use, or nullptr if fBuffer is in use.
+    char *fNext;
+    char *fLimit;
+};
+#endif  // U_HIDE_DRAFT_API
+
 U_NAMESPACE_END
 
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -34,6 +34,7 @@ U_NAMESPACE_BEGIN
 
 class FieldPositionHandler;
 class FormattedListData;
+class FormattingArena;
 class ListFormatter;
 
 /** @internal */
@@ -235,6 +236,28 @@ class U_I18N_API ListFormatter : public UObject{
         int32_t n_items,
         UErrorCode& errorCode) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Formats a list of strings to a FormattedList,
+     * with the result in the arena rather than on the heap.
+     *
+     * The FormattedList must be destroyed before the arena is reset or destroyed.
+     *
+     * @param items     An array of strings to be combined and formatted.
+     * @param n_items   Length of the array items.
+     * @param arena     The arena for the result's memory.
+     * @param errorCode ICU error code returned here.
+     * @return          A FormattedList containing field information.
+     * @see FormattingArena
+     * @draft ICU 79
+     */
+    FormattedList formatStringsToValue(
+        const UnicodeString items[],
+        int32_t n_items,
+        FormattingArena& arena,
+        UErrorCode& errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
 #ifndef U_HIDE_INTERNAL_API
     /**
       @internal for MeasureFormat
@@ -266,6 +289,12 @@ class U_I18N_API ListFormatter : public UObject{
      */
     static ListFormatter* createInstance(const Locale& locale, const char* style, UErrorCode& errorCode);
 
+    FormattedList formatStringsToValue(
+        const UnicodeString items[],
+        int32_t n_items,
+        FormattingArena* arena,
+        UErrorCode& errorCode) const;
+
     static void initializeHash(UErrorCode& errorCode);
     static const ListFormatInternal* getListFormatInternal(const Locale& locale, const char *style, UErrorCode& errorCode);
     struct U_HIDDEN ListPatternsSink;
@@ -149,6 +149,7 @@ struct MicroProps;
 class DecimalQuantity;
 class UFormattedNumberData;
 class NumberFormatterImpl;
+class SharedNumberFormatterImpl;
 struct ParsedPatternInfo;
 class ScientificModifier;
 class MultiplierProducer;
@@ -2562,6 +2563,131 @@ class U_I18N_API LocalizedNumberFormatter
      */
     FormattedNumber formatDecimal(StringPiece value, UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Format the given integer number to a string using the settings specified in the NumberFormatter fluent
+     * setting chain, with the result in the arena rather than on the heap.
+     *
+     * The FormattedNumber must be destroyed before the arena is reset or destroyed.
+     *
+     * @param value
+     *            The number to format.
+     * @param arena
+     *            The arena for the result's memory.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return A FormattedNumber object; call .toTempString() to get the string without copying it.
+     * @see FormattingArena
+     * @draft ICU 79
+     */
+    FormattedNumber formatInt(int64_t value, FormattingArena& arena, UErrorCode& status) const;
+
+    /**
+     * Format the given float or double to a string using the settings specified in the NumberFormatter fluent
+     * setting chain, with the result in the arena rather than on the heap.
+     *
+     * The FormattedNumber must be destroyed before the arena is reset or destroyed.
+     *
+     * @param value
+     *            The number to format.
+     * @param arena
+     *            The arena for the result's memory.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return A FormattedNumber object; call .toTempString() to get the string without copying it.
+     * @see FormattingArena
+     * @draft ICU 79
+     */
+    FormattedNumber formatDouble(double value, FormattingArena& arena, UErrorCode& status) const;
+
+    /**
+     * Format the given decimal number to a string using the settings
+     * specified in the NumberFormatter fluent setting chain,
+     * with the result in the arena rather than on the heap.
+     *
+     * The FormattedNumber must be destroyed before the arena is reset or destroyed.
+     *
+     * @param value
+     *            The number to format.
+     * @param arena
+     *            The arena for the result's memory.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     * @return A FormattedNumber object; call .toTempString() to get the string without copying it.
+     * @see FormattingArena
+     * @draft ICU 79
+     */
+    FormattedNumber formatDecimal(StringPiece value, FormattingArena& arena, UErrorCode& status) const;
+
+    /**
+     * Formats an array of integers using the settings specified in the NumberFormatter fluent setting chain,
+     * appending the results one after the other to a single string.
+     *
+     * This is faster than calling formatInt() for each value: the formatter is compiled
+     * once for the whole batch, and no FormattedNumber is created per value.
+     *
+     * Example, for a formatter with the default settings in locale "en":
+     * <pre>
+     * int64_t values[] = {1234, -5};
+     * int32_t offsets[3];
+     * UnicodeString result;
+     * formatter.formatInts(values, 2, result, offsets, nullptr, status);
+     * // result = "1,234-5"; offsets = {0, 5, 7}
+     * </pre>
+     *
+     * @param values
+     *            The numbers to format.
+     * @param count
+     *            The number of values.
+     * @param appendTo
+     *            The string to which the formatted values are appended.
+     * @param offsets
+     *            If not nullptr, an array of count+1 indexes into appendTo:
+     *            Value i is at offsets[i]..offsets[i+1]-1.
+     * @param posIter
+     *            If not nullptr, receives the field positions of all of the values,
+     *            as indexes into appendTo.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     *            On failure, appendTo and offsets contain the values formatted before the error.
+     * @return appendTo
+     * @draft ICU 79
+     */
+    UnicodeString& formatInts(const int64_t* values, int32_t count, UnicodeString& appendTo,
+                              int32_t* offsets, FieldPositionIterator* posIter,
+                              UErrorCode& status) const;
+
+    /**
+     * Formats an array of doubles using the settings specified in the NumberFormatter fluent setting chain,
+     * appending the results one after the other to a single string.
+     *
+     * This is faster than calling formatDouble() for each value: the formatter is compiled
+     * once for the whole batch, and no FormattedNumber is created per value.
+     *
+     * @param values
+     *            The numbers to format.
+     * @param count
+     *            The number of values.
+     * @param appendTo
+     *            The string to which the formatted values are appended.
+     * @param offsets
+     *            If not nullptr, an array of count+1 indexes into appendTo:
+     *            Value i is at offsets[i]..offsets[i+1]-1.
+     * @param posIter
+     *            If not nullptr, receives the field positions of all of the values,
+     *            as indexes into appendTo.
+     * @param status
+     *            Set to an ErrorCode if one occurred in the setter chain or during formatting.
+     *            On failure, appendTo and offsets contain the values formatted before the error.
+     * @return appendTo
+     * @see formatInts
+     * @draft ICU 79
+     */
+    UnicodeString& formatDoubles(const double* values, int32_t count, UnicodeString& appendTo,
+                                 int32_t* offsets, FieldPositionIterator* posIter,
+                                 UErrorCode& status) const;
+#endif  // U_HIDE_DRAFT_API
+
 #ifndef U_HIDE_INTERNAL_API
 
             
@@ -2609,6 +2735,38 @@ class U_I18N_API LocalizedNumberFormatter
      */
     Format* toFormat(UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Returns a copy of this formatter that is fully prepared for formatting.
+     *
+     * By default, a LocalizedNumberFormatter builds its optimized internal data structures
+     * only after it has been used a few times, and each copy of it builds its own.
+     * The returned formatter has them built already, and its copies share them rather
+     * than building their own, which makes copying it cheap. Sharing is thread-safe.
+     *
+     * Changing a setting of the returned formatter, for example with precision(),
+     * returns a formatter that is not compiled.
+     *
+     * @param status
+     *            Set if an error occurs while building the data structures.
+     * @return The compiled formatter.
+     * @see NumberFormatter#compiledForSkeleton
+     * @draft ICU 79
+     */
+    LocalizedNumberFormatter compile(UErrorCode& status) const &;
+
+    /**
+     * Overload of compile() for use on an rvalue reference.
+     *
+     * @param status
+     *            Set if an error occurs while building the data structures.
+     * @return The compiled formatter.
+     * @see #compile
+     * @draft ICU 79
+     */
+    LocalizedNumberFormatter compile(UErrorCode& status) &&;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Disassociate the locale from this formatter.
      *
@@ -2684,11 +2842,14 @@ class U_I18N_API LocalizedNumberFormatter
     ~LocalizedNumberFormatter();
 
   private:
-    // Note: fCompiled can't be a LocalPointer because impl::NumberFormatterImpl is defined in an internal
-    // header, and LocalPointer needs the full class definition in order to delete the instance.
-    const impl::NumberFormatterImpl* fCompiled {nullptr};
+    // Note: fCompiled is reference-counted, and impl::SharedNumberFormatterImpl is defined in an internal
+    // header.
+    const impl::SharedNumberFormatterImpl* fCompiled {nullptr};
     char fUnsafeCallCount[8] {};  // internally cast to u_atomic_int32_t
 
+    // true if fCompiled was built by compile(): Copies of this formatter then share fCompiled.
+    bool fShareCompiled {false};
+
     // Owned pointer to a DecimalFormatWarehouse, used when copying a LocalizedNumberFormatter
     // from a DecimalFormat.
     const impl::DecimalFormatWarehouse* fWarehouse {nullptr};
@@ -2707,17 +2868,37 @@ class U_I18N_API LocalizedNumberFormatter
 
     void lnfCopyHelper(const LocalizedNumberFormatter& src, UErrorCode& status);
 
+    /** Shares the compiled formatter of src if it was built by compile(). */
+    void shareCompiled(const LocalizedNumberFormatter& src);
+
+    /** Adopts a reference to a compiled formatter, for compile(). */
+    void adoptSharedCompiled(const impl::SharedNumberFormatterImpl* compiled);
+
+    /** Implements compile() on this object. */
+    void compileInPlace(UErrorCode& status);
+
+    /** Implements NumberFormatter::compiledForSkeleton() on this object. */
+    void compileForSkeleton(const UnicodeString& skeleton, UErrorCode& status);
+
     /**
      * @return true if the compiled formatter is available.
      */
     bool computeCompiled(UErrorCode& status) const;
 
+    /** Implements formatInts() when ints != nullptr, or else formatDoubles(). */
+    UnicodeString& formatBatch(const int64_t* ints, const double* doubles, int32_t count,
+                               UnicodeString& appendTo, int32_t* offsets,
+                               FieldPositionIterator* posIter, UErrorCode& status) const;
+
     // To give the fluent setters access to this class's constructor:
     friend class NumberFormatterSettings<UnlocalizedNumberFormatter>;
     friend class NumberFormatterSettings<LocalizedNumberFormatter>;
 
     // To give UnlocalizedNumberFormatter::locale() access to this class's constructor:
     friend class UnlocalizedNumberFormatter;
+
+    // To give NumberFormatter::compiledForSkeleton() access to the compiled formatter:
+    friend class NumberFormatter;
 };
 
 #if (U_PF_WINDOWS <= U_PLATFORM && U_PLATFORM <= U_PF_CYGWIN) && defined(_MSC_VER)
@@ -2794,6 +2975,29 @@ class U_I18N_API NumberFormatter final {
     static UnlocalizedNumberFormatter forSkeleton(const UnicodeString& skeleton,
                                                   UParseError& perror, UErrorCode& status);
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Returns a compiled LocalizedNumberFormatter for a number skeleton string and a locale.
+     * See LocalizedNumberFormatter::compile().
+     *
+     * The compiled formatters are cached by skeleton string and locale, so that this is cheap
+     * after the first call for the same skeleton and locale, and all of the returned formatters
+     * share the same compiled formatter.
+     *
+     * @param skeleton
+     *            The skeleton string off of which to base this NumberFormatter.
+     * @param locale
+     *            The locale from which to load formats and symbols for number formatting.
+     * @param status
+     *            Set to U_NUMBER_SKELETON_SYNTAX_ERROR if the skeleton was invalid.
+     * @return A compiled LocalizedNumberFormatter.
+     * @see LocalizedNumberFormatter#compile
+     * @draft ICU 79
+     */
+    static LocalizedNumberFormatter compiledForSkeleton(const UnicodeString& skeleton,
+                                                        const Locale& locale, UErrorCode& status);
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Use factory methods instead of the constructor to create a NumberFormatter.
      */
@@ -487,6 +487,30 @@ class U_I18N_API_CLASS LocalizedNumberRangeFormatter
     U_I18N_API FormattedNumberRange formatFormattableRange(
         const Formattable& first, const Formattable& second, UErrorCode& status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Format the given Formattables to a string using the settings specified in the NumberRangeFormatter
+     * fluent setting chain, with the result in the arena rather than on the heap.
+     *
+     * The FormattedNumberRange must be destroyed before the arena is reset or destroyed.
+     *
+     * @param first
+     *            The first number in the range, usually to the left in LTR locales.
+     * @param second
+     *            The second number in the range, usually to the right in LTR locales.
+     * @param arena
+     *            The arena for the result's memory.
+     * @param status
+     *            Set if an error occurs while formatting.
+     * @return A FormattedNumberRange object; call .toTempString() to get the string without copying it.
+     * @see FormattingArena
+     * @draft ICU 79
+     */
+    U_I18N_API FormattedNumberRange formatFormattableRange(
+        const Formattable& first, const Formattable& second, FormattingArena& arena,
+        UErrorCode& status) const;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Disassociate the locale from this formatter.
      *
@@ -63,7 +63,9 @@ U_NAMESPACE_BEGIN
 
 struct Regex8BitSet;
 class  RegexCImpl;
+class  RegexDFA;
 class  RegexMatcher;
+class  RegexNFA;
 class  RegexPattern;
 struct REStackFrame;
 class  BreakIterator;
@@ -327,6 +329,22 @@ class U_I18N_API RegexPattern final : public UObject {
     */
     uint32_t flags() const;
 
+#ifndef U_HIDE_DRAFT_API
+   /**
+    * Get the engine that matchers created from this pattern use.
+    * Patterns without back references, look-around, atomic or possessive
+    * constructs, \\X or UREGEX_UWORD word boundaries, and not too many nested
+    * repetitions of possibly empty expressions, are matched in linear time
+    * with an automaton when the input is a UnicodeString or UTF-16 UText
+    * and the matcher has no time limit or callbacks.  Everything else uses
+    * the backtracking engine.  The results are the same either way.
+    * @return  UREGEX_ENGINE_AUTOMATON if the pattern can be matched with the automaton,
+    *          otherwise UREGEX_ENGINE_BACKTRACKING
+    * @draft ICU 79
+    */
+    URegexEngine getEngine() const;
+#endif  // U_HIDE_DRAFT_API
+
    /**
     * Creates a RegexMatcher that will match the given input against this pattern.  The
     * RegexMatcher can then be used to perform match, find or replace operations
@@ -563,6 +581,90 @@ class U_I18N_API RegexPattern final : public UObject {
         int32_t          destCapacity,
         UErrorCode       &status) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Finds all of the matches of this pattern in the input, optionally on
+     * several threads.  The matches are the same, and in the same order, as those
+     * found by calling `RegexMatcher::find()` repeatedly on the whole input.
+     *
+     * The input is split into up to threadCount chunks.  Each chunk is searched
+     * by its own RegexMatcher, with transparent and non-anchoring bounds that
+     * extend maxMatchLength past the end of the chunk, so that matches which start
+     * in the chunk are found in full.  The calling thread then merges the matches
+     * of the chunks in order; where a match crosses into the next chunk, the search
+     * continues from its end until it finds a match that the next chunk found as well.
+     *
+     * If maxMatchLength is negative, then it is derived from the pattern.
+     * If the pattern can match strings of unbounded length, or if it contains \\G,
+     * then the whole input is searched on the calling thread.
+     * A maxMatchLength that is too small for the actual matches leads to
+     * truncated or missing matches where they cross chunk boundaries.
+     *
+     * Only the start and limit of each match are returned.  The capture groups
+     * of a match can be obtained with a RegexMatcher, by setting its region
+     * to start at the match and calling `RegexMatcher::lookingAt()`.
+     *
+     * @param input        The string to be searched.
+     * @param maxMatchLength The maximum length of a match, in UTF-16 code units,
+     *                     or a negative value to derive it from the pattern.
+     * @param threadCount  The maximum number of threads to use.
+     *                     Values less than or equal to 1 search on the calling thread only.
+     * @param starts       Receives the start index of each match.
+     *                     Can be nullptr if destCapacity is 0.
+     * @param limits       Receives the index following the end of each match.
+     *                     Can be nullptr if destCapacity is 0.
+     * @param destCapacity The capacity of the starts and limits arrays.
+     *                     If there are more matches, then the status is set to
+     *                     U_BUFFER_OVERFLOW_ERROR.
+     * @param status       A reference to a UErrorCode to receive any errors.
+     * @return             The number of matches.
+     * @draft ICU 79
+     */
+    int32_t findAll(const UnicodeString &input,
+        int32_t          maxMatchLength,
+        int32_t          threadCount,
+        int32_t          *starts,
+        int32_t          *limits,
+        int32_t          destCapacity,
+        UErrorCode       &status) const;
+
+    /**
+     * Finds all of the matches of this pattern in the input, optionally on
+     * several threads.  The matches are the same, and in the same order, as those
+     * found by calling `RegexMatcher::find()` repeatedly on the whole input.
+     * See the UnicodeString version of this function for details.
+     *
+     * Each thread works on a shallow clone of the input UText.
+     * A maxMatchLength derived from the pattern counts UTF-16 code units;
+     * for UTF-8 input (see utext_openUTF8()) it is converted to a number of bytes.
+     * For other input with native indexes that are not UTF-16 indexes,
+     * a negative maxMatchLength makes the whole input be searched on the calling thread.
+     *
+     * @param input        The text to be searched.
+     * @param maxMatchLength The maximum length of a match, in native units of the input,
+     *                     or a negative value to derive it from the pattern.
+     * @param threadCount  The maximum number of threads to use.
+     *                     Values less than or equal to 1 search on the calling thread only.
+     * @param starts       Receives the native start index of each match.
+     *                     Can be nullptr if destCapacity is 0.
+     * @param limits       Receives the native index following the end of each match.
+     *                     Can be nullptr if destCapacity is 0.
+     * @param destCapacity The capacity of the starts and limits arrays.
+     *                     If there are more matches, then the status is set to
+     *                     U_BUFFER_OVERFLOW_ERROR.
+     * @param status       A reference to a UErrorCode to receive any errors.
+     * @return             The number of matches.
+     * @draft ICU 79
+     */
+    int32_t findAll(UText *input,
+        int64_t          maxMatchLength,
+        int32_t          threadCount,
+        int64_t          *starts,
+        int64_t          *limits,
+        int32_t          destCapacity,
+        UErrorCode       &status) const;
+#endif  // U_HIDE_DRAFT_API
+
 
     /**
      * ICU "poor man's RTTI", returns a UClassID for the actual class.
@@ -602,6 +704,13 @@ class U_I18N_API RegexPattern final : public UObject {
                                    //   value may be less than the true shortest
                                    //   possible match.
     
+    int32_t         fMaxMatchLen;  // Maximum Match Length, in UTF-16 code units, or
+                                   //   INT32_MAX if unbounded.  May be larger than
+                                   //   the true longest possible match.
+
+    UBool           fUsesBackslashG; // The pattern contains \G, so that its matches depend
+                                   //   on where the previous match ended.
+
     int32_t         fFrameSize;    // Size of a state stack frame in the
                                    //   execution engine.
 
@@ -622,9 +731,17 @@ class U_I18N_API RegexPattern final : public UObject {
 
     UHashtable     *fNamedCaptureMap;  // Map from capture group names to numbers.
 
+    RegexNFA       *fNFA;          // For matching in linear time, or nullptr if the pattern
+                                   //   needs the backtracking engine.
+
+    UnicodeString   fRequiredStrings;  // Literal strings, one of which occurs in every
+                                   //   match, each preceded by its length.  Empty if
+                                   //   none are known.
+
     friend class RegexCompile;
     friend class RegexMatcher;
     friend class RegexCImpl;
+    friend class RegexNFA;
 
     //
     //  Implementation Methods
@@ -1788,8 +1905,14 @@ class U_I18N_API RegexMatcher final : public UObject {
     
     UBool                findUsingChunk(UErrorCode &status);
     void                 MatchChunkAt(int32_t startIdx, UBool toEnd, UErrorCode &status);
+    template<typename Text>
+    void                 MatchChunkAt(Text text, int32_t startIdx, UBool toEnd, UErrorCode &status);
     UBool                isChunkWordBoundary(int32_t pos);
 
+    UBool                useAutomaton();
+    void                 MatchAutomatonAt(int32_t startIdx, int32_t testLen, UBool toEnd,
+                                          UErrorCode &status);
+
     const RegexPattern  *fPattern;
     RegexPattern        *fPatternOwned;    // Non-nullptr if this matcher owns the pattern, and
                                            //   should delete it when through.
@@ -1872,7 +1995,161 @@ class U_I18N_API RegexMatcher final : public UObject {
 
     BreakIterator       *fWordBreakItr;
     BreakIterator       *fGCBreakItr;
+
+    RegexDFA            *fDFA;             // The automaton engine's working state, created
+                                           //   on first use.  See RegexPattern::getEngine().
+
+    int64_t             fRequiredFrom;     // find() start position from which fRequiredLast
+                                           //   was computed, or -1 if not computed.
+    int32_t             fRequiredLast;     // Start of the last occurrence of a pattern's
+                                           //   required string after fRequiredFrom, or -1.
+};
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Class `RegexSet` holds a collection of compiled regular expressions
+ * and finds which of them match an input string.
+ *
+ * For each pattern, the result is the same as calling `RegexMatcher::find()`
+ * once on the whole input with that pattern; a pattern matches if it occurs
+ * anywhere in the input. Instead of a separate search per pattern, the patterns
+ * are translated into a single automaton that is run once over the input,
+ * so that the time taken grows much more slowly with the number of patterns.
+ *
+ * Patterns that use back references, look-around assertions, atomic or
+ * possessive constructs, `\X`, or #UREGEX_UWORD word boundaries cannot be
+ * expressed that way. They are allowed, but are matched one at a time with
+ * a RegexMatcher.
+ *
+ * A RegexSet cannot be modified after it has been compiled, and it may be
+ * used concurrently by multiple threads.
+ *
+ * Class RegexSet is not intended to be subclassed.
+ *
+ * @draft ICU 79
+ */
+class U_I18N_API RegexSet final : public UObject {
+public:
+    /**
+     * Compiles a set of regular expressions.
+     *
+     * @param patterns The regular expressions to be compiled.
+     * @param count    The number of patterns.
+     * @param flags    The #URegexpFlag match mode flags to be used for all of the patterns.
+     * @param pe       Receives the position (line and column numbers) of an error
+     *                 within the first pattern that fails to compile.
+     * @param errorIndex Receives the index in patterns[] of the first pattern
+     *                 that fails to compile, or -1 if all of them compile
+     *                 (even if the set fails for another reason).
+     * @param status   A reference to a UErrorCode to receive any errors.
+     * @return         A RegexSet object, or nullptr if there was an error.
+     *                 The caller owns the object and must delete it.
+     * @draft ICU 79
+     */
+    static RegexSet * U_EXPORT2 compile(const UnicodeString patterns[],
+        int32_t              count,
+        uint32_t             flags,
+        UParseError          &pe,
+        int32_t              &errorIndex,
+        UErrorCode           &status);
+
+    /**
+     * Compiles a set of regular expressions.
+     *
+     * @param patterns The regular expressions to be compiled.
+     * @param count    The number of patterns.
+     * @param flags    The #URegexpFlag match mode flags to be used for all of the patterns.
+     * @param status   A reference to a UErrorCode to receive any errors.
+     * @return         A RegexSet object, or nullptr if there was an error.
+     *                 The caller owns the object and must delete it.
+     * @draft ICU 79
+     */
+    static RegexSet * U_EXPORT2 compile(const UnicodeString patterns[],
+        int32_t              count,
+        uint32_t             flags,
+        UErrorCode           &status);
+
+    /**
+     * Destructor.
+     * @draft ICU 79
+     */
+    virtual ~RegexSet();
+
+    /**
+     * Returns the number of patterns in this set.
+     * @return the number of patterns
+     * @draft ICU 79
+     */
+    int32_t size() const;
+
+    /**
+     * Returns one of the compiled patterns.
+     * The RegexSet keeps ownership of the pattern.
+     * @param index The index of the pattern, in the order that the patterns were
+     *              passed to compile().
+     * @return the pattern, or nullptr if the index is out of range
+     * @draft ICU 79
+     */
+    const RegexPattern *getPattern(int32_t index) const;
+
+    /**
+     * Finds which of the patterns match the input.
+     *
+     * The indexes of the matching patterns, in the order that the patterns were
+     * passed to compile(), are written to dest in ascending order.
+     * If there are more than destCapacity of them, then the status is set to
+     * U_BUFFER_OVERFLOW_ERROR, and the return value is the number needed.
+     *
+     * @param input        The input string.
+     * @param dest         Receives the indexes of the matching patterns.
+     *                     Can be nullptr if destCapacity is 0.
+     * @param destCapacity The capacity of dest.
+     * @param status       A reference to a UErrorCode to receive any errors.
+     * @return the number of patterns that match
+     * @draft ICU 79
+     */
+    int32_t matches(const UnicodeString &input, int32_t *dest, int32_t destCapacity,
+                    UErrorCode &status) const;
+
+    /**
+     * Tests whether any of the patterns match the input.
+     * This can be faster than matches() because it stops at the first match.
+     *
+     * @param input   The input string.
+     * @param status  A reference to a UErrorCode to receive any errors.
+     * @return true if at least one of the patterns matches
+     * @draft ICU 79
+     */
+    UBool matchesAny(const UnicodeString &input, UErrorCode &status) const;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for the actual class.
+     *
+     * @draft ICU 79
+     */
+    virtual UClassID getDynamicClassID() const override;
+
+    /**
+     * ICU "poor man's RTTI", returns a UClassID for this class.
+     *
+     * @draft ICU 79
+     */
+    static UClassID U_EXPORT2 getStaticClassID();
+
+private:
+    RegexSet();
+    RegexSet(const RegexSet &other) = delete;
+    RegexSet &operator =(const RegexSet &other) = delete;
+
+    int32_t match(const UnicodeString &input, UBool stopAtFirst,
+                  UBool *matched, UErrorCode &status) const;
+
+    UVector         *fPatterns;    // The compiled RegexPatterns, owned.
+    UVector32       *fFallback;    // Indexes of the patterns that are matched with a
+                                   //   RegexMatcher rather than the NFA.
+    RegexNFA        *fNFA;         // The patterns that can be matched together.
 };
+#endif  // U_HIDE_DRAFT_API
 
 U_NAMESPACE_END
 #endif  // UCONFIG_NO_REGULAR_EXPRESSIONS
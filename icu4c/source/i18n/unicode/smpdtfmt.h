@@ -933,6 +933,93 @@ class U_I18N_API_CLASS SimpleDateFormat: public DateFormat {
                    Calendar& cal,
                    UErrorCode& status) const; // in case of illegal argument
 
+    /**
+     * The Gregorian calendar fields used by fastSubFormat().
+     */
+    struct FastFields;
+
+    /**
+     * Computes only the fields that fastSubFormat() needs, directly from the date.
+     *
+     * @param date      The date to format.
+     * @param cal       Provides the calendar type, time zone, and Gregorian change.
+     * @param fields    Receives the fields.
+     * @return true if the pattern can be formatted with fastSubFormat(),
+     *         false if subFormat() must be used.
+     */
+    UBool computeFastFields(UDate date, const Calendar& cal, FastFields& fields) const;
+
+    /**
+     * Formats the date with fastSubFormat() if computeFastFields() allows it,
+     * without computing all of the calendar fields.
+     * Called by format() and by DateFormat::format(UDate ...).
+     *
+     * @param date      The date to format.
+     * @param cal       Provides the calendar type, time zone, and Gregorian change.
+     * @param appendTo  Output parameter to receive result.
+     *                  Result is appended to existing contents.
+     * @param handler   Records information about field positions.
+     * @return true if the date was formatted, false if it was not.
+     */
+    UBool fastFormat(UDate date, const Calendar& cal, UnicodeString& appendTo,
+                     FieldPositionHandler& handler) const;
+
+    /**
+     * Called by fastFormat() instead of subFormat() for patterns with only Gregorian
+     * numeric, month, weekday, and AM/PM fields. Produces the same output as subFormat().
+     *
+     * @param appendTo  Output parameter to receive result.
+     *                  Result is appended to existing contents.
+     * @param ch        The format character we encountered in the pattern.
+     * @param count     Number of characters in the current pattern symbol.
+     * @param fields    The fields from computeFastFields().
+     * @param handler   Records information about field positions.
+     */
+    void fastSubFormat(UnicodeString &appendTo,
+                       char16_t ch,
+                       int32_t count,
+                       const FastFields& fields,
+                       FieldPositionHandler& handler) const;
+
+    /**
+     * A pattern compiled by parsePattern() for fastParse():
+     * its fields and literal texts in pattern order.
+     */
+    struct FastParsePattern;
+
+    /**
+     * Parses the text without a Calendar, for patterns with only Gregorian
+     * numeric, month, weekday, and AM/PM fields.
+     * Called by DateFormat::parse(text, pos).
+     * If it returns true, then the result is the same as from
+     * parse(text, cal, pos) followed by cal.getTime().
+     *
+     * @param text  The date/time string to be parsed.
+     * @param pos   On input, the position at which to start parsing; on
+     *              output, the position at which parsing terminated.
+     *              Not changed if the function returns false.
+     * @param date  Receives the parsed date.
+     * @return true if the text was parsed, false if parse() must be used.
+     */
+    UBool fastParse(const UnicodeString& text, ParsePosition& pos, UDate& date) const;
+
+    /**
+     * Called by fastParse() instead of subParse() for one field.
+     *
+     * @param text      The date/time string to be parsed.
+     * @param start     The position at which the field starts.
+     * @param ch        The pattern character for the field.
+     * @param count     Number of characters in the current pattern symbol.
+     * @param obeyCount If true, then the field is one of a run of abutting
+     *                  numeric fields, and at most count digits are parsed.
+     * @param zeroDigit The zero digit of the NumberFormat.
+     * @param fields    Receives the field value, indexed by UCalendarDateFields.
+     * @return the position after the field, or -1 if subParse() must be used.
+     */
+    int32_t fastSubParse(const UnicodeString& text, int32_t start, char16_t ch,
+                         int32_t count, UBool obeyCount, char16_t zeroDigit,
+                         int32_t fields[]) const;
+
     /**
      * Used by subFormat() to format a numeric value.
      * Appends to toAppendTo a string representation of "value"
@@ -1268,9 +1355,12 @@ class U_I18N_API_CLASS SimpleDateFormat: public DateFormat {
     UBool                fHasMinute;
     UBool                fHasSecond;
     UBool                fHasHanYearChar; // pattern contains the Han year character \u5E74
+    UBool                fHasOnlyFastFields; // pattern contains only fields that fastSubFormat() handles
+    FastParsePattern*    fFastParsePattern = nullptr; // Owned; nullptr if fastParse() cannot parse the pattern
 
     /**
-     * Sets fHasMinutes and fHasSeconds.
+     * Sets fHasMinutes, fHasSeconds, fHasHanYearChar, fHasOnlyFastFields,
+     * and fFastParsePattern.
      */
     void                 parsePattern();
 
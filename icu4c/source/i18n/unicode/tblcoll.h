@@ -87,6 +87,7 @@ class StringSearch;
 * @stable ICU 2.0
 */
 class CollationElementIterator;
+class CollationIterator;
 class CollationKey;
 class SortKeyByteSink;
 class UnicodeSet;
@@ -662,6 +663,71 @@ class U_I18N_API_CLASS RuleBasedCollator final : public Collator {
                                           uint8_t* result,
                                           int32_t resultLength) const override;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Writes the sort keys for an array of strings back to back into one buffer.
+     * Each sort key is the same as from getSortKey(), including its terminating zero byte.
+     * This is faster than calling getSortKey() for each string,
+     * because the setup work is done only once for the whole batch.
+     *
+     * The offsets do not depend on the buffer capacity,
+     * so they are also set when preflighting.
+     *
+     * @param sources array of count strings
+     * @param sourceLengths array of count string lengths, each -1 for a NUL-terminated string;
+     *        or nullptr if all of the strings are NUL-terminated
+     * @param count number of strings
+     * @param result buffer for the sort keys; can be nullptr if resultCapacity==0
+     * @param resultCapacity capacity of the result buffer
+     * @param offsets array of count+1 indexes into result: the sort key for sources[i]
+     *        is at result[offsets[i]..offsets[i+1]-1]. Can be nullptr.
+     * @param errorCode ICU error code in/out parameter.
+     *        Set to U_BUFFER_OVERFLOW_ERROR if the sort keys do not all fit into result.
+     * @return the total length of all of the sort keys
+     * @see ucol_getSortKeys
+     * @draft ICU 79
+     */
+    U_I18N_API int32_t getSortKeys(const char16_t* const* sources,
+                                   const int32_t* sourceLengths,
+                                   int32_t count,
+                                   uint8_t* result,
+                                   int32_t resultCapacity,
+                                   int32_t* offsets,
+                                   UErrorCode& errorCode) const;
+#endif  /* U_HIDE_DRAFT_API */
+
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Writes a fixed-length prefix of the sort key for each of an array of strings.
+     * Each prefix is the first prefixLength bytes of the getSortKey() result,
+     * padded with zero bytes if the sort key is shorter.
+     * The sort key starts with the primary weights, most significant byte first.
+     *
+     * Comparing two prefixes with memcmp() yields the same order as comparing
+     * the strings, unless the prefixes are equal and do not contain a zero byte;
+     * only then do the strings need to be compared in full.
+     * Computing a prefix stops early once it is full, which makes this much faster
+     * than computing whole sort keys for long strings.
+     *
+     * @param sources array of count strings
+     * @param sourceLengths array of count string lengths, each -1 for a NUL-terminated string;
+     *        or nullptr if all of the strings are NUL-terminated
+     * @param count number of strings
+     * @param prefixes buffer of count*prefixLength bytes which receives the prefixes;
+     *        the prefix for sources[i] starts at prefixes[i*prefixLength]
+     * @param prefixLength number of bytes per prefix, must be greater than 0
+     * @param errorCode ICU error code in/out parameter
+     * @see ucol_getSortKeyPrefixes
+     * @draft ICU 79
+     */
+    U_I18N_API void getSortKeyPrefixes(const char16_t* const* sources,
+                                       const int32_t* sourceLengths,
+                                       int32_t count,
+                                       uint8_t* prefixes,
+                                       int32_t prefixLength,
+                                       UErrorCode& errorCode) const;
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Retrieves the reordering codes for this collator.
      * @param dest The array to fill with the script ordering.
@@ -848,6 +914,14 @@ class U_I18N_API_CLASS RuleBasedCollator final : public Collator {
     void writeSortKey(const char16_t *s, int32_t length,
                       SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
+    // iter must have been set to the text [s, limit[.
+    void writeSortKey(CollationIterator &iter, const char16_t *s, const char16_t *limit,
+                      SortKeyByteSink &sink, UErrorCode &errorCode) const;
+
+    // Like writeSortKey() but stops as soon as the sink is full.
+    void writeSortKeyPrefix(CollationIterator &iter, const char16_t *s, const char16_t *limit,
+                            SortKeyByteSink &sink, UErrorCode &errorCode) const;
+
     void writeIdenticalLevel(const char16_t *s, const char16_t *limit,
                              SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
@@ -651,6 +651,35 @@ class U_I18N_API Transliterator : public UObject {
      */
     virtual void transliterate(Replaceable& text) const;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Transliterates a string and appends the result to another string.
+     * The source is not modified, and the current contents of dest
+     * are not used as context.
+     *
+     * The result is the same as when copying the source into a
+     * UnicodeString and transliterating it in place with
+     * transliterate(Replaceable&), but this is much faster for long
+     * strings.  Each replacement that changes the length of a
+     * UnicodeString moves all of the text after it.  This method
+     * transliterates in a buffer where each transliterator only
+     * appends its output to the text already processed, also when
+     * the stages of a compound transliterator run one after another.
+     *
+     * @param src the source text; may alias dest
+     * @param srcLength the length of src, or -1 if it is NUL-terminated
+     * @param dest the transliterated text is appended to this string
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @return dest
+     * @draft ICU 79
+     */
+    UnicodeString& transliterate(ConstChar16Ptr src, int32_t srcLength,
+                                 UnicodeString& dest, UErrorCode& errorCode) const;
+#endif  // U_HIDE_DRAFT_API
+
     /**
      * Transliterates the portion of the text buffer that can be
      * transliterated unambiguosly after new text has been inserted,
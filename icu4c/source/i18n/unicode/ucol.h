@@ -1035,6 +1035,119 @@ ucol_getSortKey(const    UCollator    *coll,
         uint8_t        *result,
         int32_t        resultLength);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Get the sort keys for an array of strings, written back to back into one buffer.
+ * Each sort key is the same as from ucol_getSortKey(), including its terminating zero byte.
+ * This is faster than calling ucol_getSortKey() for each string,
+ * because the setup work is done only once for the whole batch.
+ *
+ * The offsets do not depend on the buffer capacity,
+ * so they are also set when preflighting.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count strings to transform.
+ * @param sourceLengths Array of count string lengths, each -1 for a NUL-terminated string;
+ *        or NULL if all of the strings are NUL-terminated.
+ * @param count The number of strings.
+ * @param result A buffer to receive the sort keys. Can be NULL if resultCapacity==0.
+ * @param resultCapacity The capacity of result.
+ * @param offsets Array of count+1 indexes into result: The sort key for sources[i]
+ *        is at result[offsets[i]..offsets[i+1]-1]. Can be NULL.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ *        Set to U_BUFFER_OVERFLOW_ERROR if the sort keys do not all fit into result.
+ * @return The total length of all of the sort keys.
+ * @see ucol_getSortKey
+ * @draft ICU 79
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const *sources,
+                 const int32_t *sourceLengths,
+                 int32_t count,
+                 uint8_t *result,
+                 int32_t resultCapacity,
+                 int32_t *offsets,
+                 UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Get a fixed-length prefix of the sort key for each of an array of strings,
+ * for example for a radix sort or for a compact database index column.
+ * Each prefix is the first prefixLength bytes of the ucol_getSortKey() result,
+ * padded with zero bytes if the sort key is shorter.
+ * The sort key starts with the primary weights, most significant byte first,
+ * so with an 8-byte prefix the primary weights of the first few characters
+ * can be read as one big-endian 64-bit integer.
+ *
+ * Comparing two prefixes with memcmp() yields the same order as comparing
+ * the strings, unless the prefixes are equal and do not contain a zero byte;
+ * only then do the strings need to be compared in full.
+ * Computing a prefix stops early once it is full, which makes this much faster
+ * than computing whole sort keys for long strings.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count strings to transform.
+ * @param sourceLengths Array of count string lengths, each -1 for a NUL-terminated string;
+ *        or NULL if all of the strings are NUL-terminated.
+ * @param count The number of strings.
+ * @param prefixes A buffer of count*prefixLength bytes which receives the prefixes:
+ *        The prefix for sources[i] starts at prefixes[i*prefixLength].
+ * @param prefixLength The number of bytes per prefix. Must be greater than 0.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @see ucol_getSortKey
+ * @see ucol_getSortKeys
+ * @draft ICU 79
+ */
+U_CAPI void U_EXPORT2
+ucol_getSortKeyPrefixes(const UCollator *coll,
+                        const UChar *const *sources,
+                        const int32_t *sourceLengths,
+                        int32_t count,
+                        uint8_t *prefixes,
+                        int32_t prefixLength,
+                        UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Sorts an array of strings according to the collator.
+ * The strings themselves are not moved; instead, indexes is set to the
+ * permutation of 0..count-1 that lists the strings in sort order.
+ * The sort is stable: Strings that compare equal keep their relative order.
+ *
+ * The strings are split into chunks which are sorted via their sort keys
+ * (see ucol_getSortKeys()) and then merged.
+ * If threadCount is greater than 1 and there are enough strings,
+ * then up to threadCount threads (including the calling thread) work on
+ * the chunks and on the merge steps in parallel.
+ * The collator is only used via const functions, which are safe to call
+ * concurrently; it must not be modified while this function runs.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param strings Array of count strings to sort.
+ * @param lengths Array of count string lengths, each -1 for a NUL-terminated string;
+ *        or NULL if all of the strings are NUL-terminated.
+ * @param count The number of strings.
+ * @param indexes Array of count indexes which receives the sort order:
+ *        strings[indexes[0]] sorts first.
+ * @param threadCount The maximum number of threads to use.
+ *        Values less than or equal to 1 sort on the calling thread only.
+ * @param status A pointer to a UErrorCode to receive any errors.
+ * @see ucol_getSortKeys
+ * @draft ICU 79
+ */
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar *const *strings,
+                 const int32_t *lengths,
+                 int32_t count,
+                 int32_t *indexes,
+                 int32_t threadCount,
+                 UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /** Gets the next count bytes of a sort key. Caller needs
  *  to preserve state array between calls and to provide
@@ -112,6 +112,30 @@ typedef enum URegexpFlag{
 
 }  URegexpFlag;
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * The matching engines that a compiled regular expression can use.
+ * See RegexPattern::getEngine().
+ * @draft ICU 79
+ */
+typedef enum URegexEngine {
+    /**
+     * The backtracking engine, which supports all regular expression features,
+     * but can take time exponential in the length of the input for some patterns.
+     * @draft ICU 79
+     */
+    UREGEX_ENGINE_BACKTRACKING = 0,
+    /**
+     * An automaton engine, used for patterns without back references, look-around,
+     * atomic or possessive constructs, \\X or UREGEX_UWORD word boundaries.
+     * It finds the same matches as the backtracking engine, in time linear
+     * in the length of the input.
+     * @draft ICU 79
+     */
+    UREGEX_ENGINE_AUTOMATON = 1
+} URegexEngine;
+#endif /* U_HIDE_DRAFT_API */
+
 /**
   *  Open (compile) an ICU regular expression.  Compiles the regular expression in
   *  string form into an internal representation using the specified match mode flags.
@@ -302,6 +326,21 @@ U_CAPI int32_t U_EXPORT2
 uregex_flags(const  URegularExpression   *regexp,
                     UErrorCode           *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+  * Get the engine that is used to match this regular expression.
+  * See RegexPattern::getEngine() for when the automaton engine is used.
+  * @param regexp   The compiled regular expression.
+  * @param status   Receives errors detected by this function.
+  * @return         The matching engine
+  * @see URegexEngine
+  * @draft ICU 79
+  */
+U_CAPI URegexEngine U_EXPORT2
+uregex_getEngine(const URegularExpression *regexp,
+                 UErrorCode               *status);
+#endif /* U_HIDE_DRAFT_API */
+
 
 /**
   *  Set the subject text string upon which the regular expression will look for matches.
@@ -364,6 +364,21 @@ uregex_flags(const URegularExpression *regexp2, UErrorCode *status)  {
 }
 
 
+//------------------------------------------------------------------------------
+//
+//    uregex_getEngine
+//
+//------------------------------------------------------------------------------
+U_CAPI URegexEngine U_EXPORT2
+uregex_getEngine(const URegularExpression *regexp2, UErrorCode *status)  {
+    RegularExpression *regexp = (RegularExpression*)regexp2;
+    if (validateRE(regexp, false, status) == false) {
+        return UREGEX_ENGINE_BACKTRACKING;
+    }
+    return regexp->fPat->getEngine();
+}
+
+
 //------------------------------------------------------------------------------
 //
 //    uregex_setText
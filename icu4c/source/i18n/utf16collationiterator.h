@@ -97,6 +97,13 @@ class U_I18N_API FCDUTF16CollationIterator : public UTF16CollationIterator {
 
     virtual bool operator==(const CollationIterator &other) const override;
 
+    void setText(const char16_t *s, const char16_t *lim) {
+        UTF16CollationIterator::setText(s, lim);
+        rawStart = segmentStart = s;
+        rawLimit = lim;
+        checkDir = 1;
+    }
+
     virtual void resetToOffset(int32_t newOffset) override;
 
     virtual int32_t getOffset() const override;
@@ -83,6 +83,8 @@ void addCollAPITest(TestNode** root)
     addTest(root, &TestAttribute, "tscoll/capitst/TestAttribute");
     addTest(root, &TestGetTailoredSet, "tscoll/capitst/TestGetTailoredSet");
     addTest(root, &TestMergeSortKeys, "tscoll/capitst/TestMergeSortKeys");
+    addTest(root, &TestGetSortKeys, "tscoll/capitst/TestGetSortKeys");
+    addTest(root, &TestSortStrings, "tscoll/capitst/TestSortStrings");
     addTest(root, &TestShortString, "tscoll/capitst/TestShortString");
     addTest(root, &TestGetContractionsAndUnsafes, "tscoll/capitst/TestGetContractionsAndUnsafes");
     addTest(root, &TestOpenBinary, "tscoll/capitst/TestOpenBinary");
@@ -2018,6 +2020,215 @@ static const char * strengthsC[] = {
      "UCOL_IDENTICAL"
 };
 
+/* Each batch sort key must be the same as the one from ucol_getSortKey(). */
+static void checkGetSortKeys(UCollator *coll, const char *name,
+                             const UChar *const *sources, const int32_t *lengths, int32_t count) {
+    uint8_t keys[2000], key[200];
+    int32_t offsets[20];
+    int32_t totalLength, partialLength, expectedOffset = 0, i;
+    UErrorCode status = U_ZERO_ERROR;
+
+    /* preflighting */
+    totalLength = ucol_getSortKeys(coll, sources, lengths, count, NULL, 0, offsets, &status);
+    if(status != U_BUFFER_OVERFLOW_ERROR || totalLength <= 0 || offsets[count] != totalLength) {
+        log_err("%s: preflighting ucol_getSortKeys() failed - %s\n", name, u_errorName(status));
+        return;
+    }
+    status = U_ZERO_ERROR;
+    if(totalLength != ucol_getSortKeys(coll, sources, lengths, count, keys, UPRV_LENGTHOF(keys), offsets, &status) ||
+            U_FAILURE(status)) {
+        log_err("%s: ucol_getSortKeys() failed - %s\n", name, u_errorName(status));
+        return;
+    }
+    for(i = 0; i < count; ++i) {
+        int32_t length = ucol_getSortKey(coll, sources[i], lengths != NULL ? lengths[i] : -1, key, UPRV_LENGTHOF(key));
+        if(offsets[i] != expectedOffset || offsets[i + 1] - offsets[i] != length ||
+                uprv_memcmp(keys + offsets[i], key, length) != 0) {
+            log_err("%s: ucol_getSortKeys() key %d differs from ucol_getSortKey()\n", name, (int)i);
+        }
+        expectedOffset += length;
+    }
+
+    /* a buffer that is too short still yields all of the offsets */
+    status = U_ZERO_ERROR;
+    offsets[count] = 0;
+    partialLength = ucol_getSortKeys(coll, sources, lengths, count, keys, totalLength - 1, offsets, &status);
+    if(status != U_BUFFER_OVERFLOW_ERROR || partialLength != totalLength || offsets[count] != totalLength) {
+        log_err("%s: ucol_getSortKeys() with a short buffer failed - %s\n", name, u_errorName(status));
+    }
+}
+
+static void checkGetSortKeyPrefixes(UCollator *coll, const char *name,
+                                    const UChar *const *sources, const int32_t *lengths, int32_t count) {
+    static const int32_t prefixLengths[] = { 1, 4, 8, 16, 64 };
+    uint8_t prefixes[20 * 64], key[200];
+    int32_t i, j;
+    for(j = 0; j < UPRV_LENGTHOF(prefixLengths); ++j) {
+        int32_t prefixLength = prefixLengths[j];
+        UErrorCode status = U_ZERO_ERROR;
+        uprv_memset(prefixes, 0x55, sizeof(prefixes));
+        ucol_getSortKeyPrefixes(coll, sources, lengths, count, prefixes, prefixLength, &status);
+        if(U_FAILURE(status)) {
+            log_err("%s: ucol_getSortKeyPrefixes(%d) failed - %s\n", name, (int)prefixLength, u_errorName(status));
+            return;
+        }
+        for(i = 0; i < count; ++i) {
+            const uint8_t *prefix = prefixes + i * prefixLength;
+            int32_t length = ucol_getSortKey(coll, sources[i], lengths != NULL ? lengths[i] : -1, key, UPRV_LENGTHOF(key));
+            if(length < prefixLength) {
+                uprv_memset(key + length, 0, prefixLength - length);
+            }
+            if(uprv_memcmp(prefix, key, prefixLength) != 0) {
+                log_err("%s: ucol_getSortKeyPrefixes(%d) prefix %d differs from the sort key\n",
+                        name, (int)prefixLength, (int)i);
+            }
+        }
+        if(prefixes[count * prefixLength] != 0x55) {
+            log_err("%s: ucol_getSortKeyPrefixes(%d) wrote past the end\n", name, (int)prefixLength);
+        }
+    }
+}
+
+void TestGetSortKeys(void) {
+    static const char *const strings[] = {
+        "abc", "", "ABC", "a\\u0327\\u0301b", "a\\u0301\\u0327b",
+        "\\u00e4rger", "item 12", "item 2", "\\u4e00\\ud840\\udc00", "co-op"
+    };
+    UChar buffers[UPRV_LENGTHOF(strings)][20];
+    const UChar *sources[UPRV_LENGTHOF(strings)];
+    int32_t lengths[UPRV_LENGTHOF(strings)];
+    int32_t count = UPRV_LENGTHOF(strings), i;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("en", &status);
+    if(U_FAILURE(status)) {
+        log_err_status(status, "Unable to open the en collator - %s\n", u_errorName(status));
+        return;
+    }
+    for(i = 0; i < count; ++i) {
+        lengths[i] = u_unescape(strings[i], buffers[i], UPRV_LENGTHOF(buffers[i]));
+        sources[i] = buffers[i];
+    }
+
+    checkGetSortKeys(coll, "default", sources, lengths, count);
+    checkGetSortKeyPrefixes(coll, "default", sources, lengths, count);
+    checkGetSortKeys(coll, "NUL-terminated", sources, NULL, count);
+    checkGetSortKeyPrefixes(coll, "NUL-terminated", sources, NULL, count);
+    ucol_setAttribute(coll, UCOL_NORMALIZATION_MODE, UCOL_ON, &status);
+    ucol_setAttribute(coll, UCOL_NUMERIC_COLLATION, UCOL_ON, &status);
+    checkGetSortKeys(coll, "normalization+numeric", sources, lengths, count);
+    checkGetSortKeyPrefixes(coll, "normalization+numeric", sources, lengths, count);
+    ucol_setAttribute(coll, UCOL_STRENGTH, UCOL_IDENTICAL, &status);
+    ucol_setAttribute(coll, UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, &status);
+    checkGetSortKeys(coll, "identical+shifted", sources, lengths, count);
+    checkGetSortKeyPrefixes(coll, "identical+shifted", sources, lengths, count);
+
+    /* empty batch */
+    status = U_ZERO_ERROR;
+    i = ucol_getSortKeys(coll, NULL, NULL, 0, NULL, 0, lengths, &status);
+    if(U_FAILURE(status) || i != 0 || lengths[0] != 0) {
+        log_err("ucol_getSortKeys() of no strings failed - %s\n", u_errorName(status));
+    }
+    /* illegal arguments */
+    status = U_ZERO_ERROR;
+    ucol_getSortKeys(coll, sources, lengths, -1, NULL, 0, NULL, &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_getSortKeys(count<0) did not fail - %s\n", u_errorName(status));
+    }
+    status = U_ZERO_ERROR;
+    ucol_getSortKeyPrefixes(coll, sources, lengths, count, NULL, 0, &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_getSortKeyPrefixes(prefixLength=0) did not fail - %s\n", u_errorName(status));
+    }
+    ucol_close(coll);
+}
+
+static void checkSortStrings(UCollator *coll, const UChar *const *strings, const int32_t *lengths,
+                             int32_t count, int32_t threadCount) {
+    int32_t *indexes = (int32_t *)malloc(count * sizeof(int32_t));
+    UBool *seen = (UBool *)calloc(count, sizeof(UBool));
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t i;
+    ucol_sortStrings(coll, strings, lengths, count, indexes, threadCount, &status);
+    if(U_FAILURE(status)) {
+        log_err("ucol_sortStrings(%d threads) failed - %s\n", (int)threadCount, u_errorName(status));
+        count = 0;
+    }
+    for(i = 0; i < count; ++i) {
+        int32_t index = indexes[i];
+        if(index < 0 || index >= count || seen[index]) {
+            log_err("ucol_sortStrings(%d threads) did not return a permutation at [%d]\n",
+                    (int)threadCount, (int)i);
+            break;
+        }
+        seen[index] = true;
+        if(i > 0) {
+            int32_t prev = indexes[i - 1];
+            UCollationResult order = ucol_strcoll(coll, strings[prev], lengths[prev],
+                                                  strings[index], lengths[index]);
+            if(order == UCOL_GREATER || (order == UCOL_EQUAL && prev > index)) {
+                log_err("ucol_sortStrings(%d threads) misordered strings %d and %d\n",
+                        (int)threadCount, (int)prev, (int)index);
+                break;
+            }
+        }
+    }
+    free(seen);
+    free(indexes);
+}
+
+void TestSortStrings(void) {
+    /* Syllables that sort differently in binary and collation order, some equal at primary level. */
+    static const char *const syllables[] = {
+        "a", "A", "\\u00e4", "b", "ch", "C", "\\u010d", "o", "\\u00f6", "z", "-", " "
+    };
+    enum { COUNT = 5000, MAX_LENGTH = 16 };
+    UChar *buffer = (UChar *)malloc(COUNT * MAX_LENGTH * sizeof(UChar));
+    const UChar *strings[COUNT];
+    int32_t lengths[COUNT];
+    int32_t indexes[4];
+    uint32_t seed = 1;
+    int32_t i, j;
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("de", &status);
+    if(U_FAILURE(status)) {
+        log_err_status(status, "Unable to open the de collator - %s\n", u_errorName(status));
+        free(buffer);
+        return;
+    }
+    for(i = 0; i < COUNT; ++i) {
+        UChar *s = buffer + i * MAX_LENGTH;
+        int32_t syllableCount = 1 + i % 4;
+        lengths[i] = 0;
+        for(j = 0; j < syllableCount; ++j) {
+            seed = seed * 1103515245 + 12345;
+            lengths[i] += u_unescape(syllables[(seed >> 16) % UPRV_LENGTHOF(syllables)],
+                                     s + lengths[i], MAX_LENGTH - lengths[i]);
+        }
+        strings[i] = s;
+    }
+
+    checkSortStrings(coll, strings, lengths, COUNT, 1);
+    checkSortStrings(coll, strings, lengths, COUNT, 3);
+    checkSortStrings(coll, strings, lengths, COUNT, 8);
+    ucol_setStrength(coll, UCOL_PRIMARY);
+    checkSortStrings(coll, strings, lengths, COUNT, 4);
+
+    /* fewer strings than threads */
+    status = U_ZERO_ERROR;
+    ucol_sortStrings(coll, strings, lengths, 3, indexes, 8, &status);
+    if(U_FAILURE(status) || indexes[0] < 0 || indexes[0] > 2) {
+        log_err("ucol_sortStrings() of 3 strings failed - %s\n", u_errorName(status));
+    }
+    /* illegal arguments */
+    status = U_ZERO_ERROR;
+    ucol_sortStrings(coll, strings, lengths, -1, indexes, 1, &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        log_err("ucol_sortStrings(count<0) did not fail - %s\n", u_errorName(status));
+    }
+    ucol_close(coll);
+    free(buffer);
+}
+
 void TestMergeSortKeys(void) {
    UErrorCode status = U_ZERO_ERROR;
    UCollator *coll = ucol_open("en", &status);
@@ -117,6 +117,16 @@
      */
     void TestMergeSortKeys(void);
 
+    /**
+     * Test ucol_getSortKeys and ucol_getSortKeyPrefixes
+     */
+    void TestGetSortKeys(void);
+
+    /**
+     * Test ucol_sortStrings with one and several threads
+     */
+    void TestSortStrings(void);
+
     /** 
      * test short string and collator identifier functions
      */
@@ -45,6 +45,7 @@ static void Test_WCHART_LongString(void);
 static void Test_strToJavaModifiedUTF8(void);
 static void Test_strFromJavaModifiedUTF8(void);
 static void TestNullEmptySource(void);
+static void Test_UTF8_ASCIIRuns(void);
 
 void 
 addUCharTransformTest(TestNode** root)
@@ -64,6 +65,7 @@ addUCharTransformTest(TestNode** root)
    addTest(root, &Test_strToJavaModifiedUTF8,  "custrtrn/Test_strToJavaModifiedUTF8");
    addTest(root, &Test_strFromJavaModifiedUTF8,  "custrtrn/Test_strFromJavaModifiedUTF8");
    addTest(root, &TestNullEmptySource,  "custrtrn/TestNullEmptySource");
+   addTest(root, &Test_UTF8_ASCIIRuns,  "custrtrn/Test_UTF8_ASCIIRuns");
 }
 
 static const UChar32 src32[]={
@@ -2115,3 +2117,77 @@ static void TestNullEmptySource(void) {
 
 #endif
 }
+
+/*
+ * The UTF-8 transformation functions copy runs of ASCII in blocks.
+ * Exercise ASCII runs of all lengths around the block sizes, with
+ * non-ASCII characters and ill-formed sequences at the run boundaries.
+ */
+static void Test_UTF8_ASCIIRuns(void) {
+    static const UChar32 nonASCII[] = { 0xe9, 0x4e00, 0x1f600 };
+    UChar in16[400], out16[400];
+    char in8[800], out8[800];
+    int32_t runLength;
+
+    for(runLength=0; runLength<=40; ++runLength) {
+        int32_t length16=0, length8=0, length, i, j;
+        UErrorCode errorCode=U_ZERO_ERROR;
+
+        for(i=0; i<UPRV_LENGTHOF(nonASCII); ++i) {
+            for(j=0; j<runLength; ++j) {
+                UChar c=(UChar)(0x20+(i*7+j)%0x5f);
+                in16[length16++]=c;
+                in8[length8++]=(char)c;
+            }
+            U16_APPEND_UNSAFE(in16, length16, nonASCII[i]);
+            U8_APPEND_UNSAFE(in8, length8, nonASCII[i]);
+        }
+        for(j=0; j<runLength; ++j) {
+            in16[length16++]=(UChar)(0x61+j%26);
+            in8[length8++]=(char)(0x61+j%26);
+        }
+
+        u_strToUTF8(out8, UPRV_LENGTHOF(out8), &length, in16, length16, &errorCode);
+        if(U_FAILURE(errorCode) || length!=length8 || 0!=memcmp(out8, in8, length8)) {
+            log_err("u_strToUTF8() wrong for ASCII runs of length %d - %s\n",
+                    (int)runLength, u_errorName(errorCode));
+        }
+        errorCode=U_ZERO_ERROR;
+        u_strFromUTF8(out16, UPRV_LENGTHOF(out16), &length, in8, length8, &errorCode);
+        if(U_FAILURE(errorCode) || length!=length16 || 0!=u_memcmp(out16, in16, length16)) {
+            log_err("u_strFromUTF8() wrong for ASCII runs of length %d - %s\n",
+                    (int)runLength, u_errorName(errorCode));
+        }
+
+        /* destination one unit too short */
+        if(length16>0) {
+            errorCode=U_ZERO_ERROR;
+            u_strToUTF8(out8, length8-1, &length, in16, length16, &errorCode);
+            if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length!=length8) {
+                log_err("u_strToUTF8(capacity too small) wrong for ASCII runs of length %d - %s\n",
+                        (int)runLength, u_errorName(errorCode));
+            }
+            errorCode=U_ZERO_ERROR;
+            u_strFromUTF8(out16, length16-1, &length, in8, length8, &errorCode);
+            if(errorCode!=U_BUFFER_OVERFLOW_ERROR || length!=length16) {
+                log_err("u_strFromUTF8(capacity too small) wrong for ASCII runs of length %d - %s\n",
+                        (int)runLength, u_errorName(errorCode));
+            }
+        }
+
+        /* an ill-formed byte in the middle of the last run */
+        if(runLength>0) {
+            int32_t numSubstitutions;
+            in8[length8-runLength/2-1]=(char)0xff;
+            in16[length16-runLength/2-1]=0xfffd;
+            errorCode=U_ZERO_ERROR;
+            u_strFromUTF8WithSub(out16, UPRV_LENGTHOF(out16), &length, in8, length8,
+                                 0xfffd, &numSubstitutions, &errorCode);
+            if(U_FAILURE(errorCode) || length!=length16 || numSubstitutions!=1 ||
+                    0!=u_memcmp(out16, in16, length16)) {
+                log_err("u_strFromUTF8WithSub() wrong for ASCII runs of length %d - %s\n",
+                        (int)runLength, u_errorName(errorCode));
+            }
+        }
+    }
+}
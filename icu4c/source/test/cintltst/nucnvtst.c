@@ -57,6 +57,7 @@ static void TestLATIN1(void);
 static void TestSBCS(void);
 static void TestDBCS(void);
 static void TestMBCS(void);
+static void TestMBCSASCIIRuns(void);
 #if !UCONFIG_NO_LEGACY_CONVERSION && !UCONFIG_NO_FILE_IO
 static void TestICCRunout(void);
 #endif
@@ -283,6 +284,7 @@ void addTestNewConvert(TestNode** root)
    addTest(root, &TestICCRunout, "tsconv/nucnvtst/TestICCRunout");
 #endif
    addTest(root, &TestMBCS, "tsconv/nucnvtst/TestMBCS");
+   addTest(root, &TestMBCSASCIIRuns, "tsconv/nucnvtst/TestMBCSASCIIRuns");
 
 #ifdef U_ENABLE_GENERIC_ISO_2022
    addTest(root, &TestISO_2022, "tsconv/nucnvtst/TestISO_2022");
@@ -2611,6 +2613,121 @@ TestDBCS(void) {
     ucnv_close(cnv);
 }
 
+/*
+ * Runs of ASCII of all lengths around the bulk copy block size,
+ * separated by one non-ASCII character, must convert with the same
+ * results and offsets as one character at a time.
+ */
+static void
+TestMBCSASCIIRuns(void) {
+    static const struct {
+        const char *name;
+        UChar nonASCII;
+    } cases[]={
+        { "windows-1252", 0xe9 },           /* SBCS */
+        { "EUC-KR", 0xac00 },               /* DBCS with single bytes */
+        { "ibm-1383", 0x4e00 },
+        { "EUC-JP", 0x3042 }                /* MBCS with up to 3 bytes */
+    };
+    int32_t c;
+    for(c=0; c<UPRV_LENGTHOF(cases); ++c) {
+        UChar uchars[1000], uchars2[1000];
+        char bytes[2000], bytes2[2000], nonASCIIBytes[4];
+        int32_t fromUOffsets[2000], expectedFromUOffsets[2000];
+        int32_t toUOffsets[1000], expectedToUOffsets[1000];
+        int32_t ucharsLength=0, bytesLength=0, nonASCIILength, run, i;
+        UErrorCode errorCode=U_ZERO_ERROR;
+        UConverter *cnv=ucnv_open(cases[c].name, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("Unable to open converter %s: %s\n", cases[c].name, u_errorName(errorCode));
+            continue;
+        }
+        nonASCIILength=ucnv_fromUChars(cnv, nonASCIIBytes, UPRV_LENGTHOF(nonASCIIBytes),
+                                       &cases[c].nonASCII, 1, &errorCode);
+        if(U_FAILURE(errorCode) || nonASCIILength<1 || (uint8_t)nonASCIIBytes[0]<0x80) {
+            log_err("%s: unexpected mapping for U+%04x\n", cases[c].name, cases[c].nonASCII);
+            ucnv_close(cnv);
+            continue;
+        }
+
+        /* build the text and the expected offsets in both directions */
+        for(run=0; run<=40; ++run) {
+            for(i=0; i<run; ++i) {
+                expectedToUOffsets[ucharsLength]=bytesLength;
+                expectedFromUOffsets[bytesLength]=ucharsLength;
+                bytes[bytesLength++]=(char)(0x20+(run+i)%0x5f);
+                uchars[ucharsLength++]=(UChar)(0x20+(run+i)%0x5f);
+            }
+            expectedToUOffsets[ucharsLength]=bytesLength;
+            for(i=0; i<nonASCIILength; ++i) {
+                expectedFromUOffsets[bytesLength]=ucharsLength;
+                bytes[bytesLength++]=nonASCIIBytes[i];
+            }
+            uchars[ucharsLength++]=cases[c].nonASCII;
+        }
+
+        {
+            const UChar *src=uchars;
+            char *dest=bytes2;
+            ucnv_resetFromUnicode(cnv);
+            ucnv_fromUnicode(cnv, &dest, bytes2+UPRV_LENGTHOF(bytes2), &src, uchars+ucharsLength,
+                             fromUOffsets, true, &errorCode);
+            if( U_FAILURE(errorCode) || (dest-bytes2)!=bytesLength ||
+                0!=uprv_memcmp(bytes, bytes2, bytesLength) ||
+                0!=uprv_memcmp(expectedFromUOffsets, fromUOffsets, bytesLength*4)
+            ) {
+                log_err("%s: ASCII runs fromUnicode with offsets failed - %s\n",
+                        cases[c].name, u_errorName(errorCode));
+            }
+        }
+        {
+            const char *src=bytes;
+            UChar *dest=uchars2;
+            ucnv_resetToUnicode(cnv);
+            ucnv_toUnicode(cnv, &dest, uchars2+UPRV_LENGTHOF(uchars2), &src, bytes+bytesLength,
+                           toUOffsets, true, &errorCode);
+            if( U_FAILURE(errorCode) || (dest-uchars2)!=ucharsLength ||
+                0!=u_memcmp(uchars, uchars2, ucharsLength) ||
+                0!=uprv_memcmp(expectedToUOffsets, toUOffsets, ucharsLength*4)
+            ) {
+                log_err("%s: ASCII runs toUnicode with offsets failed - %s\n",
+                        cases[c].name, u_errorName(errorCode));
+            }
+        }
+
+        /* small output buffers so that a bulk copy must stop at the target limit */
+        {
+            const UChar *src=uchars;
+            char *dest=bytes2;
+            ucnv_resetFromUnicode(cnv);
+            do {
+                char *limit=dest+19<bytes2+UPRV_LENGTHOF(bytes2) ? dest+19 : bytes2+UPRV_LENGTHOF(bytes2);
+                errorCode=U_ZERO_ERROR;
+                ucnv_fromUnicode(cnv, &dest, limit, &src, uchars+ucharsLength, NULL, true, &errorCode);
+            } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+            if(U_FAILURE(errorCode) || (dest-bytes2)!=bytesLength || 0!=uprv_memcmp(bytes, bytes2, bytesLength)) {
+                log_err("%s: ASCII runs fromUnicode in pieces failed - %s\n",
+                        cases[c].name, u_errorName(errorCode));
+            }
+        }
+        {
+            const char *src=bytes;
+            UChar *dest=uchars2;
+            ucnv_resetToUnicode(cnv);
+            do {
+                UChar *limit=dest+19<uchars2+UPRV_LENGTHOF(uchars2) ? dest+19 : uchars2+UPRV_LENGTHOF(uchars2);
+                errorCode=U_ZERO_ERROR;
+                ucnv_toUnicode(cnv, &dest, limit, &src, bytes+bytesLength, NULL, true, &errorCode);
+            } while(errorCode==U_BUFFER_OVERFLOW_ERROR);
+            if(U_FAILURE(errorCode) || (dest-uchars2)!=ucharsLength || 0!=u_memcmp(uchars, uchars2, ucharsLength)) {
+                log_err("%s: ASCII runs toUnicode in pieces failed - %s\n",
+                        cases[c].name, u_errorName(errorCode));
+            }
+        }
+        ucnv_close(cnv);
+    }
+}
+
 static void
 TestMBCS(void) {
     /* test input */
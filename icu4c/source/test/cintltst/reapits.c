@@ -401,6 +401,22 @@ static void TestRegexCAPI(void) {
         uregex_close(re);
     }
 
+    /*
+     *  getEngine()
+     */
+    {
+        status = U_ZERO_ERROR;
+        re = uregex_openC("(a|b)*c", 0, NULL, &status);
+        TEST_ASSERT(uregex_getEngine(re, &status) == UREGEX_ENGINE_AUTOMATON);
+        TEST_ASSERT_SUCCESS(status);
+        uregex_close(re);
+
+        re = uregex_openC("(a|b)\\1", 0, NULL, &status);
+        TEST_ASSERT(uregex_getEngine(re, &status) == UREGEX_ENGINE_BACKTRACKING);
+        TEST_ASSERT_SUCCESS(status);
+        uregex_close(re);
+    }
+
     /*
      *  setText() and lookingAt()
      */
@@ -142,6 +142,8 @@ void DateFormatTest::runIndexedTest( int32_t index, UBool exec, const char* &nam
     TESTCASE_AUTO(TestLongLocale);
     TESTCASE_AUTO(TestChineseCalendar23043);
     TESTCASE_AUTO(TestAmPmLengths23114);
+    TESTCASE_AUTO(TestGregorianFastFormat);
+    TESTCASE_AUTO(TestGregorianFastParse);
 
     TESTCASE_AUTO_END;
 }
@@ -6037,6 +6039,156 @@ void DateFormatTest::TestAmPmLengths23114() {
     assertEquals("DateFormatSymbols narrow after set", u"am!", borrowedAmPm[0]);
 }
 
+void DateFormatTest::TestGregorianFastFormat() {
+    // Patterns with only numeric, month, weekday, and AM/PM fields are formatted
+    // without computing all of the calendar fields. Appending an era field
+    // forces the regular path, which must produce the same output.
+    static const char* const locales[] = {
+        "en_US", "de", "ar_EG", "hi@numbers=deva", "ja", "th@numbers=thai"
+    };
+    static const char16_t* const patterns[] = {
+        u"yyyy-MM-dd'T'HH:mm:ss.SSS",
+        u"y MMM d, EEE h:mm:ss a",
+        u"yy/M/d k:m:s S SS SSSS K",
+        u"LLLL LLL LLLLL MMMMM EEEE EEEEE EEEEEE aaaa aaaaa",
+        u"yyyyyyyyyyyy ddddd",
+        u"''y'' 'quoted d' y",
+    };
+    static const char* const zones[] = { "America/New_York", "Asia/Kolkata", "Australia/Lord_Howe" };
+    for (const char* localeID : locales) {
+        for (const char16_t* pattern : patterns) {
+            for (const char* zoneID : zones) {
+                IcuTestErrorCode status(*this, "TestGregorianFastFormat");
+                UnicodeString regularPattern(pattern);
+                regularPattern.append(u"'|'G");
+                SimpleDateFormat fast(pattern, Locale(localeID), status);
+                SimpleDateFormat regular(regularPattern, Locale(localeID), status);
+                if (status.errDataIfFailureAndReset("SimpleDateFormat(%s)", localeID)) {
+                    return;
+                }
+                fast.adoptTimeZone(TimeZone::createTimeZone(zoneID));
+                regular.adoptTimeZone(TimeZone::createTimeZone(zoneID));
+                // From 1500 (Julian calendar, formatted on the regular path) to 2100.
+                for (UDate date = -14831769600000.0; date < 4102444800000.0; date += 15485863123.0) {
+                    UnicodeString expected, actual;
+                    regular.format(date, expected);
+                    expected.truncate(expected.lastIndexOf(u'|'));
+                    fast.format(date, actual);
+                    if (actual != expected) {
+                        errln(UnicodeString(u"Fast format of ") + pattern + u" in " + localeID + u" " + zoneID +
+                              u": " + actual + u" != " + expected);
+                        break;
+                    }
+                    // The field positions match as well.
+                    FieldPositionIterator fastIter, regularIter;
+                    FieldPosition fastPos, regularPos;
+                    actual.remove();
+                    expected.remove();
+                    fast.format(date, actual, &fastIter, status);
+                    regular.format(date, expected, &regularIter, status);
+                    while (fastIter.next(fastPos)) {
+                        if (!regularIter.next(regularPos) || fastPos != regularPos) {
+                            errln(UnicodeString(u"Fast format field positions for ") + pattern +
+                                  u" in " + localeID);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // A localized pattern may add fields that the fast path does not handle.
+    IcuTestErrorCode status(*this, "TestGregorianFastFormat localized pattern");
+    SimpleDateFormat sdf(u"HH:mm", Locale::getEnglish(), status);
+    SimpleDateFormat zoned(u"HH:mm z", Locale::getEnglish(), status);
+    sdf.adoptTimeZone(TimeZone::createTimeZone("America/New_York"));
+    zoned.adoptTimeZone(TimeZone::createTimeZone("America/New_York"));
+    sdf.applyLocalizedPattern(u"HH:mm z", status);
+    UnicodeString expected, actual;
+    assertEquals("applyLocalizedPattern() with a zone field",
+                 zoned.format(1700000000000.0, expected), sdf.format(1700000000000.0, actual));
+}
+
+void DateFormatTest::TestGregorianFastParse() {
+    // DateFormat::parse(text, pos) parses patterns with only numeric, month,
+    // weekday, and AM/PM fields without a Calendar. It must give the same results
+    // as parsing into a Calendar, which always uses the regular path.
+    static const char* const locales[] = { "en_US", "de", "ar_EG", "hi@numbers=deva", "cs" };
+    static const char16_t* const patterns[] = {
+        u"yyyy-MM-dd'T'HH:mm:ss.SSS",
+        u"yyyyMMddHHmmss",
+        u"EEE, d MMM yyyy h:mm:ss a",
+        u"MMMM d, yy K:mm aaaa",
+        u"dd.MM.y k:m:s",
+        u"LLL d yyyy S",
+    };
+    static const char* const zones[] = { "America/New_York", "Australia/Lord_Howe" };
+    // Variations of the formatted text, including ones that the fast path leaves
+    // to the regular path.
+    static const char16_t* const insertions[] = { u"", u" ", u"  ", u".", u"-", u"1", u"\u0661" };
+    for (const char* localeID : locales) {
+        for (const char16_t* pattern : patterns) {
+            for (const char* zoneID : zones) {
+                for (UBool lenient : { true, false }) {
+                    IcuTestErrorCode status(*this, "TestGregorianFastParse");
+                    SimpleDateFormat sdf(pattern, Locale(localeID), status);
+                    if (status.errDataIfFailureAndReset("SimpleDateFormat(%s)", localeID)) {
+                        return;
+                    }
+                    sdf.adoptTimeZone(TimeZone::createTimeZone(zoneID));
+                    sdf.setLenient(lenient);
+                    int32_t insertion = 0;
+                    // From 1500 (Julian calendar, parsed on the regular path) to 2100.
+                    for (UDate date = -14831769600000.0; date < 4102444800000.0; date += 47485863127.0) {
+                        UnicodeString text;
+                        sdf.format(date, text);
+                        const char16_t* insert = insertions[insertion++ % UPRV_LENGTHOF(insertions)];
+                        text.insert(static_cast<int32_t>(date / 1000) % (text.length() + 1),
+                                    UnicodeString(insert).unescape());
+                        if (insertion % 5 == 0) {
+                            text.toUpper();
+                        }
+
+                        ParsePosition fastPos(0);
+                        UDate actual = sdf.parse(text, fastPos);
+
+                        LocalPointer<Calendar> cal(sdf.getCalendar()->clone());
+                        cal->clear();
+                        ParsePosition regularPos(0);
+                        sdf.parse(text, *cal, regularPos);
+                        UDate expected = 0;
+                        if (regularPos.getIndex() != 0) {
+                            UErrorCode calStatus = U_ZERO_ERROR;
+                            expected = cal->getTime(calStatus);
+                            if (U_FAILURE(calStatus)) {
+                                regularPos.setIndex(0);
+                                expected = 0;
+                            }
+                        }
+                        if (actual != expected || fastPos.getIndex() != regularPos.getIndex()) {
+                            errln(UnicodeString(u"Fast parse of \"") + text + u"\" with " + pattern +
+                                  u" in " + localeID + u" " + zoneID + u": " + actual + u"@" +
+                                  fastPos.getIndex() + u" != " + expected + u"@" + regularPos.getIndex());
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Skipped and repeated wall times.
+    IcuTestErrorCode status(*this, "TestGregorianFastParse wall time");
+    SimpleDateFormat sdf(u"yyyy-MM-dd HH:mm", Locale::getEnglish(), status);
+    sdf.adoptTimeZone(TimeZone::createTimeZone("America/New_York"));
+    assertEquals("skipped wall time", 1710055800000.0, sdf.parse(u"2024-03-10 02:30", status));
+    assertEquals("repeated wall time", 1730613600000.0, sdf.parse(u"2024-11-03 01:00", status));
+    sdf.setLenient(false);
+    sdf.parse(u"2024-03-10 02:30", status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR, "strict skipped wall time");
+}
+
 #endif /* #if !UCONFIG_NO_FORMATTING */
 
 //eof
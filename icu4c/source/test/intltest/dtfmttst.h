@@ -274,6 +274,8 @@ class DateFormatTest: public CalendarTimeZoneTest {
     void TestLongLocale();
     void TestChineseCalendar23043();
     void TestAmPmLengths23114();
+    void TestGregorianFastFormat();
+    void TestGregorianFastParse();
 
 private:
     UBool showParse(DateFormat &format, const UnicodeString &formattedString);
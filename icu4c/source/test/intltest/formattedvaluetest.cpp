@@ -8,8 +8,12 @@
 #include <set>
 
 #include "unicode/formattedvalue.h"
+#include "unicode/listformatter.h"
+#include "unicode/numberformatter.h"
+#include "unicode/numberrangeformatter.h"
 #include "unicode/unum.h"
 #include "unicode/udat.h"
+#include "cmemory.h"
 #include "intltest.h"
 #include "itformat.h"
 
@@ -22,6 +26,7 @@ class FormattedValueTest : public IntlTest {
     void testBasic();
     void testSetters();
     void testLocalPointer();
+    void testArena();
 
     void assertAllPartsEqual(
         UnicodeString messagePrefix,
@@ -42,6 +47,7 @@ void FormattedValueTest::runIndexedTest(int32_t index, UBool exec, const char *&
     TESTCASE_AUTO(testBasic);
     TESTCASE_AUTO(testSetters);
     TESTCASE_AUTO(testLocalPointer);
+    TESTCASE_AUTO(testArena);
     TESTCASE_AUTO_END;
 }
 
@@ -130,6 +136,102 @@ void FormattedValueTest::testLocalPointer() {
     assertSuccess("Using LocalUConstrainedFieldPositionPointer", status);
 }
 
+void FormattedValueTest::testArena() {
+    IcuTestErrorCode status(*this, "testArena");
+
+    // Raw allocations are aligned and do not overlap, including ones that
+    // do not fit into the buffer or into a default-sized block.
+    {
+        alignas(16) char buffer[100];
+        FormattingArena arena(buffer, sizeof(buffer));
+        const int32_t sizes[] = {1, 7, 40, 3, 5000, 16, 100000, 0};
+        char* pointers[UPRV_LENGTHOF(sizes)];
+        for (int32_t round = 0; round < 3; round++) {
+            for (int32_t i = 0; i < UPRV_LENGTHOF(sizes); i++) {
+                pointers[i] = static_cast<char*>(arena.allocate(sizes[i]));
+                assertTrue(u"allocated", pointers[i] != nullptr);
+                assertEquals(u"aligned", 0,
+                    static_cast<int32_t>(reinterpret_cast<uintptr_t>(pointers[i]) % alignof(double)));
+                uprv_memset(pointers[i], round, sizes[i]);
+            }
+            for (int32_t i = 0; i < UPRV_LENGTHOF(sizes); i++) {
+                for (int32_t j = 0; j < i; j++) {
+                    assertTrue(u"no overlap",
+                        pointers[i] >= pointers[j] + sizes[j] || pointers[j] >= pointers[i] + sizes[i]);
+                }
+            }
+            arena.reset();
+        }
+    }
+
+    Locale locale("de-CH");
+    number::LocalizedNumberFormatter nf = number::NumberFormatter::withLocale(locale)
+        .unit(CurrencyUnit(u"CHF", status));
+    number::LocalizedNumberRangeFormatter nrf = number::NumberRangeFormatter::withLocale(locale);
+    LocalPointer<ListFormatter> lf(ListFormatter::createInstance(locale, status));
+    if (status.errIfFailureAndReset("Creating formatters")) {
+        return;
+    }
+    UnicodeString longItem(u"Ein sehr langes Listenelement, das den Puffer des Ergebnisses vergr\u00F6\u00DFert");
+    longItem = longItem.unescape();
+    UnicodeString items[] = {u"Apfel", longItem, u"Birne", longItem};
+    const char* decimal = "-123456789012345678901234567890123456789.25";
+
+    // A small buffer so that the arena needs heap blocks as well.
+    alignas(16) char buffer[256];
+    FormattingArena arena(buffer, sizeof(buffer));
+    for (int32_t round = 0; round < 3; round++) {
+        {
+            // Several results live at the same time.
+            number::FormattedNumber n1 = nf.formatInt(1234567, arena, status);
+            number::FormattedNumber n2 = nf.formatDouble(-0.5, arena, status);
+            number::FormattedNumber n3 = nf.formatDecimal(decimal, arena, status);
+            number::FormattedNumberRange r = nrf.formatFormattableRange(3, 5.5, arena, status);
+            FormattedList l = lf->formatStringsToValue(items, UPRV_LENGTHOF(items), arena, status);
+            status.errIfFailureAndReset("Formatting with an arena");
+
+            assertEquals(u"formatInt", nf.formatInt(1234567, status).toString(status),
+                n1.toString(status));
+            assertEquals(u"formatDouble", nf.formatDouble(-0.5, status).toString(status),
+                n2.toTempString(status));
+            assertEquals(u"formatDecimal", nf.formatDecimal(decimal, status).toString(status),
+                n3.toString(status));
+            assertEquals(u"formatFormattableRange",
+                nrf.formatFormattableRange(3, 5.5, status).toString(status),
+                r.toString(status));
+            FormattedList heapList = lf->formatStringsToValue(items, UPRV_LENGTHOF(items), status);
+            assertEquals(u"formatStringsToValue", heapList.toString(status), l.toString(status));
+
+            // Field positions are the same as for results on the heap.
+            ConstrainedFieldPosition cfpos, heapCfpos;
+            cfpos.constrainCategory(UFIELD_CATEGORY_LIST_SPAN);
+            heapCfpos.constrainCategory(UFIELD_CATEGORY_LIST_SPAN);
+            while (heapList.nextPosition(heapCfpos, status)) {
+                assertTrue(u"nextPosition", l.nextPosition(cfpos, status));
+                assertEquals(u"span start", heapCfpos.getStart(), cfpos.getStart());
+                assertEquals(u"span limit", heapCfpos.getLimit(), cfpos.getLimit());
+            }
+            assertFalse(u"no more positions", l.nextPosition(cfpos, status));
+
+            // Move assignment destroys the arena result that is replaced.
+            n1 = nf.formatInt(42, status);
+            n2 = std::move(n3);
+            assertEquals(u"moved", nf.formatDecimal(decimal, status).toString(status),
+                n2.toString(status));
+            status.errIfFailureAndReset("Comparing with heap results");
+        }
+        arena.reset();
+    }
+
+    // An error in the input is reported, and the arena can still be used.
+    {
+        number::FormattedNumber n = nf.formatDecimal("not a number", arena, status);
+        status.expectErrorAndReset(U_DECIMAL_NUMBER_SYNTAX_ERROR);
+        number::FormattedNumber n2 = nf.formatInt(5, arena, status);
+        assertEquals(u"after error", nf.formatInt(5, status).toString(status), n2.toString(status));
+    }
+}
+
 /** For matching, turn on these bits:
  *
  * 1 = UNUM_INTEGER_FIELD
@@ -28,6 +28,9 @@ void LSTMBETest::runIndexedTest( int32_t index, UBool exec, const char* &name, c
     TESTCASE_AUTO(TestThaiGraphclust);
     TESTCASE_AUTO(TestThaiCodepoints);
     TESTCASE_AUTO(TestBurmeseGraphclust);
+    TESTCASE_AUTO(TestThaiGraphclustLongText);
+    TESTCASE_AUTO(TestThaiCodepointsLongText);
+    TESTCASE_AUTO(TestBurmeseGraphclustLongText);
     TESTCASE_AUTO(TestThaiGraphclustWithLargeMemory);
     TESTCASE_AUTO(TestThaiCodepointsWithLargeMemory);
 
@@ -211,6 +214,21 @@ void LSTMBETest::TestBurmeseGraphclust() {
     runTestFromFile("Burmese_graphclust_model5_heavy_Test.txt", "my");
 }
 
+// The LongTest files hold break positions from before the matrix kernels were
+// rewritten, for inputs long enough that any numerical difference in the
+// recurrence would accumulate and move a break.
+void LSTMBETest::TestThaiGraphclustLongText() {
+    runTestFromFile("Thai_graphclust_model4_heavy_LongTest.txt", "th");
+}
+
+void LSTMBETest::TestThaiCodepointsLongText() {
+    runTestFromFile("Thai_codepoints_exclusive_model5_heavy_LongTest.txt", "th");
+}
+
+void LSTMBETest::TestBurmeseGraphclustLongText() {
+    runTestFromFile("Burmese_graphclust_model5_heavy_LongTest.txt", "my");
+}
+
 const LanguageBreakEngine* LSTMBETest::createEngineFromTestData(
         const char* model, UScriptCode script, UErrorCode& status) {
     const char* testdatapath=loadTestData(status);
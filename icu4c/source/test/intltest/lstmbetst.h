@@ -35,6 +35,9 @@ class LSTMBETest: public IntlTest {
     void TestThaiGraphclust();
     void TestThaiCodepoints();
     void TestBurmeseGraphclust();
+    void TestThaiGraphclustLongText();
+    void TestThaiCodepointsLongText();
+    void TestBurmeseGraphclustLongText();
     void TestThaiGraphclustWithLargeMemory();
     void TestThaiCodepointsWithLargeMemory();
 
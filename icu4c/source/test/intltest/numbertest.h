@@ -106,6 +106,8 @@ class NumberFormatterApiTest : public IntlTestWithFieldPosition {
     void formatArbitraryConstant();
     void TestPortionFormat();
     void testIssue22378();
+    void formatBatch();
+    void compileAndShare();
 
     void runIndexedTest(int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
 
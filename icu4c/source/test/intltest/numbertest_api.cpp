@@ -9,6 +9,7 @@
 #include <cstdarg>
 #include <memory>
 
+#include "unicode/decimfmt.h"
 #include "unicode/displayoptions.h"
 #include "unicode/numberformatter.h"
 #include "unicode/testlog.h"
@@ -136,6 +137,8 @@ void NumberFormatterApiTest::runIndexedTest(int32_t index, UBool exec, const cha
         TESTCASE_AUTO(formatArbitraryConstant);
         TESTCASE_AUTO(TestPortionFormat);
         TESTCASE_AUTO(testIssue22378);
+        TESTCASE_AUTO(formatBatch);
+        TESTCASE_AUTO(compileAndShare);
     TESTCASE_AUTO_END;
 }
 
@@ -6300,6 +6303,160 @@ void NumberFormatterApiTest::testIssue22378() {
     assertEquals("Testing default -u-mu- for fr-FR", MeasureUnit::getCelsius().getIdentifier(), result);
 }
 
+void NumberFormatterApiTest::formatBatch() {
+    IcuTestErrorCode status(*this, "formatBatch");
+
+    const double doubles[] = {1234.5, -0.25, 0.0, 1e20, 3.0e-7, -98765.4321};
+    const int64_t ints[] = {0, 1, -1, 1234567, INT64_MAX, INT64_MIN};
+    LocalizedNumberFormatter formatters[] = {
+        NumberFormatter::withLocale("en"),
+        NumberFormatter::withLocale("de-CH")
+            .unit(CurrencyUnit(u"CHF", status))
+            .precision(Precision::currency(UCURR_USAGE_STANDARD)),
+        NumberFormatter::withLocale("en-US").usage("road").unit(MeasureUnit::getMeter()),
+        NumberFormatter::withLocale("ar-EG").notation(Notation::compactShort()),
+    };
+
+    for (const auto& formatter : formatters) {
+        // Repeat so that the batch runs both before and after the formatter compiles itself.
+        for (int32_t round = 0; round < 4; round++) {
+            for (bool useInts : {true, false}) {
+                int32_t count = useInts ? UPRV_LENGTHOF(ints) : UPRV_LENGTHOF(doubles);
+                UnicodeString actual(u"prefix:");
+                int32_t offsets[UPRV_LENGTHOF(doubles) + 1];
+                FieldPositionIterator fpi;
+                if (useInts) {
+                    formatter.formatInts(ints, count, actual, offsets, &fpi, status);
+                } else {
+                    formatter.formatDoubles(doubles, count, actual, offsets, &fpi, status);
+                }
+                if (status.errIfFailureAndReset("Batch formatting")) {
+                    return;
+                }
+
+                UnicodeString expected(u"prefix:");
+                FieldPosition actualPosition;
+                assertEquals(u"first offset", 7, offsets[0]);
+                for (int32_t i = 0; i < count; i++) {
+                    FormattedNumber result = useInts
+                        ? formatter.formatInt(ints[i], status)
+                        : formatter.formatDouble(doubles[i], status);
+                    int32_t start = expected.length();
+                    expected.append(result.toTempString(status));
+                    assertEquals(u"offset", expected.length(), offsets[i + 1]);
+                    FieldPositionIterator expectedFpi;
+                    {
+                        FieldPositionIteratorHandler fpih(&expectedFpi, status);
+                        result.getAllFieldPositionsImpl(fpih, status);
+                    }
+                    FieldPosition expectedPosition;
+                    while (expectedFpi.next(expectedPosition)) {
+                        assertTrue(u"has field position", fpi.next(actualPosition));
+                        assertEquals(u"field", expectedPosition.getField(), actualPosition.getField());
+                        assertEquals(u"field start", start + expectedPosition.getBeginIndex(),
+                            actualPosition.getBeginIndex());
+                        assertEquals(u"field limit", start + expectedPosition.getEndIndex(),
+                            actualPosition.getEndIndex());
+                    }
+                }
+                assertFalse(u"no more field positions", fpi.next(actualPosition));
+                assertEquals(u"batch result", expected, actual);
+            }
+        }
+    }
+
+    // Offsets and field positions are optional.
+    UnicodeString actual;
+    formatters[0].formatDoubles(doubles, 2, actual, nullptr, nullptr, status);
+    assertEquals(u"no offsets", u"1,234.5-0.25", actual);
+    formatters[0].formatInts(nullptr, 0, actual, nullptr, nullptr, status);
+    assertEquals(u"empty batch", u"1,234.5-0.25", actual);
+
+    formatters[0].formatInts(ints, -1, actual, nullptr, nullptr, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+    formatters[0].formatDoubles(nullptr, 1, actual, nullptr, nullptr, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR);
+}
+
+void NumberFormatterApiTest::compileAndShare() {
+    IcuTestErrorCode status(*this, "compileAndShare");
+
+    LocalizedNumberFormatter plain = NumberFormatter::withLocale("en").precision(Precision::fixedFraction(2));
+    LocalizedNumberFormatter l1 = plain.compile(status);
+    if (status.errDataIfFailureAndReset()) { return; }
+    assertTrue("Compiled without formatting", l1.getCompiled() != nullptr);
+    assertEquals("Compiled", INT32_MIN, l1.getCallCount());
+    assertTrue("Source is not compiled", plain.getCompiled() == nullptr);
+    assertEquals("Compiled behavior", u"1,234.50", l1.formatDouble(1234.5, status).toString(status));
+
+    // Copies share the compiled formatter.
+    LocalizedNumberFormatter l2(l1);
+    assertTrue("[constructor] Copy shares compiled state", l2.getCompiled() == l1.getCompiled());
+    assertEquals("[constructor] Copy shares compiled state", INT32_MIN, l2.getCallCount());
+    LocalizedNumberFormatter l3;
+    l3 = l2;
+    assertTrue("[assignment] Copy shares compiled state", l3.getCompiled() == l1.getCompiled());
+    LocalizedNumberFormatter l4 = l3.compile(status);
+    assertTrue("Compiling again shares compiled state", l4.getCompiled() == l1.getCompiled());
+    LocalizedNumberFormatter l5 = std::move(l4);
+    assertTrue("Move keeps compiled state", l5.getCompiled() == l1.getCompiled());
+    l5 = l2;
+    assertTrue("Copies of copies share compiled state", l5.getCompiled() == l1.getCompiled());
+
+    // The compiled formatter outlives the formatter that built it.
+    l1 = LocalizedNumberFormatter();
+    l2 = LocalizedNumberFormatter();
+    assertEquals("Shared behavior", u"-0.50", l3.formatDouble(-0.5, status).toString(status));
+    assertEquals("Shared behavior", u"7.00", l5.formatInt(7, status).toString(status));
+
+    // Changing a setting drops the compiled formatter, for both lvalues and rvalues.
+    LocalizedNumberFormatter l6 = l3.precision(Precision::integer());
+    assertTrue("[setter] Not compiled", l6.getCompiled() == nullptr);
+    assertEquals("[setter] New behavior", u"2", l6.formatDouble(1.5, status).toString(status));
+    LocalizedNumberFormatter l7 = LocalizedNumberFormatter(l3).unit(NoUnit::percent());
+    assertTrue("[rvalue setter] Not compiled", l7.getCompiled() == nullptr);
+    assertEquals("[rvalue setter] New behavior", u"1.50%", l7.formatDouble(1.5, status).toString(status));
+    LocalizedNumberFormatter l8 = std::move(l3).compile(status).unit(NoUnit::percent());
+    assertEquals("[rvalue setter] New behavior", u"1.50%", l8.formatDouble(1.5, status).toString(status));
+
+    // compiledForSkeleton() shares the compiled formatter for the same skeleton and locale.
+    LocalizedNumberFormatter s1 = NumberFormatter::compiledForSkeleton(u"percent .00", "de", status);
+    LocalizedNumberFormatter s2 = NumberFormatter::compiledForSkeleton(u"percent .00", "de", status);
+    LocalizedNumberFormatter s3 = NumberFormatter::compiledForSkeleton(u"percent .00", "fr", status);
+    LocalizedNumberFormatter s4 = NumberFormatter::compiledForSkeleton(u"percent .0", "de", status);
+    if (status.errDataIfFailureAndReset()) { return; }
+    assertTrue("Skeleton compiled", s1.getCompiled() != nullptr);
+    assertTrue("Same skeleton and locale", s1.getCompiled() == s2.getCompiled());
+    assertTrue("Different locale", s1.getCompiled() != s3.getCompiled());
+    assertTrue("Different skeleton", s1.getCompiled() != s4.getCompiled());
+    assertTrue("Copy of skeleton formatter", LocalizedNumberFormatter(s2).getCompiled() == s1.getCompiled());
+    struct {
+        const LocalizedNumberFormatter& compiled;
+        const char16_t* skeleton;
+        const char* locale;
+    } cases[] = {{s1, u"percent .00", "de"}, {s3, u"percent .00", "fr"}, {s4, u"percent .0", "de"}};
+    for (const auto& cas : cases) {
+        LocalizedNumberFormatter expected = NumberFormatter::forSkeleton(cas.skeleton, status)
+            .locale(cas.locale);
+        assertEquals("Skeleton behavior", expected.formatDouble(-12.345, status).toString(status),
+            cas.compiled.formatDouble(-12.345, status).toString(status));
+    }
+    assertEquals("Skeleton behavior", u"12,50 %", s2.formatDouble(12.5, status).toString(status));
+    NumberFormatter::compiledForSkeleton(u"percent .00 bogus", "de", status);
+    status.expectErrorAndReset(U_NUMBER_SKELETON_SYNTAX_ERROR);
+
+    // A formatter from DecimalFormat owns the affix patterns that its compiled formatter uses,
+    // so its copies compile their own.
+    DecimalFormat df(u"0.0# 'units'", DecimalFormatSymbols("en", status), status);
+    LocalizedNumberFormatter d1 = df.toNumberFormatter(status)->compile(status);
+    if (status.errDataIfFailureAndReset()) { return; }
+    assertTrue("DecimalFormat compiled", d1.getCompiled() != nullptr);
+    LocalizedNumberFormatter d2(d1);
+    assertTrue("DecimalFormat copy not shared", d2.getCompiled() == nullptr);
+    d1 = LocalizedNumberFormatter();
+    assertEquals("DecimalFormat copy behavior", u"1.25 units", d2.formatDouble(1.25, status).toString(status));
+}
+
 /* For skeleton comparisons: this checks the toSkeleton output for `f` and for
  * `conciseSkeleton` against the normalized version of `uskeleton` - this does
  * not round-trip uskeleton itself.
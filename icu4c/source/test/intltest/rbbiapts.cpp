@@ -28,6 +28,7 @@
 #if !UCONFIG_NO_BREAK_ITERATION
 #include "unicode/filteredbrk.h"
 #include <stdio.h> // for snprintf
+#include <vector>
 #endif
 /**
  * API Test the RuleBasedBreakIterator class
@@ -1147,6 +1148,140 @@ void RBBIAPITest::TestGetBinaryRules() {
 }
 
 
+void RBBIAPITest::TestNextBoundaries() {
+    // nextBoundaries() must return the same boundaries and statuses as repeated next() calls,
+    // including in dictionary (Thai) ranges, for any array capacity.
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<RuleBasedBreakIterator> bi(dynamic_cast<RuleBasedBreakIterator *>(
+        BreakIterator::createWordInstance(Locale::getEnglish(), status)));
+    if (U_FAILURE(status) || bi.isNull()) {
+        dataerrln("Failure at file %s, line %d, error = %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    UnicodeString text;
+    for (int32_t i = 0; i < 40; ++i) {
+        text.append(u"The quick (\"brown\") fox can't jump 32.3 feet, right? ");
+        text.append(u"\u0E20\u0E32\u0E29\u0E32\u0E44\u0E17\u0E22\u0E07\u0E48\u0E32\u0E22\u0E19\u0E34\u0E14\u0E40\u0E14\u0E35\u0E22\u0E27 ");
+    }
+    bi->setText(text);
+    std::vector<int32_t> expectedBoundaries, expectedStatuses;
+    for (int32_t pos = bi->next(); pos != UBRK_DONE; pos = bi->next()) {
+        expectedBoundaries.push_back(pos);
+        expectedStatuses.push_back(bi->getRuleStatus());
+    }
+    int32_t expectedCount = static_cast<int32_t>(expectedBoundaries.size());
+
+    static const int32_t capacities[] = { 1, 2, 3, 7, 64, 100, 1000, 10000 };
+    for (int32_t capacity : capacities) {
+        std::vector<int32_t> boundaries(capacity), statuses(capacity);
+        bi->setText(text);
+        int32_t total = 0;
+        for (;;) {
+            int32_t count = bi->nextBoundaries(boundaries.data(), statuses.data(), capacity, status);
+            TEST_ASSERT_SUCCESS(status);
+            TEST_ASSERT(0 <= count && count <= capacity && total + count <= expectedCount);
+            if (U_FAILURE(status) || count < 0 || total + count > expectedCount) {
+                return;
+            }
+            for (int32_t i = 0; i < count; ++i) {
+                if (boundaries[i] != expectedBoundaries[total + i] ||
+                        statuses[i] != expectedStatuses[total + i]) {
+                    errln("capacity %d: boundary #%d is %d status %d, expected %d status %d",
+                          static_cast<int>(capacity), static_cast<int>(total + i),
+                          static_cast<int>(boundaries[i]), static_cast<int>(statuses[i]),
+                          static_cast<int>(expectedBoundaries[total + i]),
+                          static_cast<int>(expectedStatuses[total + i]));
+                    return;
+                }
+            }
+            total += count;
+            if (count > 0) {
+                TEST_ASSERT(bi->current() == boundaries[count - 1]);
+                TEST_ASSERT(bi->getRuleStatus() == statuses[count - 1]);
+            }
+            if (count < capacity) {
+                break;
+            }
+        }
+        TEST_ASSERT(total == expectedCount);
+        TEST_ASSERT(bi->next() == UBRK_DONE);
+    }
+
+    // Mixed with next() and previous(), without statuses.
+    bi->setText(text);
+    int32_t boundaries[5];
+    bi->next();
+    bi->next();
+    TEST_ASSERT(bi->nextBoundaries(boundaries, nullptr, 5, status) == 5);
+    TEST_ASSERT(boundaries[0] == expectedBoundaries[2] && boundaries[4] == expectedBoundaries[6]);
+    TEST_ASSERT(bi->previous() == expectedBoundaries[5]);
+    TEST_ASSERT(bi->nextBoundaries(boundaries, nullptr, 2, status) == 2);
+    TEST_ASSERT(boundaries[0] == expectedBoundaries[6] && boundaries[1] == expectedBoundaries[7]);
+    TEST_ASSERT(bi->next() == expectedBoundaries[8]);
+    TEST_ASSERT(bi->nextBoundaries(boundaries, nullptr, 0, status) == 0);
+    TEST_ASSERT(bi->current() == expectedBoundaries[8]);
+    TEST_ASSERT_SUCCESS(status);
+
+    bi->nextBoundaries(nullptr, nullptr, 1, status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+}
+
+
+void RBBIAPITest::TestCacheCapacity() {
+    // Changing the cache capacity must not change the iteration position or the boundaries,
+    // whether cached boundaries are retained or dropped.
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<RuleBasedBreakIterator> bi(dynamic_cast<RuleBasedBreakIterator *>(
+        BreakIterator::createLineInstance(Locale::getEnglish(), status)));
+    if (U_FAILURE(status) || bi.isNull()) {
+        dataerrln("Failure at file %s, line %d, error = %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    UnicodeString text;
+    for (int32_t i = 0; i < 300; ++i) {
+        text.append(u"Lorem ipsum dolor sit amet, consectetur adipiscing elit. ");
+    }
+    bi->setText(text);
+    std::vector<int32_t> expected;
+    for (int32_t pos = bi->first(); pos != UBRK_DONE; pos = bi->next()) {
+        expected.push_back(pos);
+    }
+    int32_t count = static_cast<int32_t>(expected.size());
+
+    static const int32_t capacities[] = { 1000, 50, 5000, 128, 100000, 300 };
+    int32_t i = 0;
+    bi->first();
+    for (int32_t capacity : capacities) {
+        // Move forward, change the capacity, then move back and forth over many boundaries.
+        for (int32_t j = 0; j < 400 && i + 1 < count; ++j) {
+            TEST_ASSERT(bi->next() == expected[++i]);
+        }
+        bi->setCacheCapacity(capacity, status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(bi->current() == expected[i]);
+        for (int32_t j = 0; j < 300 && i > 0; ++j) {
+            if (bi->previous() != expected[--i]) {
+                errln("capacity %d: previous() != boundary #%d", static_cast<int>(capacity),
+                      static_cast<int>(i));
+                return;
+            }
+        }
+        for (int32_t j = 0; j < 200 && i + 1 < count; ++j) {
+            if (bi->next() != expected[++i]) {
+                errln("capacity %d: next() != boundary #%d", static_cast<int>(capacity),
+                      static_cast<int>(i));
+                return;
+            }
+        }
+    }
+
+    // A copy gets the same capacity, and iterates the same.
+    RuleBasedBreakIterator copy(*bi);
+    TEST_ASSERT(copy.current() == expected[i]);
+    TEST_ASSERT(copy.preceding(expected[i]) == expected[i - 1]);
+}
+
+
 void RBBIAPITest::TestRefreshInputText() {
     /*
      *  RefreshInput changes out the input of a Break Iterator without
@@ -1466,6 +1601,10 @@ void RBBIAPITest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestGetBinaryRules);
 #endif
     TESTCASE_AUTO(TestRefreshInputText);
+#if !UCONFIG_NO_FILE_IO
+    TESTCASE_AUTO(TestNextBoundaries);
+    TESTCASE_AUTO(TestCacheCapacity);
+#endif
 #if !UCONFIG_NO_BREAK_ITERATION
     TESTCASE_AUTO(TestFilteredBreakIteratorBuilder);
 #endif
@@ -91,6 +91,9 @@ class RBBIAPITest: public IntlTest {
 
     void TestRefreshInputText();
 
+    void TestNextBoundaries();
+    void TestCacheCapacity();
+
     /**
      *Internal subroutines
      **/
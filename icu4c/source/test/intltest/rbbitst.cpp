@@ -158,6 +158,8 @@ void RBBITest::runIndexedTest( int32_t index, UBool exec, const char* &name, cha
     TESTCASE_AUTO(TestBug22585);
     TESTCASE_AUTO(TestBug22602);
     TESTCASE_AUTO(TestBug22636);
+    TESTCASE_AUTO(TestUTF8Text);
+    TESTCASE_AUTO(TestCJKBreakCache);
 
 #if U_ENABLE_TRACING
     TESTCASE_AUTO(TestTraceCreateCharacter);
@@ -4894,6 +4896,159 @@ void RBBITest::TestBug22636() {
     assertEquals(WHERE, ec, U_ZERO_ERROR);
 }
 
+void RBBITest::TestUTF8Text() {
+    // Break iteration over UTF-8 text reads the bytes directly, not via the UText chunks.
+    // Boundaries and rule statuses must be the same as for the equivalent UTF-16 text,
+    // including for ill-formed UTF-8, which is read as U+FFFD.
+    const char utf8[] =
+        "Hello, world! \"It's 3.14\" \xE2\x80\x94 na\xC3\xAFve caf\xC3\xA9s.\r\n"
+        "\xE0\xB8\xA0\xE0\xB8\xB2\xE0\xB8\xA9\xE0\xB8\xB2\xE0\xB9\x84\xE0\xB8\x97\xE0\xB8\xA2 "
+        "\xE4\xB8\xAD\xE6\x96\x87\xE3\x80\x82 \xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9 "
+        "a\xCC\x81 \xC0\x80x \xED\xA0\x80y \xE4\xB8z \xF4\x90\x80\x80 \x80\xBF end\xE4";
+    int32_t length = static_cast<int32_t>(strlen(utf8));
+    const uint8_t *s8 = reinterpret_cast<const uint8_t *>(utf8);
+
+    // Convert to UTF-16 the way the UTF-8 UText does,
+    // and map UTF-16 indexes to byte offsets.
+    UnicodeString s16;
+    std::vector<int32_t> map16To8;
+    for (int32_t i = 0; i < length;) {
+        int32_t start = i;
+        UChar32 c;
+        U8_NEXT_OR_FFFD(s8, i, length, c);
+        s16.append(c);
+        while (static_cast<int32_t>(map16To8.size()) < s16.length()) {
+            map16To8.push_back(start);
+        }
+    }
+    map16To8.push_back(length);
+
+    static const char *const types[] = { "character", "word", "line", "sentence" };
+    for (const char *type : types) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<BreakIterator> bi8, bi16;
+        Locale locale = Locale::getEnglish();
+        if (uprv_strcmp(type, "character") == 0) {
+            bi8.adoptInstead(BreakIterator::createCharacterInstance(locale, status));
+            bi16.adoptInstead(BreakIterator::createCharacterInstance(locale, status));
+        } else if (uprv_strcmp(type, "word") == 0) {
+            bi8.adoptInstead(BreakIterator::createWordInstance(locale, status));
+            bi16.adoptInstead(BreakIterator::createWordInstance(locale, status));
+        } else if (uprv_strcmp(type, "line") == 0) {
+            bi8.adoptInstead(BreakIterator::createLineInstance(locale, status));
+            bi16.adoptInstead(BreakIterator::createLineInstance(locale, status));
+        } else {
+            bi8.adoptInstead(BreakIterator::createSentenceInstance(locale, status));
+            bi16.adoptInstead(BreakIterator::createSentenceInstance(locale, status));
+        }
+        if (U_FAILURE(status)) {
+            dataerrln("%s %d: error creating %s break iterator: %s",
+                      __FILE__, __LINE__, type, u_errorName(status));
+            return;
+        }
+        LocalUTextPointer ut(utext_openUTF8(nullptr, utf8, length, &status));
+        bi8->setText(ut.getAlias(), status);
+        bi16->setText(s16);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+
+        // Forward
+        int32_t p16 = bi16->first();
+        int32_t p8 = bi8->first();
+        for (;;) {
+            if (p8 != (p16 == UBRK_DONE ? UBRK_DONE : map16To8[p16]) ||
+                    bi8->getRuleStatus() != bi16->getRuleStatus()) {
+                errln("%s %s: next() UTF-8 %d status %d, UTF-16 %d status %d", WHERE, type,
+                      static_cast<int>(p8), static_cast<int>(bi8->getRuleStatus()),
+                      static_cast<int>(p16), static_cast<int>(bi16->getRuleStatus()));
+                break;
+            }
+            if (p16 == UBRK_DONE) {
+                break;
+            }
+            p16 = bi16->next();
+            p8 = bi8->next();
+        }
+
+        // Backward
+        p16 = bi16->last();
+        p8 = bi8->last();
+        for (;;) {
+            if (p8 != (p16 == UBRK_DONE ? UBRK_DONE : map16To8[p16])) {
+                errln("%s %s: previous() UTF-8 %d, UTF-16 %d", WHERE, type,
+                      static_cast<int>(p8), static_cast<int>(p16));
+                break;
+            }
+            if (p16 == UBRK_DONE) {
+                break;
+            }
+            p16 = bi16->previous();
+            p8 = bi8->previous();
+        }
+
+        // Random access at each code point
+        for (int32_t i16 = 0; i16 <= s16.length(); i16 = s16.moveIndex32(i16, 1)) {
+            int32_t i8 = map16To8[i16];
+            p16 = bi16->following(i16);
+            p8 = bi8->following(i8);
+            assertEquals(WHERE, p16 == UBRK_DONE ? UBRK_DONE : map16To8[p16], p8);
+            p16 = bi16->preceding(i16);
+            p8 = bi8->preceding(i8);
+            assertEquals(WHERE, p16 == UBRK_DONE ? UBRK_DONE : map16To8[p16], p8);
+            assertEquals(WHERE, bi16->isBoundary(i16), bi8->isBoundary(i8));
+            if (i16 == s16.length()) {
+                break;
+            }
+        }
+    }
+}
+
+void RBBITest::TestCJKBreakCache() {
+    // The CJK dictionary break engine caches the segmentation of recent runs of text.
+    // Segmenting the same text again, at another offset, with a clone,
+    // or after the other break mode must give the same boundaries.
+    UnicodeString text(u"\u65E5\u672C\u8A9E\u306E\u6587\u7AE0\u3092\u5358\u8A9E\u306B"
+                       u"\u5206\u5272\u3057\u307E\u3059\u3002\u6771\u4EAC\u90FD\u306B"
+                       u"\u4F4F\u3093\u3067\u3044\u307E\u3059\u3002\u30B3\u30F3\u30D4"
+                       u"\u30E5\u30FC\u30BF\u30FC\uFF11\uFF12\u500B");
+    UnicodeString prefix(u"abc def ");
+    auto getBoundaries = [](BreakIterator &bi, const UnicodeString &s, int32_t offset) {
+        bi.setText(s);
+        std::vector<int32_t> boundaries;
+        for (int32_t p = bi.first(); p != BreakIterator::DONE; p = bi.next()) {
+            if (p >= offset) {
+                boundaries.push_back(p - offset);
+            }
+        }
+        return boundaries;
+    };
+
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> word(BreakIterator::createWordInstance(Locale::getJapanese(), status));
+    LocalPointer<BreakIterator> phrase(
+        BreakIterator::createLineInstance(Locale("ja@lw=phrase"), status));
+    if (U_FAILURE(status)) {
+        dataerrln("%s %d: error creating break iterators: %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    LocalPointer<BreakIterator> wordClone(word->clone());
+    std::vector<int32_t> wordBoundaries = getBoundaries(*word, text, 0);
+    std::vector<int32_t> phraseBoundaries = getBoundaries(*phrase, text, 0);
+    if (wordBoundaries.size() <= 8) {
+        dataerrln("%s %d: Japanese text was not segmented, missing CJK dictionary?", __FILE__, __LINE__);
+        return;
+    }
+    assertTrue(WHERE, wordBoundaries != phraseBoundaries);
+    for (int32_t i = 0; i < 3; ++i) {
+        assertTrue(WHERE, getBoundaries(*word, text, 0) == wordBoundaries);
+        assertTrue(WHERE, getBoundaries(*wordClone, text, 0) == wordBoundaries);
+        assertTrue(WHERE, getBoundaries(*word, prefix + text, prefix.length()) == wordBoundaries);
+        assertTrue(WHERE, getBoundaries(*phrase, text, 0) == phraseBoundaries);
+        assertTrue(WHERE, getBoundaries(*phrase, prefix + text, prefix.length()) == phraseBoundaries);
+    }
+}
+
 void RBBITest::TestBug22584() {
     // Creating a break iterator from a rule consisting of a very long
     // literal input string caused a stack overflow when deleting the
@@ -107,6 +107,8 @@ class RBBITest: public IntlTest {
     void TestBug22585();
     void TestBug22602();
     void TestBug22636();
+    void TestUTF8Text();
+    void TestCJKBreakCache();
 
 #if U_ENABLE_TRACING
     void TestTraceCreateCharacter();
@@ -45,6 +45,7 @@
 #include "regextst.h"
 #include "regexcmp.h"
 #include "uvector.h"
+#include "uvectr32.h"
 #include "util.h"
 #include "cmemory.h"
 #include "cstring.h"
@@ -109,6 +110,11 @@ void RegexTest::runIndexedTest( int32_t index, UBool exec, const char* &name, ch
     TESTCASE_AUTO(TestBug20359);
     TESTCASE_AUTO(TestBug20863);
     TESTCASE_AUTO(TestBug23143);
+    TESTCASE_AUTO(TestRegexSet);
+    TESTCASE_AUTO(TestRegexEngine);
+    TESTCASE_AUTO(TestRequiredStrings);
+    TESTCASE_AUTO(TestUTF8Matching);
+    TESTCASE_AUTO(TestFindAll);
     TESTCASE_AUTO_END;
 }
 
@@ -1261,9 +1267,11 @@ void RegexTest::API_Match() {
         UErrorCode status = U_ZERO_ERROR;
         UnicodeString testString(1000000, 0x41, 1000000);  // Length 1,000,000, filled with 'A'
 
-        // Adding the capturing parentheses to the pattern "(A)+A$" inhibits optimizations
+        // Adding the capturing parentheses to the pattern "(A)+A\1$" inhibits optimizations
         //   of the '+', and makes the stack frames larger.
-        RegexMatcher matcher("(A)+A$", testString, 0, status);
+        //   The back reference keeps the pattern on the backtracking engine.
+        RegexMatcher matcher("(A)+A\\1$", testString, 0, status);
+        REGEX_ASSERT(matcher.pattern().getEngine() == UREGEX_ENGINE_BACKTRACKING);
 
         // With the default stack, this match should fail to run
         REGEX_ASSERT(matcher.lookingAt(status) == false);
@@ -1284,6 +1292,18 @@ void RegexTest::API_Match() {
         REGEX_ASSERT(status == U_REGEX_STACK_OVERFLOW);
         REGEX_ASSERT(matcher.getStackLimit() == 10000);
     }
+    {
+        // Without the back reference, the automaton engine needs no backtracking stack.
+        UErrorCode status = U_ZERO_ERROR;
+        UnicodeString testString(1000000, 0x41, 1000000);
+        RegexMatcher matcher("(A)+A$", testString, 0, status);
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(matcher.pattern().getEngine() == UREGEX_ENGINE_AUTOMATON);
+        matcher.setStackLimit(10000, status);
+        REGEX_ASSERT(matcher.lookingAt(status) == true);
+        REGEX_CHECK_STATUS;
+        REGEX_ASSERT(matcher.start(1, status) == 999998);
+    }
 
         // A pattern that doesn't save state should work with
         //   a minimal sized stack
@@ -5933,4 +5953,481 @@ void RegexTest::TestBug20863() {
 }
 
 
+
+void RegexTest::TestRegexSet() {
+    // RegexSet::matches() must agree with running RegexMatcher::find() on each
+    // pattern separately, both for the patterns that RegexSet matches together
+    // and for the ones (back references, look-around) that it matches one by one.
+    static const char16_t *patterns[] = {
+        u"abc", u"^abc", u"abc$", u"^$", u"\\Aab", u"ab\\z", u"ab\\Z",
+        u"a.c", u"a.*c", u"a.+?c", u"\\d+", u"\\D\\d", u"\\h\\H", u"\\v", u"\\R",
+        u"[a-c]x", u"[^a-z]+", u"\\w+\\b", u"\\bfoo\\b", u"\\Bo\\B", u"\\s",
+        u"(ab|cd)e", u"(a|b)*c", u"x{2,3}", u"(?:ab){2}", u"(ab){1,}z", u"a{0,2}b{3}",
+        u"(?:a?){3}a{3}", u"(a*)*b", u"a??b", u"colou?r",
+        u"straße", u"ß", u"ss", u"ﬃ", u"[ß]", u"Σσ",
+        u"\\U0001F600", u"\\x{1F600}.", u"[\\x{1F600}-\\x{1F64F}]", u"..$",
+        u"(a)\\1", u"a(?=b)", u"(?<!x)y", u"(?>a+)b", u"a++b", u"\\X",
+        u"\\Qa.b\\E", u"\\p{Lu}\\p{Ll}",
+    };
+    static const char16_t *inputs[] = {
+        u"", u"abc", u"xabc", u"abcx", u"ab\n", u"ab\r\n", u"\n", u"\r\n", u"x\r\ny",
+        u"a\nc", u"a\rc", u"a c", u"foo bar", u"foobar", u"123", u"x1", u"\t z",
+        u"xx", u"xxx", u"ababz", u"bbbc", u"aab", u"aaa", u"color", u"colour",
+        u"STRASSE", u"strasse", u"Straße", u"SS", u"ẞ", u"FFI", u"ffi",
+        u"σς", u"ΣΣ", u"\U0001F600x", u"\U0001F64Fab\r\n", u"a.b",
+        u"aa", u"ab", u"zy", u"xy", u"aaab", u"Ab", u"é", u"abcde",
+        u"cde",
+    };
+    static const uint32_t flagsList[] = {
+        0, UREGEX_CASE_INSENSITIVE, UREGEX_MULTILINE, UREGEX_DOTALL,
+        UREGEX_MULTILINE | UREGEX_UNIX_LINES, UREGEX_DOTALL | UREGEX_UNIX_LINES,
+        UREGEX_MULTILINE | UREGEX_CASE_INSENSITIVE,
+    };
+    constexpr int32_t patternCount = UPRV_LENGTHOF(patterns);
+
+    UnicodeString patternStrings[patternCount];
+    for (int32_t i = 0; i < patternCount; ++i) {
+        patternStrings[i] = patterns[i];
+    }
+    std::vector<UnicodeString> inputStrings(std::begin(inputs), std::end(inputs));
+    inputStrings.push_back(UnicodeString(u"a").append(static_cast<char16_t>(0xD800)));
+    inputStrings.push_back(UnicodeString(static_cast<char16_t>(0xDC00)).append(u"b\r"));
+    for (uint32_t flags : flagsList) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<RegexSet> set(RegexSet::compile(patternStrings, patternCount, flags, status));
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        assertEquals(WHERE, patternCount, set->size());
+        for (const UnicodeString &input : inputStrings) {
+            int32_t expected[patternCount];
+            int32_t expectedLength = 0;
+            for (int32_t i = 0; i < patternCount; ++i) {
+                LocalPointer<RegexMatcher> matcher(set->getPattern(i)->matcher(input, status));
+                if (matcher->find(status)) {
+                    expected[expectedLength++] = i;
+                }
+            }
+            int32_t actual[patternCount];
+            int32_t actualLength = set->matches(input, actual, patternCount, status);
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            UBool same = expectedLength == actualLength;
+            for (int32_t i = 0; same && i < actualLength; ++i) {
+                same = expected[i] == actual[i];
+            }
+            if (!same) {
+                for (int32_t i = 0; i < patternCount; ++i) {
+                    UBool inExpected = false, inActual = false;
+                    for (int32_t j = 0; j < expectedLength; ++j) { inExpected |= expected[j] == i; }
+                    for (int32_t j = 0; j < actualLength; ++j) { inActual |= actual[j] == i; }
+                    if (inExpected != inActual) {
+                        errln(UnicodeString("RegexSet flags 0x") + toHex(flags) + " pattern \"" +
+                              prettify(patternStrings[i]) + "\" on \"" + prettify(input) +
+                              "\": RegexSet says " + (inActual ? "match" : "no match"));
+                    }
+                }
+            }
+            assertEquals(WHERE, expectedLength > 0, set->matchesAny(input, status));
+        }
+    }
+
+    // Preflighting, and the patterns are reported in order.
+    UErrorCode status = U_ZERO_ERROR;
+    UnicodeString few[] = { u"b", u"(x)\\1", u"a", u"c" };
+    LocalPointer<RegexSet> set(RegexSet::compile(few, UPRV_LENGTHOF(few), 0, status));
+    assertSuccess(WHERE, status);
+    assertEquals(WHERE, 2, set->matches(u"xcb", nullptr, 0, status));
+    assertEquals(WHERE, U_BUFFER_OVERFLOW_ERROR, status);
+    status = U_ZERO_ERROR;
+    int32_t found[4] = {-1, -1, -1, -1};
+    assertEquals(WHERE, 3, set->matches(u"xxba", found, 1, status));
+    assertEquals(WHERE, U_BUFFER_OVERFLOW_ERROR, status);
+    assertEquals(WHERE, 0, found[0]);
+    assertEquals(WHERE, -1, found[1]);
+    status = U_ZERO_ERROR;
+    assertEquals(WHERE, 3, set->matches(u"cxxb", found, 4, status));
+    assertSuccess(WHERE, status);
+    assertEquals(WHERE, 0, found[0]);
+    assertEquals(WHERE, 1, found[1]);
+    assertEquals(WHERE, 3, found[2]);
+    assertTrue(WHERE, set->getPattern(4) == nullptr);
+    assertTrue(WHERE, set->getPattern(-1) == nullptr);
+
+    // A syntax error in any pattern fails the whole set,
+    // and errorIndex tells which pattern it was.
+    UnicodeString bad[] = { u"a", u"(b", u"c", u"[d" };
+    UParseError pe;
+    int32_t errorIndex = 99;
+    LocalPointer<RegexSet> badSet(RegexSet::compile(bad, UPRV_LENGTHOF(bad), 0, pe, errorIndex, status));
+    assertEquals(WHERE, U_REGEX_MISMATCHED_PAREN, status);
+    assertTrue(WHERE, badSet.isNull());
+    assertEquals(WHERE, 1, errorIndex);
+    assertEquals(WHERE, 2, pe.offset);
+
+    status = U_ZERO_ERROR;
+    badSet.adoptInstead(RegexSet::compile(bad + 2, 2, 0, pe, errorIndex, status));
+    assertEquals(WHERE, U_REGEX_MISSING_CLOSE_BRACKET, status);
+    assertEquals(WHERE, 1, errorIndex);
+
+    status = U_ZERO_ERROR;
+    badSet.adoptInstead(RegexSet::compile(bad, 1, 0, pe, errorIndex, status));
+    assertSuccess(WHERE, status);
+    assertEquals(WHERE, -1, errorIndex);
+
+    // An empty set matches nothing.
+    status = U_ZERO_ERROR;
+    LocalPointer<RegexSet> emptySet(RegexSet::compile(nullptr, 0, 0, status));
+    assertSuccess(WHERE, status);
+    assertEquals(WHERE, 0, emptySet->matches(u"abc", nullptr, 0, status));
+    assertFalse(WHERE, emptySet->matchesAny(u"abc", status));
+    assertSuccess(WHERE, status);
+}
+
+// Describes the state of a matcher after find(), lookingAt() or matches(),
+// for comparing the automaton and the backtracking engines.
+static UnicodeString matchState(RegexMatcher &matcher, UBool found, UErrorCode &status) {
+    UnicodeString result(found ? u"match" : u"no match");
+    if (found) {
+        for (int32_t group = 0; group <= matcher.groupCount(); ++group) {
+            result += UnicodeString(u" ") + matcher.start(group, status) + u"-" + matcher.end(group, status);
+        }
+    }
+    result.append(matcher.hitEnd() ? u" hitEnd" : u"").append(matcher.requireEnd() ? u" requireEnd" : u"");
+    return result;
+}
+
+void RegexTest::TestRegexEngine() {
+    UErrorCode status = U_ZERO_ERROR;
+    static const char16_t *automatonPatterns[] = {
+        u"abc", u"(a|ab)(c|bcd)(d*)", u"(a+)+b", u"(x*)*y", u"^$", u"\\bfoo\\b", u"(?i)straße",
+    };
+    for (const char16_t *pattern : automatonPatterns) {
+        LocalPointer<RegexPattern> pat(RegexPattern::compile(pattern, 0, status));
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        assertEquals(UnicodeString(u"engine for ") + pattern, UREGEX_ENGINE_AUTOMATON, pat->getEngine());
+        LocalPointer<RegexPattern> copy(pat->clone());
+        assertEquals(WHERE, UREGEX_ENGINE_AUTOMATON, copy->getEngine());
+    }
+    static const char16_t *backtrackingPatterns[] = {
+        u"(a)\\1", u"a(?=b)", u"(?<!x)y", u"(?>a+)b", u"a++b", u"\\X", u"(?w)\\b",
+    };
+    for (const char16_t *pattern : backtrackingPatterns) {
+        LocalPointer<RegexPattern> pat(RegexPattern::compile(pattern, 0, status));
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        assertEquals(UnicodeString(u"engine for ") + pattern, UREGEX_ENGINE_BACKTRACKING, pat->getEngine());
+    }
+
+    // The automaton must leave the same matches, groups, hitEnd and requireEnd as the
+    // backtracking engine, which a time limit forces.
+    static const char16_t *patterns[] = {
+        u"abc", u"^abc", u"abc$", u"^$", u"$", u"\\Aab", u"ab\\z", u"ab\\Z", u"\\Gab",
+        u"a.c", u"a.*c", u"a.+?c", u"(a*)(b?)", u"\\d+", u"\\v", u"\\R", u"x\\R?$",
+        u"(ab|a)(bc|c)?", u"(a|b)*c", u"((a)|b)+", u"x{2,3}", u"(?:ab){2}", u"a{0,2}b{3}",
+        u"(?:a?){3}a{3}", u"(a*)*b", u"(a*)+$", u"(a|ab)*?c", u"a??b", u"colou?r",
+        u"\\w+\\b", u"\\bfoo\\b", u"\\Bo\\B", u"(?s).*", u".*$", u"^.*?$",
+        u"straße", u"ß", u"[ß]s", u"Σσ", u"\\x{1F600}.", u"..$", u"\\p{Lu}\\p{Ll}*",
+    };
+    static const char16_t *inputs[] = {
+        u"", u"abc", u"xabcabc", u"abcx", u"ab\n", u"ab\r\n", u"\n", u"x\r\ny", u"x\r\n",
+        u"a\nc", u"aabbc", u"foo bar", u"foobar", u"123 45", u"abcbcd", u"aaab", u"ababab",
+        u"xxxx", u"colour color", u"STRASSE", u"Straße ss", u"ΣΣσς", u"\U0001F600x",
+        u"Hello World",
+    };
+    static const uint32_t flagsList[] = {
+        0, UREGEX_CASE_INSENSITIVE, UREGEX_MULTILINE, UREGEX_DOTALL,
+        UREGEX_MULTILINE | UREGEX_UNIX_LINES,
+    };
+    for (uint32_t flags : flagsList) {
+        for (const char16_t *pattern : patterns) {
+            LocalPointer<RegexPattern> pat(RegexPattern::compile(pattern, flags, status));
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            if (pat->getEngine() != UREGEX_ENGINE_AUTOMATON) {
+                errln(UnicodeString("Expected the automaton engine for \"") + pattern +
+                      "\" flags 0x" + toHex(flags));
+                continue;
+            }
+            for (const char16_t *inputChars : inputs) {
+                UnicodeString input(inputChars);
+                LocalPointer<RegexMatcher> automaton(pat->matcher(input, status));
+                LocalPointer<RegexMatcher> backtracker(pat->matcher(input, status));
+                backtracker->setTimeLimit(1000000, status);
+                if (!assertSuccess(WHERE, status)) {
+                    return;
+                }
+                for (int32_t regionStart = 0; regionStart <= 1 && regionStart <= input.length(); ++regionStart) {
+                    UnicodeString expected, actual;
+                    for (RegexMatcher *matcher : {automaton.getAlias(), backtracker.getAlias()}) {
+                        UnicodeString &result = matcher == automaton.getAlias() ? actual : expected;
+                        matcher->region(regionStart, input.length(), status);
+                        matcher->useAnchoringBounds(regionStart == 0);
+                        result.append(u"lookingAt: ").append(matchState(*matcher, matcher->lookingAt(status), status));
+                        matcher->region(regionStart, input.length(), status);
+                        result.append(u"; matches: ").append(matchState(*matcher, matcher->matches(status), status));
+                        matcher->region(regionStart, input.length(), status);
+                        for (int32_t i = 0; i < 8; ++i) {
+                            UBool found = matcher->find(status);
+                            result.append(u"; find: ").append(matchState(*matcher, found, status));
+                            if (!found) {
+                                break;
+                            }
+                        }
+                    }
+                    if (!assertSuccess(WHERE, status)) {
+                        return;
+                    }
+                    if (expected != actual) {
+                        errln(UnicodeString("Engines differ for \"") + prettify(pattern) + "\" flags 0x" +
+                              toHex(flags) + " on \"" + prettify(input) + "\" from " + regionStart +
+                              "\n  backtracking: " + expected + "\n  automaton:    " + actual);
+                    }
+                }
+            }
+        }
+    }
+}
+
+static UBool U_CALLCONV continueFinding(const void * /*context*/, int64_t /*matchIndex*/) {
+    return true;
+}
+
+void RegexTest::TestRequiredStrings() {
+    // find() skips start positions after the last occurrence of the literal strings that
+    // a match must contain.  A find progress callback, which must see every position,
+    // turns that off, so the matches found must be the same either way.
+    UErrorCode status = U_ZERO_ERROR;
+    static const char16_t *patterns[] = {
+        u"abc", u".*ERROR\\d+", u"a(bc)+d", u"x(foo|bar)y", u"(foo|bar|baz)", u"a?bc",
+        u"(?=abc)x", u"ab(?:cd)*ef", u"(a|b|c)(d|e|f)(g|h)", u"x{0,3}yy", u"\\w+@example\\.com",
+        u"a(b)\\1", u"ab(?<=b)cd", u"(?<!x)ab", u"(a*)ab", u"b\\b", u"\\x{1F600}b", u"(?:ab|b)+?c",
+    };
+    static const char16_t *inputs[] = {
+        u"", u"abc", u"xabcabc", u"abcbcd abcd", u"xfooy xbary xbazy", u"foo bar baz",
+        u"ERROR12 ERROR", u"ab cd ef abcdcdef", u"adg beh cfh", u"xxyy yy", u"a@example.com b@x",
+        u"abb ab", u"abcd", u"xab ab", u"aaab", u"b bb", u"\U0001F600b b", u"ababc bc",
+    };
+    for (const char16_t *pattern : patterns) {
+        LocalPointer<RegexPattern> pat(RegexPattern::compile(pattern, 0, status));
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        for (const char16_t *inputChars : inputs) {
+            UnicodeString input(inputChars);
+            LocalPointer<RegexMatcher> skipping(pat->matcher(input, status));
+            LocalPointer<RegexMatcher> stepping(pat->matcher(input, status));
+            stepping->setFindProgressCallback(continueFinding, nullptr, status);
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            UnicodeString expected, actual;
+            for (RegexMatcher *matcher : {skipping.getAlias(), stepping.getAlias()}) {
+                UnicodeString &result = matcher == skipping.getAlias() ? actual : expected;
+                for (int32_t i = 0; i < 8; ++i) {
+                    UBool found = matcher->find(status);
+                    result.append(u"find: ").append(matchState(*matcher, found, status)).append(u"; ");
+                    if (!found) {
+                        break;
+                    }
+                }
+                for (int32_t start = 0; start <= input.length(); start += 3) {
+                    result.append(UnicodeString(u"find from ") + start + u": ").append(matchState(*matcher, matcher->find(start, status), status));
+                }
+            }
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            if (expected != actual) {
+                errln(UnicodeString("find() differs for \"") + prettify(pattern) + "\" on \"" +
+                      prettify(input) + "\"\n  expected: " + expected + "\n  actual:   " + actual);
+            }
+        }
+    }
+
+    // Without "bc" in the input, no match is attempted, so the time limit is not reached.
+    UnicodeString input(30, u'a', 30);
+    RegexMatcher matcher(u"(a+)+\\1bc", input, 0, status);
+    matcher.setTimeLimit(10, status);
+    REGEX_ASSERT(!matcher.find(status));
+    REGEX_CHECK_STATUS;
+    REGEX_ASSERT(matcher.hitEnd());
+}
+
+// The matches in a UTF-8 UText, with their byte offsets as UTF-16 indexes.
+static UnicodeString utf8Matches(RegexMatcher &matcher, StringPiece text8, UErrorCode &status) {
+    UnicodeString result;
+    for (int32_t i = 0; i < 10 && matcher.find(status); ++i) {
+        for (int32_t group = 0; group <= matcher.groupCount(); ++group) {
+            int32_t start = matcher.start(group, status);
+            int32_t end = matcher.end(group, status);
+            if (start >= 0) {
+                start = UnicodeString::fromUTF8(StringPiece(text8.data(), start)).length();
+                end = UnicodeString::fromUTF8(StringPiece(text8.data(), end)).length();
+            }
+            result += UnicodeString(u" ") + start + u"-" + end;
+        }
+        result.append(u";");
+    }
+    return result;
+}
+
+void RegexTest::TestUTF8Matching() {
+    // UTF-8 input is matched directly from its string, at byte offsets.
+    // The matches must be the same as in the UTF-16 text.
+    UErrorCode status = U_ZERO_ERROR;
+    static const char16_t *patterns[] = {
+        u"é+", u"(?i)strasse", u"(?i)(ß)\\1", u"(?<=é)x", u"(?<!Ω)x", u"(?<=\\x{1F600}é{1,2})x",
+        u"\\x{1F600}+.", u"[^a]{2}", u"\\bwörd\\b", u"x$", u"(?m)Ω$", u"(?m)^Ω", u"(?m)^(?=x)",
+        u".*\\R", u"(é|Ω)\\1", u"\\X", u"a.?c", u"\\w+", u"[éΩ]*x",
+    };
+    static const char16_t *inputs[] = {
+        u"", u"éé x éx Ωx", u"Straße STRASSE strasse", u"ßß ßSS", u"\U0001F600\U0001F600éx",
+        u"\U0001F600éx éx", u"wörd wörder", u"x\u2028", u"é\r\nΩ\u2029Ω", u"ΩΩ éé",
+        u"ae\u0301c a\U0001F600c", u"x\r\n",
+    };
+    for (const char16_t *pattern : patterns) {
+        LocalPointer<RegexPattern> pat(RegexPattern::compile(pattern, 0, status));
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        for (const char16_t *inputChars : inputs) {
+            UnicodeString input(inputChars);
+            std::string utf8;
+            input.toUTF8String(utf8);
+            StringPiece text8(utf8);
+            LocalUTextPointer ut(utext_openUTF8(nullptr, text8.data(), text8.length(), &status));
+            LocalPointer<RegexMatcher> matcher16(pat->matcher(input, status));
+            LocalPointer<RegexMatcher> matcher8(pat->matcher(status));
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            matcher8->reset(ut.getAlias());
+            UnicodeString expected;
+            for (int32_t i = 0; i < 10 && matcher16->find(status); ++i) {
+                for (int32_t group = 0; group <= matcher16->groupCount(); ++group) {
+                    expected += UnicodeString(u" ") + matcher16->start(group, status) + u"-" +
+                                matcher16->end(group, status);
+                }
+                expected.append(u";");
+            }
+            UnicodeString actual = utf8Matches(*matcher8, text8, status);
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            if (expected != actual) {
+                errln(UnicodeString("UTF-8 find() differs for \"") + prettify(pattern) + "\" on \"" +
+                      prettify(input) + "\"\n  expected: " + expected + "\n  actual:   " + actual);
+            }
+        }
+    }
+}
+
+
+void RegexTest::TestFindAll() {
+    // findAll() on several threads must return the same matches as find() on the whole input,
+    // also for matches that cross the boundaries between the chunks of the input.
+    UErrorCode status = U_ZERO_ERROR;
+    static const char16_t *pieces[] = {
+        u"a", u"b", u"c", u"ab", u" ", u"x", u"é", u"\U0001F600", u"1", u"23", u"\n", u"GET ",
+    };
+    UnicodeString input;
+    uint32_t seed = 1;
+    while (input.length() < 600000) {
+        seed = seed * 1103515245 + 12345;
+        input.append(pieces[(seed >> 16) % UPRV_LENGTHOF(pieces)]);
+    }
+    std::string utf8;
+    input.toUTF8String(utf8);
+    LocalUTextPointer ut(utext_openUTF8(nullptr, utf8.data(), utf8.length(), &status));
+
+    static const struct {
+        const char16_t *pattern;
+        int32_t maxMatchLength;
+    } cases[] = {
+        { u"\\d{2,3}", -1 },
+        { u"a.c", -1 },
+        { u"(?m)^GET [a-c]", -1 },
+        { u"\\bab\\b", -1 },
+        { u"(?<=é)x|\\x{1F600}", -1 },
+        { u"x?", -1 },
+        { u"[abc é]{1,40}", -1 },
+        { u"(?i)[A-Z ]{2,30}", -1 },
+        { u"[^\\n]+", -1 },                  // Unbounded: searched on one thread.
+        { u"[^\\n]+", 20000 },
+        { u"(?m)$", -1 },
+        { u"\\Gab|.", -1 },                  // \G: searched on one thread.
+    };
+    for (const auto &c : cases) {
+        LocalPointer<RegexPattern> pat(RegexPattern::compile(c.pattern, 0, status));
+        LocalPointer<RegexMatcher> matcher(pat.isValid() ? pat->matcher(input, status) : nullptr);
+        if (!assertSuccess(WHERE, status)) {
+            return;
+        }
+        UVector32 expected(status);
+        while (matcher->find(status)) {
+            expected.addElement(matcher->start(status), status);
+            expected.addElement(matcher->end(status), status);
+        }
+        int32_t count = expected.size() / 2;
+
+        // Preflighting.
+        REGEX_ASSERT(pat->findAll(input, c.maxMatchLength, 4, nullptr, nullptr, 0, status) == count);
+        REGEX_ASSERT(status == (count > 0 ? U_BUFFER_OVERFLOW_ERROR : U_ZERO_ERROR));
+        status = U_ZERO_ERROR;
+
+        LocalArray<int32_t> starts(new int32_t[count + 1]);
+        LocalArray<int32_t> limits(new int32_t[count + 1]);
+        LocalArray<int64_t> starts8(new int64_t[count + 1]);
+        LocalArray<int64_t> limits8(new int64_t[count + 1]);
+        for (int32_t threadCount : {1, 4, 8}) {
+            int32_t actualCount = pat->findAll(input, c.maxMatchLength, threadCount,
+                                               starts.getAlias(), limits.getAlias(), count + 1, status);
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            int32_t i = 0;
+            while (i < count && i < actualCount &&
+                   starts[i] == expected.elementAti(2 * i) && limits[i] == expected.elementAti(2 * i + 1)) {
+                ++i;
+            }
+            if (i < count || actualCount != count) {
+                errln(UnicodeString("findAll() differs for \"") + prettify(c.pattern) + "\" on " +
+                      threadCount + " threads at match " + i + " of " + count + " (" + actualCount + ")");
+            }
+
+            // UTF-8 input, with the derived maximum match length in bytes.
+            int64_t maxMatchLength8 = c.maxMatchLength < 0 ? -1 : c.maxMatchLength * 3;
+            actualCount = pat->findAll(ut.getAlias(), maxMatchLength8, threadCount,
+                                       starts8.getAlias(), limits8.getAlias(), count + 1, status);
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            int32_t count8 = 0;
+            for (matcher->reset(ut.getAlias()); matcher->find(status); ++count8) {
+                if (count8 >= actualCount || matcher->start64(status) != starts8[count8] ||
+                        matcher->end64(status) != limits8[count8]) {
+                    break;
+                }
+            }
+            if (count8 != count || actualCount != count) {
+                errln(UnicodeString("UTF-8 findAll() differs for \"") + prettify(c.pattern) + "\" on " +
+                      threadCount + " threads at match " + count8 + " of " + count + " (" + actualCount + ")");
+            }
+            matcher->reset(input);
+        }
+    }
+
+    LocalPointer<RegexPattern> pat(RegexPattern::compile(u"a", 0, status));
+    REGEX_CHECK_STATUS;
+    int32_t start;
+    pat->findAll(input, -1, 2, &start, nullptr, 1, status);
+    REGEX_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+}
+
 #endif  /* !UCONFIG_NO_REGULAR_EXPRESSIONS  */
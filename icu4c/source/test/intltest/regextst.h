@@ -62,6 +62,11 @@ class RegexTest: public IntlTest {
     virtual void TestBug20359();
     virtual void TestBug20863();
     virtual void TestBug23143();
+    virtual void TestRegexSet();
+    virtual void TestRegexEngine();
+    virtual void TestRequiredStrings();
+    virtual void TestUTF8Matching();
+    virtual void TestFindAll();
 
     // The following functions are internal to the regexp tests.
     virtual void assertUText(const char *expected, UText *actual, const char *file, int line);
@@ -197,6 +197,8 @@ TransliteratorTest::runIndexedTest(int32_t index, UBool exec,
         TESTCASE(83,TestThai);
         TESTCASE(84,TestAny);
         TESTCASE(85,TestBasicTransliteratorEvenWithoutData);
+        TESTCASE(86,TestRuleKeyPrefixes);
+        TESTCASE(87,TestTransliterateToString);
         default: name = ""; break;
     }
 }
@@ -1509,6 +1511,98 @@ void TransliteratorTest::TestNormalizationTransliterator() {
     delete t;
 }
 
+/**
+ * The rule set skips rules whose leading literal key characters or first
+ * set do not match the text.  Make sure that this does not change which
+ * rule matches, including partial matches in incremental mode.
+ */
+void TransliteratorTest::TestRuleKeyPrefixes() {
+    // Literal keys longer than the prefix that is checked, and keys that
+    // run past the end of the incremental input.
+    expect(u"abcdef > X; abce > Y; a > z;", u"abcdefabceabcd", u"XYzbcd");
+    // First sets, after ante context, and with a supplementary code point.
+    expect(u"[a-c] x > Q; [b] > B; q { [a-c] > R;", u"axbxcbqc", u"QQcBqR");
+    expect(u"\\U0001F600 > smile; [\\U0001F600-\\U0001F601] > face;",
+           u"\U0001F600\U0001F601", u"smileface");
+    // A first set with strings, and a first set inside a segment.
+    expect(u"[{ab}c] x > S; ([a-c]) y > '<' $1 '>';", u"abxcxby", u"SS<b>");
+
+    // Clones use copies of the sets in the rule data.
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError parseError;
+    LocalPointer<Transliterator> t(Transliterator::createFromRules(
+        u"<ID>", u"[a-c] x > Q; [b] > B;", UTRANS_FORWARD, parseError, status));
+    if (U_FAILURE(status)) {
+        reportParseError(u"Couldn't create transliterator", parseError, status);
+        return;
+    }
+    LocalPointer<Transliterator> clone(t->clone());
+    t.adoptInstead(nullptr);
+    expect(*clone, u"axbxcb", u"QQcB");
+}
+
+/**
+ * Transliterating a source string and appending the result to another
+ * string must give the same result as transliterating a copy in place.
+ */
+void TransliteratorTest::TestTransliterateToString() {
+    static const char16_t* const IDS[] = {
+        u"Latin-ASCII",
+        u"Any-Latin",
+        u"Latin-Katakana",
+        u"Thai-Latin",
+        u"Any-Title",
+        u"Hex-Any",
+        u"[a-z] Upper",
+        u"NFD; [:Nonspacing Mark:] Remove; NFC",
+    };
+    const UnicodeString sample(
+        u"Ærøskøbing Straße, Ελλάδα Москва カタカナ konnichiwa "
+        u"ภาษาไทย \\u0041\\U0001F600 \U0001F600 ");
+    UnicodeString longSample;
+    for (int32_t i = 0; i < 200; ++i) {
+        longSample.append(sample);
+    }
+    const UnicodeString* const sources[] = { &sample, &longSample };
+
+    for (const char16_t* id : IDS) {
+        UErrorCode status = U_ZERO_ERROR;
+        LocalPointer<Transliterator> t(Transliterator::createInstance(UnicodeString(id), UTRANS_FORWARD, status));
+        if (U_FAILURE(status)) {
+            dataerrln(UnicodeString(u"FAIL: createInstance(") + id + u") - " + u_errorName(status));
+            continue;
+        }
+        for (const UnicodeString* source : sources) {
+            UnicodeString expected(*source);
+            t->transliterate(expected);
+
+            UnicodeString result(u"prefix ");
+            t->transliterate(source->getBuffer(), source->length(), result, status);
+            if (assertSuccess(UnicodeString(u"transliterate() to string: ") + id, status)) {
+                assertEquals(UnicodeString(u"transliterate() to string: ") + id,
+                             UnicodeString(u"prefix ") + expected, result);
+            }
+        }
+    }
+
+    // NUL-terminated source, aliasing the destination, and errors.
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<Transliterator> t(Transliterator::createInstance(UnicodeString(u"Any-Upper"), UTRANS_FORWARD, status));
+    if (U_FAILURE(status)) {
+        dataerrln(UnicodeString(u"FAIL: createInstance(Any-Upper) - ") + u_errorName(status));
+        return;
+    }
+    UnicodeString result(u"abc");
+    t->transliterate(result.getTerminatedBuffer(), -1, result, status);
+    assertSuccess("transliterate() from NUL-terminated alias", status);
+    assertEquals("transliterate() from NUL-terminated alias", UnicodeString(u"abcABC"), result);
+    t->transliterate(nullptr, 0, result, status);
+    assertEquals("transliterate() from empty string", UnicodeString(u"abcABC"), result);
+    t->transliterate(nullptr, 1, result, status);
+    assertEquals("transliterate(nullptr, 1)", U_ILLEGAL_ARGUMENT_ERROR, status);
+    assertEquals("transliterate(nullptr, 1)", UnicodeString(u"abcABC"), result);
+}
+
 /**
  * Test we can create basic transliterator even without data.
  */
@@ -370,6 +370,10 @@ class TransliteratorTest : public IntlTest {
     void TestRegisterAlias();
 
     void TestBasicTransliteratorEvenWithoutData();
+
+    void TestRuleKeyPrefixes();
+
+    void TestTransliterateToString();
     //======================================================================
     // Support methods
     //======================================================================
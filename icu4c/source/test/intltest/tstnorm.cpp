@@ -6,11 +6,14 @@
  * others. All Rights Reserved.
  ********************************************************************/
 
+#include <string>
+
 #include "unicode/utypes.h"
 
 #if !UCONFIG_NO_NORMALIZATION
 
 #include "unicode/uchar.h"
+#include "unicode/edits.h"
 #include "unicode/errorcode.h"
 #include "unicode/normlzr.h"
 #include "unicode/stringoptions.h"
@@ -63,6 +66,8 @@ void BasicNormalizerTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestComposeJamoTBase);
     TESTCASE_AUTO(TestComposeBoundaryAfter);
     TESTCASE_AUTO(TestNFKC_SCF);
+    TESTCASE_AUTO(TestLongRunsBelowMinimum);
+    TESTCASE_AUTO(TestUTF8Stream);
     TESTCASE_AUTO_END;
 }
 
@@ -1892,4 +1897,108 @@ BasicNormalizerTest::TestNFKC_SCF() {
     assertEquals("nfkc_scf", expected, result);
 }
 
+void
+BasicNormalizerTest::TestLongRunsBelowMinimum() {
+    // The normalizer skips whole blocks of text below its minimum "no/maybe" code point.
+    // Put a character that needs work at every position of a long such run.
+    IcuTestErrorCode errorCode(*this, "TestLongRunsBelowMinimum");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFC/NFDInstance() call failed")) {
+        return;
+    }
+    struct {
+        const Normalizer2 *norm2;
+        const char *name;
+        UnicodeString base, input, output;
+    } cases[] = {
+        { nfc, "nfc", u"Da droben auf jenem Berge, da steht ein altes Schloß, wo hinter Toren und Türen ",
+          u"A\u030A", u"\u00C5" },
+        { nfd, "nfd", u"Da droben auf jenem Berge, da steht ein altes Schloss, wo hinter Toren und Tueren ",
+          u"\u00C5", u"A\u030A" }
+    };
+    for(auto &c : cases) {
+        int32_t length = c.base.length();
+        for(int32_t i = 0; i <= length; ++i) {
+            UnicodeString prefix = c.base.tempSubString(0, i);
+            UnicodeString suffix = c.base.tempSubString(i);
+            UnicodeString s = UnicodeString(prefix).append(c.input).append(suffix);
+            UnicodeString expected = UnicodeString(prefix).append(c.output).append(suffix);
+            std::string prefix8, s8, expected8, result8;
+            prefix.toUTF8String(prefix8);
+            s.toUTF8String(s8);
+            expected.toUTF8String(expected8);
+            std::string msg = std::string(c.name) + " at " + std::to_string(i);
+            const char *name = msg.c_str();
+
+            assertTrue(name, c.norm2->isNormalized(prefix, errorCode));
+            assertTrue(name, c.norm2->isNormalizedUTF8(prefix8, errorCode));
+            assertFalse(name, c.norm2->isNormalized(s, errorCode));
+            assertEquals(name, i, c.norm2->spanQuickCheckYes(s, errorCode));
+            assertEquals(name, expected, c.norm2->normalize(s, errorCode));
+            assertFalse(name, c.norm2->isNormalizedUTF8(s8, errorCode));
+            StringByteSink<std::string> sink(&result8);
+            c.norm2->normalizeUTF8(0, s8, sink, nullptr, errorCode);
+            assertEquals(name, expected8.c_str(), result8.c_str());
+            // NUL-terminated input takes a different path for the initial run.
+            assertEquals(name, expected,
+                         c.norm2->normalize(UnicodeString(true, s.getTerminatedBuffer(), -1), errorCode));
+        }
+    }
+}
+
+void
+BasicNormalizerTest::TestUTF8Stream() {
+    // Chunks of every small size split code points and combining sequences;
+    // the stream must write the same text and Edits as one normalizeUTF8() call.
+    IcuTestErrorCode errorCode(*this, "TestUTF8Stream");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFC/NFD/NFKC_CFInstance() call failed")) {
+        return;
+    }
+    UnicodeString set(u"[^\u00E4]");
+    UnicodeSet filter(set, errorCode);
+    FilteredNormalizer2 fn2(*nfc, filter);
+    struct {
+        const Normalizer2 *norm2;
+        const char *name;
+    } cases[] = {
+        { nfc, "nfc" }, { nfd, "nfd" }, { nfkc_cf, "nfkc_cf" }, { &fn2, "filtered" }
+    };
+    // Combining sequences, Hangul, a long run of combining marks,
+    // and ill-formed UTF-8 including a truncated sequence at the end.
+    std::string src = "Abc A\xCC\x8A\xCC\xA3 Schlo\xC3\x9F \xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8 "
+        "a\xCC\x81\xCC\x82\xCC\x83\xCC\x84\xCC\x85\xCC\x86\xCC\x87\xCC\x88\xCC\xA3 "
+        "\xEF\xAC\x81 x\xE4\xB8y \x80\xBF\xC3 \xC3\xA4\xCC\xA3 \xF0\x9D\x85\x9E\xE2\x84\xAB\xE4";
+    for(auto &c : cases) {
+        for(uint32_t options : { static_cast<uint32_t>(0), static_cast<uint32_t>(U_OMIT_UNCHANGED_TEXT) }) {
+            std::string expected;
+            StringByteSink<std::string> expectedSink(&expected);
+            Edits expectedEdits;
+            c.norm2->normalizeUTF8(options, src, expectedSink, &expectedEdits, errorCode);
+            for(int32_t chunkLength = 1; chunkLength <= 16; ++chunkLength) {
+                std::string msg = std::string(c.name) + " options " + std::to_string(options) +
+                    " chunks of " + std::to_string(chunkLength);
+                const char *name = msg.c_str();
+                std::string result;
+                StringByteSink<std::string> sink(&result);
+                Edits edits;
+                edits.addReplace(1, 2);  // reset by the constructor
+                Normalizer2UTF8Stream stream(*c.norm2, sink, options, &edits, errorCode);
+                for(size_t start = 0; start < src.length(); start += chunkLength) {
+                    stream.append(StringPiece(src).substr(static_cast<int32_t>(start), chunkLength),
+                                  errorCode);
+                }
+                stream.finish(errorCode);
+                assertSuccess(name, errorCode.get());
+                assertEquals(name, expected.c_str(), result.c_str());
+                assertEquals(name, expectedEdits.lengthDelta(), edits.lengthDelta());
+                assertEquals(name, expectedEdits.hasChanges(), edits.hasChanges());
+            }
+        }
+    }
+}
+
 #endif /* #if !UCONFIG_NO_NORMALIZATION */
@@ -55,6 +55,8 @@ class BasicNormalizerTest : public IntlTest {
     void TestComposeJamoTBase();
     void TestComposeBoundaryAfter();
     void TestNFKC_SCF();
+    void TestLongRunsBelowMinimum();
+    void TestUTF8Stream();
 
 private:
     UnicodeString canonTests[24][3];
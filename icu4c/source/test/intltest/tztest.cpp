@@ -11,7 +11,10 @@
 #if !UCONFIG_NO_FORMATTING
 
 #include "unicode/timezone.h"
+#include "unicode/basictz.h"
 #include "unicode/simpletz.h"
+#include "unicode/tzrule.h"
+#include "unicode/tztrans.h"
 #include "unicode/calendar.h"
 #include "unicode/gregocal.h"
 #include "unicode/localpointer.h"
@@ -81,6 +84,7 @@ void TimeZoneTest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestRawOffsetAndOffsetConsistency22041);
     TESTCASE_AUTO(TestGetIanaID);
     TESTCASE_AUTO(TestGMTMinus24ICU22526);
+    TESTCASE_AUTO(TestOffsetsAroundTransitions);
     TESTCASE_AUTO_END;
 }
 
@@ -2708,4 +2712,76 @@ void TimeZoneTest::TestGMTMinus24ICU22526() {
     gc.setTime(123456789, status);
     gc.get(UCAL_MONTH, status);
 }
+
+void TimeZoneTest::TestOffsetsAroundTransitions() {
+    // OlsonTimeZone remembers the transition interval of the last UTC time;
+    // look up the times in several orders so that the remembered interval
+    // is sometimes right, sometimes just before or after, and sometimes far away.
+    static const char* const zones[] = {
+        "America/New_York", "Europe/London", "Australia/Sydney", "Asia/Kolkata", "America/Sao_Paulo"
+    };
+    static const UDate limit = 1262304000000.0;  // 2010-01-01
+    for (const char* id : zones) {
+        LocalPointer<BasicTimeZone> zone(dynamic_cast<BasicTimeZone*>(TimeZone::createTimeZone(id)));
+        if (!zone.isValid() || *zone == TimeZone::getUnknown()) {
+            dataerrln("Unable to create time zone %s", id);
+            continue;
+        }
+        // Times just before, at, and in the middle after each transition, with the expected offsets.
+        struct Sample {
+            UDate time;
+            int32_t raw;
+            int32_t dst;
+        };
+        Sample samples[600];
+        int32_t count = 0;
+        TimeZoneTransition tzt;
+        UDate time = -4102444800000.0;  // 1840-01-01
+        while (count + 3 <= UPRV_LENGTHOF(samples) &&
+                zone->getNextTransition(time, false, tzt) && tzt.getTime() < limit) {
+            const TimeZoneRule* from = tzt.getFrom();
+            const TimeZoneRule* to = tzt.getTo();
+            UDate next = limit;
+            TimeZoneTransition nextTzt;
+            if (zone->getNextTransition(tzt.getTime(), false, nextTzt) && nextTzt.getTime() < limit) {
+                next = nextTzt.getTime();
+            }
+            samples[count++] = {tzt.getTime() - 1, from->getRawOffset(), from->getDSTSavings()};
+            samples[count++] = {tzt.getTime(), to->getRawOffset(), to->getDSTSavings()};
+            samples[count++] = {uprv_floor((tzt.getTime() + next) / 2), to->getRawOffset(), to->getDSTSavings()};
+            time = tzt.getTime();
+        }
+        if (count == 0) {
+            errln("No transitions in time zone %s", id);
+            continue;
+        }
+        for (int32_t order = 0; order < 3; ++order) {
+            for (int32_t i = 0; i < count; ++i) {
+                int32_t index;
+                switch (order) {
+                case 0: index = i; break;                            // forward
+                case 1: index = count - 1 - i; break;                // backward
+                default: index = static_cast<int32_t>((i * 7919LL) % count); break;  // scattered
+                }
+                const Sample& sample = samples[index];
+                UErrorCode status = U_ZERO_ERROR;
+                int32_t raw, dst;
+                zone->getOffset(sample.time, false, raw, dst, status);
+                if (U_FAILURE(status) || raw != sample.raw || dst != sample.dst) {
+                    errln("%s getOffset(%.0f, false) = %d, %d (%s), expected %d, %d (order %d)",
+                          id, sample.time, raw, dst, u_errorName(status), sample.raw, sample.dst, order);
+                }
+                if (index % 3 == 2) {
+                    // In the middle of a transition interval, the local time is unambiguous.
+                    zone->getOffset(sample.time + sample.raw + sample.dst, true, raw, dst, status);
+                    if (U_FAILURE(status) || raw != sample.raw || dst != sample.dst) {
+                        errln("%s getOffset(%.0f, true) = %d, %d (%s), expected %d, %d",
+                              id, sample.time + sample.raw + sample.dst, raw, dst,
+                              u_errorName(status), sample.raw, sample.dst);
+                    }
+                }
+            }
+        }
+    }
+}
 #endif /* #if !UCONFIG_NO_FORMATTING */
@@ -60,6 +60,10 @@ UPerfFunction* DateFormatPerfTest::runIndexedTest(int32_t index, UBool exec,cons
         TESTCASE(22,DateFmtCopy10000);
         TESTCASE(23,DateFmtCreate250);
         TESTCASE(24,DateFmtCreate10000);
+        TESTCASE(25,DateFmtISO10000);
+        TESTCASE(26,DateFmtMedium10000);
+        TESTCASE(27,DateParseISO10000);
+        TESTCASE(28,DateParseMedium10000);
 
 
         default: 
@@ -176,6 +180,22 @@ UPerfFunction* DateFormatPerfTest::DateFmtCopy10000(){
     return new DateFmtCopyFunction(10000, locale);
 }
 
+UPerfFunction* DateFormatPerfTest::DateFmtISO10000(){
+    return new DateFmtPatternFunction(10000, locale, u"yyyy-MM-dd'T'HH:mm:ss.SSS");
+}
+
+UPerfFunction* DateFormatPerfTest::DateFmtMedium10000(){
+    return new DateFmtPatternFunction(10000, locale, nullptr);
+}
+
+UPerfFunction* DateFormatPerfTest::DateParseISO10000(){
+    return new DateParsePatternFunction(10000, locale, u"yyyy-MM-dd'T'HH:mm:ss.SSS");
+}
+
+UPerfFunction* DateFormatPerfTest::DateParseMedium10000(){
+    return new DateParsePatternFunction(10000, locale, nullptr);
+}
+
 UPerfFunction* DateFormatPerfTest::DateFmtCreate250(){
     return new DateFmtCreateFunction(250, locale);
 }
@@ -21,6 +21,7 @@
 #include "unicode/dtitvfmt.h"
 #include "unicode/utypes.h"
 #include "unicode/datefmt.h"
+#include "unicode/smpdtfmt.h"
 #include "unicode/calendar.h"
 #include "unicode/uclean.h"
 #include "unicode/brkiter.h"
@@ -316,6 +317,106 @@ class DateFmtCopyFunction : public UPerfFunction
 
 };
 
+class DateFmtPatternFunction : public UPerfFunction
+{
+
+private:
+        int num;
+        char locale[25];
+        const char16_t* pattern;
+public:
+
+        // Formats num dates in GMT with the pattern,
+        // or with the medium date and time style if the pattern is nullptr.
+        DateFmtPatternFunction(int a, const char* loc, const char16_t* pat)
+        {
+                num = a;
+                strcpy(locale, loc);
+                pattern = pat;
+        }
+
+        void call(UErrorCode* status) override
+        {
+                Locale loc(locale);
+                LocalPointer<DateFormat> fmt;
+                if (pattern != nullptr) {
+                    fmt.adoptInsteadAndCheckErrorCode(new SimpleDateFormat(pattern, loc, *status), *status);
+                } else {
+                    fmt.adoptInstead(DateFormat::createDateTimeInstance(
+                            DateFormat::kMedium, DateFormat::kMedium, loc));
+                }
+                if (U_FAILURE(*status) || fmt.isNull()) {
+                        printf("ERROR: %s (DateFormat creation)\n", u_errorName(*status));
+                        exit(1);
+                }
+                fmt->adoptTimeZone(TimeZone::createTimeZone("GMT"));
+                UnicodeString str;
+                // Step through about 25 years by a little over one day.
+                UDate date = 1000000000000.0;
+                for(int j = 0; j < num; j++) {
+                    str.remove();
+                    fmt->format(date, str);
+                    date += 90061001.0;
+                }
+        }
+
+        long getOperationsPerIteration() override
+        {
+                return num;
+        }
+
+};
+
+class DateParsePatternFunction : public UPerfFunction
+{
+
+private:
+        int num;
+        LocalPointer<DateFormat> fmt;
+        LocalArray<UnicodeString> strings;
+public:
+
+        // Parses num dates in GMT with the pattern,
+        // or with the medium date and time style if the pattern is nullptr.
+        // The dates are formatted with the same DateFormat before the test.
+        DateParsePatternFunction(int a, const char* loc, const char16_t* pat)
+        {
+                num = a;
+                UErrorCode status = U_ZERO_ERROR;
+                if (pat != nullptr) {
+                    fmt.adoptInsteadAndCheckErrorCode(new SimpleDateFormat(pat, Locale(loc), status), status);
+                } else {
+                    fmt.adoptInstead(DateFormat::createDateTimeInstance(
+                            DateFormat::kMedium, DateFormat::kMedium, Locale(loc)));
+                }
+                if (U_FAILURE(status) || fmt.isNull()) {
+                        printf("ERROR: %s (DateFormat creation)\n", u_errorName(status));
+                        exit(1);
+                }
+                fmt->adoptTimeZone(TimeZone::createTimeZone("GMT"));
+                strings.adoptInstead(new UnicodeString[num]);
+                // Step through about 25 years by a little over one day.
+                UDate date = 1000000000000.0;
+                for(int j = 0; j < num; j++) {
+                    fmt->format(date, strings[j]);
+                    date += 90061001.0;
+                }
+        }
+
+        void call(UErrorCode* status) override
+        {
+                for(int j = 0; j < num; j++) {
+                    fmt->parse(strings[j], *status);
+                }
+        }
+
+        long getOperationsPerIteration() override
+        {
+                return num;
+        }
+
+};
+
 class DIFCreateFunction : public UPerfFunction
 {
 
@@ -824,6 +925,10 @@ class DateFormatPerfTest : public UPerfTest
 	UPerfFunction* DateFmtCreate10000();
 	UPerfFunction* DateFmtCopy250();
 	UPerfFunction* DateFmtCopy10000();
+	UPerfFunction* DateFmtISO10000();
+	UPerfFunction* DateFmtMedium10000();
+	UPerfFunction* DateParseISO10000();
+	UPerfFunction* DateParseMedium10000();
 	UPerfFunction* BreakItWord250();
 	UPerfFunction* BreakItWord10000();
 	UPerfFunction* BreakItChar250();
@@ -72,6 +72,10 @@
 
     "ucol_getSortKey/len",          ["$p1,TestGetSortKey", "$p2,TestGetSortKey"],
     "ucol_getSortKey/null",         ["$p1,TestGetSortKeyNull", "$p2,TestGetSortKeyNull"],
+    "ucol_getSortKeys/len",         ["$p1,TestGetSortKeys", "$p2,TestGetSortKeys"],
+    "ucol_getSortKeys/null",        ["$p1,TestGetSortKeysNull", "$p2,TestGetSortKeysNull"],
+    "ucol_getSortKeyPrefixes/8",    ["$p1,TestGetSortKeyPrefixes8", "$p2,TestGetSortKeyPrefixes8"],
+    "ucol_getSortKeyPrefixes/16",   ["$p1,TestGetSortKeyPrefixes16", "$p2,TestGetSortKeyPrefixes16"],
 
     "ucol_nextSortKeyPart/4_all",   ["$p1,TestNextSortKeyPart_4All", "$p2,TestNextSortKeyPart_4All"],
     "ucol_nextSortKeyPart/4x4",     ["$p1,TestNextSortKeyPart_4x4", "$p2,TestNextSortKeyPart_4x4"],
@@ -99,6 +103,10 @@
     "sort UnicodeString*[]: compare()",         ["$p1,TestUniStrSort", "$p2,TestUniStrSort"],
     "sort StringPiece[]: compareUTF8()",        ["$p1,TestStringPieceSortCpp", "$p2,TestStringPieceSortCpp"],
     "sort StringPiece[]: ucol_strcollUTF8()",   ["$p1,TestStringPieceSortC", "$p2,TestStringPieceSortC"],
+    "ucol_sortStrings/1 thread",                ["$p1,TestSortStrings1Thread", "$p2,TestSortStrings1Thread"],
+    "ucol_sortStrings/2 threads",               ["$p1,TestSortStrings2Threads", "$p2,TestSortStrings2Threads"],
+    "ucol_sortStrings/4 threads",               ["$p1,TestSortStrings4Threads", "$p2,TestSortStrings4Threads"],
+    "ucol_sortStrings/8 threads",               ["$p1,TestSortStrings8Threads", "$p2,TestSortStrings8Threads"],
 
     "binary search UnicodeString*[]: compare()",        ["$p1,TestUniStrBinSearch", "$p2,TestUniStrBinSearch"],
     "binary search StringPiece[]: compareUTF8()",       ["$p1,TestStringPieceBinSearchCpp", "$p2,TestStringPieceBinSearchCpp"],
@@ -327,6 +327,182 @@ long GetSortKey::getOperationsPerIteration()
     return source->count;
 }
 
+//
+// Test case taking a single test data array, calling ucol_getSortKeys once
+// for all of the strings
+//
+class GetSortKeys : public UPerfFunction
+{
+public:
+    GetSortKeys(const UCollator* coll, const CA_uchar* source, UBool useLen);
+    ~GetSortKeys();
+    void call(UErrorCode* status) override;
+    long getOperationsPerIteration() override;
+
+private:
+    const UCollator *coll;
+    const CA_uchar *source;
+    const char16_t **sources;
+    int32_t *lengths;
+    int32_t *offsets;
+    uint8_t *keys;
+    int32_t keysCapacity;
+};
+
+GetSortKeys::GetSortKeys(const UCollator* coll, const CA_uchar* source, UBool useLen)
+    :   coll(coll),
+        source(source),
+        sources(nullptr),
+        lengths(nullptr),
+        offsets(nullptr),
+        keys(nullptr),
+        keysCapacity(0)
+{
+    sources = new const char16_t *[source->count];
+    offsets = new int32_t[source->count + 1];
+    if (useLen) {
+        lengths = new int32_t[source->count];
+    }
+    for (int32_t i = 0; i < source->count; i++) {
+        sources[i] = source->dataOf(i);
+        if (useLen) {
+            lengths[i] = source->lengthOf(i);
+        }
+    }
+    // Size the key buffer up front so that the timed calls do not preflight.
+    UErrorCode status = U_ZERO_ERROR;
+    keysCapacity = ucol_getSortKeys(coll, sources, lengths, source->count, nullptr, 0, offsets, &status);
+    keys = new uint8_t[keysCapacity > 0 ? keysCapacity : 1];
+}
+
+GetSortKeys::~GetSortKeys()
+{
+    delete[] sources;
+    delete[] lengths;
+    delete[] offsets;
+    delete[] keys;
+}
+
+void GetSortKeys::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    ucol_getSortKeys(coll, sources, lengths, source->count, keys, keysCapacity, offsets, status);
+}
+
+long GetSortKeys::getOperationsPerIteration()
+{
+    return source->count;
+}
+
+//
+// Test case taking a single test data array in UTF-16, calling ucol_getSortKeyPrefixes
+// for all of the strings with the given prefix length
+//
+class GetSortKeyPrefixes : public UPerfFunction
+{
+public:
+    GetSortKeyPrefixes(const UCollator* coll, const CA_uchar* source, int32_t prefixLength);
+    ~GetSortKeyPrefixes();
+    void call(UErrorCode* status) override;
+    long getOperationsPerIteration() override;
+
+private:
+    const UCollator *coll;
+    const CA_uchar *source;
+    int32_t prefixLength;
+    const char16_t **sources;
+    int32_t *lengths;
+    uint8_t *prefixes;
+};
+
+GetSortKeyPrefixes::GetSortKeyPrefixes(const UCollator* coll, const CA_uchar* source, int32_t prefixLength)
+    :   coll(coll),
+        source(source),
+        prefixLength(prefixLength),
+        sources(new const char16_t *[source->count]),
+        lengths(new int32_t[source->count]),
+        prefixes(new uint8_t[source->count * prefixLength])
+{
+    for (int32_t i = 0; i < source->count; i++) {
+        sources[i] = source->dataOf(i);
+        lengths[i] = source->lengthOf(i);
+    }
+}
+
+GetSortKeyPrefixes::~GetSortKeyPrefixes()
+{
+    delete[] sources;
+    delete[] lengths;
+    delete[] prefixes;
+}
+
+void GetSortKeyPrefixes::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    ucol_getSortKeyPrefixes(coll, sources, lengths, source->count, prefixes, prefixLength, status);
+}
+
+long GetSortKeyPrefixes::getOperationsPerIteration()
+{
+    return source->count;
+}
+
+//
+// Test case sorting a single test data array in UTF-16 with ucol_sortStrings,
+// using up to the given number of threads
+//
+class SortStrings : public UPerfFunction
+{
+public:
+    SortStrings(const UCollator* coll, const CA_uchar* source, int32_t threadCount);
+    ~SortStrings();
+    void call(UErrorCode* status) override;
+    long getOperationsPerIteration() override;
+
+private:
+    const UCollator *coll;
+    const CA_uchar *source;
+    int32_t threadCount;
+    const char16_t **sources;
+    int32_t *lengths;
+    int32_t *indexes;
+};
+
+SortStrings::SortStrings(const UCollator* coll, const CA_uchar* source, int32_t threadCount)
+    :   coll(coll),
+        source(source),
+        threadCount(threadCount),
+        sources(new const char16_t *[source->count]),
+        lengths(new int32_t[source->count]),
+        indexes(new int32_t[source->count])
+{
+    for (int32_t i = 0; i < source->count; i++) {
+        sources[i] = source->dataOf(i);
+        lengths[i] = source->lengthOf(i);
+    }
+}
+
+SortStrings::~SortStrings()
+{
+    delete[] sources;
+    delete[] lengths;
+    delete[] indexes;
+}
+
+void SortStrings::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    ucol_sortStrings(coll, sources, lengths, source->count, indexes, threadCount, status);
+}
+
+long SortStrings::getOperationsPerIteration()
+{
+    return source->count;
+}
+
 //
 // Test case taking a single test data array in UTF-16, calling ucol_nextSortKeyPart for each for the
 // given buffer size
@@ -1092,6 +1268,10 @@ class CollPerf2Test : public UPerfTest
 
     UPerfFunction* TestGetSortKey();
     UPerfFunction* TestGetSortKeyNull();
+    UPerfFunction* TestGetSortKeys();
+    UPerfFunction* TestGetSortKeysNull();
+    UPerfFunction* TestGetSortKeyPrefixes8();
+    UPerfFunction* TestGetSortKeyPrefixes16();
 
     UPerfFunction* TestNextSortKeyPart_4All();
     UPerfFunction* TestNextSortKeyPart_4x2();
@@ -1121,6 +1301,10 @@ class CollPerf2Test : public UPerfTest
     UPerfFunction* TestUniStrSort();
     UPerfFunction* TestStringPieceSortCpp();
     UPerfFunction* TestStringPieceSortC();
+    UPerfFunction* TestSortStrings1Thread();
+    UPerfFunction* TestSortStrings2Threads();
+    UPerfFunction* TestSortStrings4Threads();
+    UPerfFunction* TestSortStrings8Threads();
 
     UPerfFunction* TestUniStrBinSearch();
     UPerfFunction* TestStringPieceBinSearchCpp();
@@ -1401,6 +1585,10 @@ CollPerf2Test::runIndexedTest(int32_t index, UBool exec, const char *&name, char
 
     TESTCASE_AUTO(TestGetSortKey);
     TESTCASE_AUTO(TestGetSortKeyNull);
+    TESTCASE_AUTO(TestGetSortKeys);
+    TESTCASE_AUTO(TestGetSortKeysNull);
+    TESTCASE_AUTO(TestGetSortKeyPrefixes8);
+    TESTCASE_AUTO(TestGetSortKeyPrefixes16);
 
     TESTCASE_AUTO(TestNextSortKeyPart_4All);
     TESTCASE_AUTO(TestNextSortKeyPart_4x4);
@@ -1428,6 +1616,10 @@ CollPerf2Test::runIndexedTest(int32_t index, UBool exec, const char *&name, char
     TESTCASE_AUTO(TestUniStrSort);
     TESTCASE_AUTO(TestStringPieceSortCpp);
     TESTCASE_AUTO(TestStringPieceSortC);
+    TESTCASE_AUTO(TestSortStrings1Thread);
+    TESTCASE_AUTO(TestSortStrings2Threads);
+    TESTCASE_AUTO(TestSortStrings4Threads);
+    TESTCASE_AUTO(TestSortStrings8Threads);
 
     TESTCASE_AUTO(TestUniStrBinSearch);
     TESTCASE_AUTO(TestStringPieceBinSearchCpp);
@@ -1527,6 +1719,46 @@ UPerfFunction* CollPerf2Test::TestGetSortKeyNull()
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestGetSortKeys()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *data = getData16(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return new GetSortKeys(coll, data, true /* useLen */);
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeysNull()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *data = getData16(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return new GetSortKeys(coll, data, false /* useLen */);
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeyPrefixes8()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *data = getData16(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return new GetSortKeyPrefixes(coll, data, 8);
+}
+
+UPerfFunction* CollPerf2Test::TestGetSortKeyPrefixes16()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *data = getData16(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return new GetSortKeyPrefixes(coll, data, 16);
+}
+
 UPerfFunction* CollPerf2Test::TestNextSortKeyPart_4All()
 {
     UErrorCode status = U_ZERO_ERROR;
@@ -1755,6 +1987,42 @@ UPerfFunction* CollPerf2Test::TestStringPieceSortC() {
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestSortStrings1Thread() {
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *data = getRandomData16(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return new SortStrings(coll, data, 1);
+}
+
+UPerfFunction* CollPerf2Test::TestSortStrings2Threads() {
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *data = getRandomData16(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return new SortStrings(coll, data, 2);
+}
+
+UPerfFunction* CollPerf2Test::TestSortStrings4Threads() {
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *data = getRandomData16(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return new SortStrings(coll, data, 4);
+}
+
+UPerfFunction* CollPerf2Test::TestSortStrings8Threads() {
+    UErrorCode status = U_ZERO_ERROR;
+    const CA_uchar *data = getRandomData16(status);
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    return new SortStrings(coll, data, 8);
+}
+
 UPerfFunction* CollPerf2Test::TestUniStrBinSearch() {
     UErrorCode status = U_ZERO_ERROR;
     UPerfFunction *testCase = new UniStrBinSearch(*collObj, coll, getSortedData16(status));
@@ -50,6 +50,9 @@
     "ISO-8859-1 From Unicode",  ["$p1,TestICU_Latin1_FromUnicode",      "$p2,TestICU_Latin1_FromUnicode" ],
     "ISO-8859-1 To Unicode",    ["$p1,TestICU_Latin1_ToUnicode",        "$p2,TestICU_Latin1_ToUnicode" ],
     ####
+    "windows-1252 From Unicode", ["$p1,TestICU_Windows1252_FromUnicode", "$p2,TestICU_Windows1252_FromUnicode" ],
+    "windows-1252 To Unicode",  ["$p1,TestICU_Windows1252_ToUnicode",   "$p2,TestICU_Windows1252_ToUnicode" ],
+    ####
     "Shift-JIS From Unicode",   ["$p1,TestICU_SJIS_FromUnicode",        "$p2,TestICU_SJIS_FromUnicode" ],
     "Shift-JIS To Unicode",     ["$p1,TestICU_SJIS_ToUnicode",          "$p2,TestICU_SJIS_ToUnicode" ],
     ####
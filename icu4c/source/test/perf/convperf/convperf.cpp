@@ -116,6 +116,9 @@ UPerfFunction* ConverterPerformanceTest::runIndexedTest(int32_t index, UBool exe
         TESTCASE(52,TestWinANSI_ISO2022JP_ToUnicode);
         TESTCASE(53,TestWinANSI_ISO2022JP_FromUnicode);
 
+        TESTCASE(54,TestICU_Windows1252_ToUnicode);
+        TESTCASE(55,TestICU_Windows1252_FromUnicode);
+
         default: 
             name = ""; 
             return nullptr;
@@ -657,3 +660,25 @@ UPerfFunction*  ConverterPerformanceTest::TestWinANSI_ISO2022JP_ToUnicode(){
     }
     return pf;
 }
+
+//#################
+
+// windows-1252 is a table-based (MBCS) single-byte converter, unlike the
+// algorithmic iso-8859-1 converter; the Latin-1 text is valid in both.
+UPerfFunction* ConverterPerformanceTest::TestICU_Windows1252_FromUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    ICUFromUnicodePerfFunction* pf = new ICUFromUnicodePerfFunction("windows-1252", (char16_t *)latin1_uniSource, UPRV_LENGTHOF(latin1_uniSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
+
+UPerfFunction*  ConverterPerformanceTest::TestICU_Windows1252_ToUnicode(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUToUnicodePerfFunction("windows-1252",(char*)latin1_encSource, UPRV_LENGTHOF(latin1_encSource), status);
+    if(U_FAILURE(status)){
+        return nullptr;
+    }
+    return pf;
+}
@@ -566,6 +566,9 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinIML2_ISO2022JP_ToUnicode();
     UPerfFunction* TestWinIML2_ISO2022JP_FromUnicode(); 
 
+    UPerfFunction* TestICU_Windows1252_ToUnicode();
+    UPerfFunction* TestICU_Windows1252_FromUnicode();
+
 };
 
 #endif
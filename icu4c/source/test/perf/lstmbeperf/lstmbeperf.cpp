@@ -0,0 +1,178 @@
+/*
+***********************************************************************
+* © 2026 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*
+* Compares the throughput of the LSTM break engine with that of the
+* dictionary-based ThaiBreakEngine on Thai text.
+*
+* The LSTM models are not part of the default ICU data, so they are loaded
+* from the test data. Usage from within <ICU build tree>/test/perf/lstmbeperf/ :
+*  make
+*  export LD_LIBRARY_PATH=../../../lib:../../../stubdata:../../../tools/ctestfw
+*  ./lstmbeperf --sourcedir ../../testdata/out/testdata --passes 3 --iterations 20
+*
+* The dictionary test goes through a word BreakIterator for "th", which uses
+* ThaiBreakEngine unless the ICU data was built with LSTM models for Thai.
+*/
+
+#include <stdio.h>
+
+#include "unicode/brkiter.h"
+#include "unicode/localpointer.h"
+#include "unicode/unistr.h"
+#include "unicode/uperf.h"
+#include "unicode/ures.h"
+#include "unicode/utext.h"
+#include "brkeng.h"
+#include "lstmbe.h"
+#include "uvectr32.h"
+
+static const char16_t *THAI_SAMPLE =
+    u"ปฏิญญาสากลว่าด้วยสิทธิมนุษยชนคำปรารภโดยที่การยอมรับนับถือเกียรติศักดิ์ประจำตัว"
+    u"และสิทธิเท่าเทียมกันและโอนมิได้ของบรรดาสมาชิกทั้งหลายแห่งครอบครัวมนุษย์"
+    u"เป็นหลักมูลเหตุแห่งอิสรภาพความยุติธรรมและสันติภาพในโลก";
+
+static constexpr int32_t SAMPLE_REPEAT = 20;
+
+//
+// Finds the word breaks in the sample text with a word BreakIterator.
+//
+class DictionaryBreaks : public UPerfFunction {
+public:
+    DictionaryBreaks(const UnicodeString &text, UErrorCode &status) : text(text) {
+        iter.adoptInstead(BreakIterator::createWordInstance(Locale("th"), status));
+    }
+    void call(UErrorCode * /*status*/) override {
+        iter->setText(text);
+        int32_t count = 0;
+        while (iter->next() != BreakIterator::DONE) {
+            ++count;
+        }
+        breakCount = count;
+    }
+    long getOperationsPerIteration() override { return text.length(); }
+    long getEventsPerIteration() override { return breakCount; }
+private:
+    LocalPointer<BreakIterator> iter;
+    UnicodeString text;
+    int32_t breakCount = 0;
+};
+
+//
+// Finds the word breaks in the sample text with an LSTM break engine.
+//
+class LSTMBreaks : public UPerfFunction {
+public:
+    LSTMBreaks(const char *dataPath, const char *model, const UnicodeString &text,
+               UErrorCode &status) : text(text) {
+        UResourceBundle *rb = ures_openDirect(dataPath, model, &status);
+        const LSTMData *data = CreateLSTMData(rb, status);
+        if (U_FAILURE(status)) {
+            return;
+        }
+        engine.adoptInstead(CreateLSTMBreakEngine(USCRIPT_THAI, data, status));
+        if (engine.isNull()) {
+            DeleteLSTMData(data);
+        }
+    }
+    void call(UErrorCode *status) override {
+        UText ut = UTEXT_INITIALIZER;
+        utext_openConstUnicodeString(&ut, &text, status);
+        UVector32 breaks(*status);
+        engine->findBreaks(&ut, 0, text.length(), breaks, false, *status);
+        utext_close(&ut);
+        breakCount = breaks.size();
+    }
+    long getOperationsPerIteration() override { return text.length(); }
+    long getEventsPerIteration() override { return breakCount; }
+private:
+    LocalPointer<const LanguageBreakEngine> engine;
+    UnicodeString text;
+    int32_t breakCount = 0;
+};
+
+class LSTMBreakEnginePerfTest : public UPerfTest
+{
+public:
+    LSTMBreakEnginePerfTest(
+        int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "lstmbeperf", status)
+    {
+        for (int32_t i = 0; i < SAMPLE_REPEAT; ++i) {
+            text.append(THAI_SAMPLE);
+        }
+    }
+
+    ~LSTMBreakEnginePerfTest()
+    {
+    }
+    UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
+
+private:
+    UPerfFunction *createLSTM(const char *model) {
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction *func = new LSTMBreaks(sourceDir, model, text, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "LSTM model %s in %s: %s\n", model, sourceDir, u_errorName(status));
+            delete func;
+            return nullptr;
+        }
+        return func;
+    }
+
+    UPerfFunction* TestThaiDictionary() {
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction *func = new DictionaryBreaks(text, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Thai word BreakIterator: %s\n", u_errorName(status));
+            delete func;
+            return nullptr;
+        }
+        return func;
+    }
+    UPerfFunction* TestThaiLSTMGraphclust() {
+        return createLSTM("Thai_graphclust_model4_heavy");
+    }
+    UPerfFunction* TestThaiLSTMCodepoints() {
+        return createLSTM("Thai_codepoints_exclusive_model5_heavy");
+    }
+
+    UnicodeString text;
+};
+
+UPerfFunction*
+LSTMBreakEnginePerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestThaiDictionary);
+    TESTCASE_AUTO(TestThaiLSTMGraphclust);
+    TESTCASE_AUTO(TestThaiLSTMCodepoints);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    LSTMBreakEnginePerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
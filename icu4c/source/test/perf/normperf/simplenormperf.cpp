@@ -205,11 +205,13 @@ double measure(Operation &op, int32_t pieceLength) {
     for (;;) {
         double seconds = op.call(iterations, pieceLength);
         if (seconds >= 1) {
+            // Avoid int32_t overflow for fast operations on long pieces.
+            double numCodePoints = static_cast<double>(iterations) * pieceLength;
             if (iterations > 1) {
-                return seconds / (iterations * pieceLength);
+                return seconds / numCodePoints;
             } else {
                 // Run it once more, to avoid measuring only the warm-up.
-                return op.call(1, pieceLength) / (iterations * pieceLength);
+                return op.call(1, pieceLength) / numCodePoints;
             }
         }
         if (seconds < 0.01) {
@@ -294,12 +296,84 @@ double NormalizeUTF8::call(int32_t iterations, int32_t pieceLength) {
         int32_t start8 = offsets[start];
         int32_t limit8 = offsets[start + pieceLength];
         icu::StringPiece piece(s + start8, limit8 - start8);
+        dest.clear();
         norm2.normalizeUTF8(0, piece, sink, nullptr, errorCode);
         start = (start + pieceLength) % limit;
     }
     return utimer_getElapsedSeconds(&startTime);
 }
 
+class IsNormalizedUTF16 : public Operation {
+public:
+    IsNormalizedUTF16(const Normalizer2 &n2, const UnicodeString &text, bool span) :
+            norm2(n2), src(text), s(src.getBuffer()), spanQuickCheckYes(span) {}
+    virtual ~IsNormalizedUTF16();
+    double call(int32_t iterations, int32_t pieceLength) override;
+
+private:
+    const Normalizer2 &norm2;
+    UnicodeString src;
+    const char16_t *s;
+    bool spanQuickCheckYes;
+};
+
+IsNormalizedUTF16::~IsNormalizedUTF16() {}
+
+// Assumes all BMP characters.
+double IsNormalizedUTF16::call(int32_t iterations, int32_t pieceLength) {
+    int32_t start = 0;
+    int32_t limit = src.length() - pieceLength;
+    UnicodeString piece;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    utimer_getTime(&startTime);
+    for (int32_t i = 0; i < iterations; ++i) {
+        piece.setTo(false, s + start, pieceLength);
+        if (spanQuickCheckYes) {
+            norm2.spanQuickCheckYes(piece, errorCode);
+        } else {
+            norm2.isNormalized(piece, errorCode);
+        }
+        start = (start + pieceLength) % limit;
+    }
+    return utimer_getElapsedSeconds(&startTime);
+}
+
+class IsNormalizedUTF8 : public Operation {
+public:
+    IsNormalizedUTF8(const Normalizer2 &n2, const UnicodeString &text) : norm2(n2) {
+        offsets = CommonChars::toUTF8WithOffsets(text, src, numCodePoints);
+        s = src.data();
+    }
+    virtual ~IsNormalizedUTF8();
+    double call(int32_t iterations, int32_t pieceLength) override;
+
+private:
+    const Normalizer2 &norm2;
+    std::string src;
+    const char *s;
+    int32_t *offsets;
+    int32_t numCodePoints;
+};
+
+IsNormalizedUTF8::~IsNormalizedUTF8() {
+    delete[] offsets;
+}
+
+double IsNormalizedUTF8::call(int32_t iterations, int32_t pieceLength) {
+    int32_t start = 0;
+    int32_t limit = numCodePoints - pieceLength;
+    UErrorCode errorCode = U_ZERO_ERROR;
+    utimer_getTime(&startTime);
+    for (int32_t i = 0; i < iterations; ++i) {
+        int32_t start8 = offsets[start];
+        int32_t limit8 = offsets[start + pieceLength];
+        icu::StringPiece piece(s + start8, limit8 - start8);
+        norm2.isNormalizedUTF8(piece, errorCode);
+        start = (start + pieceLength) % limit;
+    }
+    return utimer_getElapsedSeconds(&startTime);
+}
+
 }  // namespace
 
 extern int main(int /*argc*/, const char * /*argv*/[]) {
@@ -324,6 +398,32 @@ extern int main(int /*argc*/, const char * /*argv*/[]) {
         NormalizeUTF8 op(*nfc, CommonChars::getJapanese(maxLength));
         benchmark("NFC/UTF-8/japanese", op);
     }
+    {
+        // Already-normalized text mostly below the NFC minimum "no/maybe" code point:
+        // Should be skipped in whole blocks.
+        IsNormalizedUTF16 op(*nfc, CommonChars::getLatin1(maxLength), false);
+        benchmark("NFC/UTF-16/latin1/isNormalized", op);
+    }
+    {
+        IsNormalizedUTF16 op(*nfc, CommonChars::getLatin1(maxLength), true);
+        benchmark("NFC/UTF-16/latin1/spanQuickCheckYes", op);
+    }
+    {
+        IsNormalizedUTF16 op(*nfc, CommonChars::getJapanese(maxLength), false);
+        benchmark("NFC/UTF-16/japanese/isNormalized", op);
+    }
+    {
+        NormalizeUTF8 op(*nfc, CommonChars::getLatin1(maxLength));
+        benchmark("NFC/UTF-8/latin1", op);
+    }
+    {
+        IsNormalizedUTF8 op(*nfc, CommonChars::getLatin1(maxLength));
+        benchmark("NFC/UTF-8/latin1/isNormalizedUTF8", op);
+    }
+    {
+        IsNormalizedUTF8 op(*nfc, CommonChars::getJapanese(maxLength));
+        benchmark("NFC/UTF-8/japanese/isNormalizedUTF8", op);
+    }
     {
         NormalizeUTF16 op(*nfkc_cf, CommonChars::getMixed(maxLength));
         benchmark("NFKC_CF/UTF-16/mixed", op);
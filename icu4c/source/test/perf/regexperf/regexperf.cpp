@@ -0,0 +1,201 @@
+/*
+***********************************************************************
+* © 2026 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*/
+
+// Compares finding which of many patterns occur in each line of a log
+// with one RegexSet against calling RegexMatcher::find() once per pattern,
+// and the automaton against the backtracking engine for a single pattern.
+
+#include <vector>
+
+#include "unicode/regex.h"
+#include "unicode/uperf.h"
+#include "cmemory.h"
+
+static const char16_t *const gPatterns[] = {
+    u"ERROR", u"WARN(ING)?", u"timeout after \\d+ ?ms", u"connection (reset|refused)",
+    u"^\\d{4}-\\d\\d-\\d\\d", u"user=[a-z]+\\d*", u"status=5\\d\\d", u"status=4\\d\\d",
+    u"GET /api/v\\d+/", u"POST /login", u"(?i)out of memory", u"retry(ing)? in \\d+s",
+    u"\\b(?:[0-9]{1,3}\\.){3}[0-9]{1,3}\\b", u"session [0-9a-f]{8}\\b", u"disk (full|quota)",
+    u"latency=[1-9]\\d{3,}ms", u"(?i)deadlock", u"NullPointerException", u"segfault", u"\\bOOM\\b",
+    u"cache (hit|miss)", u"shard-\\d+ unavailable", u"slow query", u"TLS handshake failed",
+    u"rate limit(ed)?", u"unauthori[sz]ed", u"\\.jpg\\b", u"checksum mismatch", u"panic:",
+    u"queue depth \\d{4,}", u"stack overflow", u"lost heartbeat",
+};
+static const int32_t gPatternCount = UPRV_LENGTHOF(gPatterns);
+
+static const char16_t *const gLineParts[] = {
+    u"2026-03-14 12:00:01 INFO ", u"2026-03-14 12:00:02 WARN ", u"2026-03-14 12:00:03 ERROR ",
+    u"GET /api/v2/items status=200 latency=12ms ", u"POST /login user=alice42 status=401 ",
+    u"client 10.1.2.3 session 0badcafe ", u"cache hit for key 123 ", u"connection reset by peer ",
+    u"retrying in 5s ", u"shard-7 unavailable ", u"request finished normally ",
+};
+static const int32_t gLinePartCount = UPRV_LENGTHOF(gLineParts);
+
+static const int32_t LINE_COUNT = 500;
+
+class RegexLogScan : public UPerfFunction {
+public:
+    RegexLogScan(int32_t patternCount, UBool useSet, UErrorCode &status) : fUseSet(useSet) {
+        for (int32_t i = 0; i < patternCount; ++i) {
+            fPatternStrings.emplace_back(gPatterns[i]);
+        }
+        fSet.adoptInstead(RegexSet::compile(fPatternStrings.data(), patternCount, 0, status));
+        if (U_FAILURE(status)) {
+            return;
+        }
+        for (int32_t i = 0; i < LINE_COUNT; ++i) {
+            UnicodeString line;
+            for (int32_t j = 0; j < 4; ++j) {
+                line.append(gLineParts[(i * 7 + j * 3) % gLinePartCount]);
+            }
+            fLines.push_back(line);
+            fChars += line.length();
+        }
+        for (int32_t i = 0; i < patternCount; ++i) {
+            fMatchers.emplace_back(fSet->getPattern(i)->matcher(status));
+        }
+    }
+    void call(UErrorCode *status) override {
+        int32_t found[UPRV_LENGTHOF(gPatterns)];
+        for (const UnicodeString &line : fLines) {
+            if (fUseSet) {
+                fSet->matches(line, found, UPRV_LENGTHOF(found), *status);
+            } else {
+                for (LocalPointer<RegexMatcher> &matcher : fMatchers) {
+                    matcher->reset(line);
+                    matcher->find(*status);
+                }
+            }
+        }
+    }
+    long getOperationsPerIteration() override {
+        return LINE_COUNT;
+    }
+    long getEventsPerIteration() override {
+        return fChars;
+    }
+private:
+    UBool fUseSet;
+    std::vector<UnicodeString> fPatternStrings;
+    LocalPointer<RegexSet> fSet;
+    std::vector<LocalPointer<RegexMatcher>> fMatchers;
+    std::vector<UnicodeString> fLines;
+    long fChars = 0;
+};
+
+// Finds all matches of a pattern that backtracks a lot on lines that almost match.
+// A time limit makes RegexMatcher use the backtracking engine.
+class RegexEngineScan : public UPerfFunction {
+public:
+    RegexEngineScan(UBool useAutomaton, UErrorCode &status) {
+        fMatcher.adoptInstead(new RegexMatcher(u"(\\w+\\h)+=\\d+;", 0, status));
+        if (U_FAILURE(status)) {
+            return;
+        }
+        if (!useAutomaton) {
+            fMatcher->setTimeLimit(INT32_MAX, status);
+        }
+        for (int32_t i = 0; i < LINE_COUNT; ++i) {
+            fText.append(gLineParts[i % gLinePartCount]).append(u"key value =42 x\n");
+        }
+    }
+    void call(UErrorCode *status) override {
+        fMatcher->reset(fText);
+        while (fMatcher->find(*status)) {
+        }
+    }
+    long getOperationsPerIteration() override {
+        return LINE_COUNT;
+    }
+    long getEventsPerIteration() override {
+        return fText.length();
+    }
+private:
+    LocalPointer<RegexMatcher> fMatcher;
+    UnicodeString fText;
+};
+
+class RegexPerfTest : public UPerfTest
+{
+public:
+    RegexPerfTest(
+        int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "regexperf", status)
+    {
+    }
+
+    ~RegexPerfTest()
+    {
+    }
+    UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
+
+private:
+    UPerfFunction* create(int32_t patternCount, UBool useSet) {
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction *func = new RegexLogScan(patternCount, useSet, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Setup failed: %s\n", u_errorName(status));
+            delete func;
+            return nullptr;
+        }
+        return func;
+    }
+    UPerfFunction* TestMatchers4() { return create(4, false); }
+    UPerfFunction* TestSet4() { return create(4, true); }
+    UPerfFunction* TestMatchers32() { return create(gPatternCount, false); }
+    UPerfFunction* TestSet32() { return create(gPatternCount, true); }
+    UPerfFunction* createEngineScan(UBool useAutomaton) {
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction *func = new RegexEngineScan(useAutomaton, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Setup failed: %s\n", u_errorName(status));
+            delete func;
+            return nullptr;
+        }
+        return func;
+    }
+    UPerfFunction* TestBacktracking() { return createEngineScan(false); }
+    UPerfFunction* TestAutomaton() { return createEngineScan(true); }
+};
+
+UPerfFunction*
+RegexPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestMatchers4);
+    TESTCASE_AUTO(TestSet4);
+    TESTCASE_AUTO(TestMatchers32);
+    TESTCASE_AUTO(TestSet32);
+    TESTCASE_AUTO(TestBacktracking);
+    TESTCASE_AUTO(TestAutomaton);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    RegexPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
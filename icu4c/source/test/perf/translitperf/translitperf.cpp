@@ -0,0 +1,139 @@
+/*
+***********************************************************************
+* © 2026 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*/
+
+#include <stdio.h>
+
+#include "unicode/translit.h"
+#include "unicode/unistr.h"
+#include "unicode/uperf.h"
+
+//
+// Transliterates the sample text with one transliterator, either in place
+// in a copy or into a new string.
+//
+class TransliterateText : public UPerfFunction {
+public:
+    TransliterateText(const char *id, const UnicodeString &sample, int32_t repeat, UBool toString,
+                      UErrorCode &status) : toString(toString) {
+        translit.adoptInstead(Transliterator::createInstance(UnicodeString(id, -1, US_INV),
+                                                              UTRANS_FORWARD, status));
+        for (int32_t i = 0; i < repeat; ++i) {
+            text.append(sample);
+        }
+    }
+    void call(UErrorCode *status) override {
+        if (toString) {
+            UnicodeString s;
+            translit->transliterate(text.getBuffer(), text.length(), s, *status);
+        } else {
+            UnicodeString s(text);
+            translit->transliterate(s);
+        }
+    }
+    long getOperationsPerIteration() override { return text.length(); }
+    long getEventsPerIteration() override { return text.length(); }
+private:
+    LocalPointer<Transliterator> translit;
+    UnicodeString text;
+    UBool toString;
+};
+
+static const char16_t *LATIN_SAMPLE =
+    u"Ærøskøbing, Þórshöfn, Łódź, Straße, façade, œuvre, naïve café. ";
+static const char16_t *MIXED_SAMPLE =
+    u"Ελλάδα Москва दिल्ली ประเทศไทย 東京 서울 القاهرة ירושלים ";
+
+class TransliteratorPerfTest : public UPerfTest
+{
+public:
+    TransliteratorPerfTest(
+        int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "translitperf", status)
+    {
+    }
+
+    ~TransliteratorPerfTest()
+    {
+    }
+    UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
+
+private:
+    UPerfFunction *create(const char *id, const char16_t *sample, UBool toString = false) {
+        UErrorCode status = U_ZERO_ERROR;
+        UPerfFunction *func = new TransliterateText(id, UnicodeString(sample), 100, toString, status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Transliterator %s: %s\n", id, u_errorName(status));
+            delete func;
+            return nullptr;
+        }
+        return func;
+    }
+
+    UPerfFunction* TestLatinASCII() {
+        return create("Latin-ASCII", LATIN_SAMPLE);
+    }
+    UPerfFunction* TestLatinASCIIToString() {
+        return create("Latin-ASCII", LATIN_SAMPLE, true);
+    }
+    UPerfFunction* TestGreekLatin() {
+        return create("Greek-Latin",
+                      u"Η Ελλάδα είναι χώρα της νοτιοανατολικής Ευρώπης με πλούσια ιστορία. ");
+    }
+    UPerfFunction* TestCyrillicLatin() {
+        return create("Cyrillic-Latin",
+                      u"Москва — столица России, крупнейший по численности населения город. ");
+    }
+    UPerfFunction* TestAnyLatin() {
+        return create("Any-Latin", MIXED_SAMPLE);
+    }
+    UPerfFunction* TestAnyLatinToString() {
+        return create("Any-Latin", MIXED_SAMPLE, true);
+    }
+    UPerfFunction* TestLatinKatakana() {
+        return create("Latin-Katakana",
+                      u"konnichiwa toukyou no sakura ha kirei desu. ");
+    }
+};
+
+UPerfFunction*
+TransliteratorPerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestLatinASCII);
+    TESTCASE_AUTO(TestLatinASCIIToString);
+    TESTCASE_AUTO(TestGreekLatin);
+    TESTCASE_AUTO(TestCyrillicLatin);
+    TESTCASE_AUTO(TestAnyLatin);
+    TESTCASE_AUTO(TestAnyLatinToString);
+    TESTCASE_AUTO(TestLatinKatakana);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    TransliteratorPerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
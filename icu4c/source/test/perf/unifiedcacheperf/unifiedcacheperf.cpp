@@ -0,0 +1,133 @@
+/*
+***********************************************************************
+* © 2026 and later: Unicode, Inc. and others.
+* License & terms of use: http://www.unicode.org/copyright.html
+***********************************************************************
+*/
+
+// Measures UnifiedCache lookup throughput when many threads fetch
+// cached objects concurrently. Every lookup is a cache hit: the objects
+// are created once in the constructor of the test function.
+
+#include <thread>
+#include <vector>
+
+#include "unicode/locid.h"
+#include "unicode/numfmt.h"
+#include "unicode/uperf.h"
+#include "sharednumberformat.h"
+
+static const char *const gLocales[] = {
+    "en", "en_US", "en_GB", "de", "de_CH", "fr", "fr_CA", "ja",
+    "zh", "zh_Hant", "ru", "ar", "hi", "es", "es_419", "pt_BR"
+};
+static const int32_t gLocaleCount = UPRV_LENGTHOF(gLocales);
+
+static const int32_t LOOKUPS_PER_THREAD = 2000;
+
+class CacheHitContention : public UPerfFunction {
+public:
+    CacheHitContention(int32_t threadCount) : fThreadCount(threadCount) {
+        for (int32_t i = 0; i < gLocaleCount; ++i) {
+            fLocales.emplace_back(gLocales[i]);
+        }
+        // Populate the cache so that the timed loop sees only hits.
+        UErrorCode status = U_ZERO_ERROR;
+        for (const Locale &loc : fLocales) {
+            const SharedNumberFormat *shared =
+                    NumberFormat::createSharedInstance(loc, UNUM_DECIMAL, status);
+            if (shared != nullptr) {
+                shared->removeRef();
+            }
+        }
+    }
+    ~CacheHitContention() { }
+    void call(UErrorCode *status) override {
+        std::vector<std::thread> threads;
+        for (int32_t t = 0; t < fThreadCount; ++t) {
+            threads.emplace_back(&CacheHitContention::lookups, this, t);
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        (void)status;
+    }
+    long getOperationsPerIteration() override {
+        return static_cast<long>(fThreadCount) * LOOKUPS_PER_THREAD;
+    }
+    long getEventsPerIteration() override {
+        return static_cast<long>(fThreadCount) * LOOKUPS_PER_THREAD;
+    }
+private:
+    void lookups(int32_t threadIndex) {
+        UErrorCode status = U_ZERO_ERROR;
+        for (int32_t i = 0; i < LOOKUPS_PER_THREAD; ++i) {
+            const Locale &loc = fLocales[(threadIndex + i) % gLocaleCount];
+            const SharedNumberFormat *shared =
+                    NumberFormat::createSharedInstance(loc, UNUM_DECIMAL, status);
+            if (shared != nullptr) {
+                shared->removeRef();
+            }
+        }
+    }
+
+    int32_t fThreadCount;
+    std::vector<Locale> fLocales;
+};
+
+class UnifiedCachePerfTest : public UPerfTest
+{
+public:
+    UnifiedCachePerfTest(
+        int32_t argc, const char *argv[], UErrorCode &status)
+            : UPerfTest(argc, argv, nullptr, 0, "unifiedcacheperf", status)
+    {
+    }
+
+    ~UnifiedCachePerfTest()
+    {
+    }
+    UPerfFunction* runIndexedTest(
+        int32_t index, UBool exec, const char*& name, char* par = nullptr) override;
+
+private:
+    UPerfFunction* TestCacheHit1Thread() { return new CacheHitContention(1); }
+    UPerfFunction* TestCacheHit4Threads() { return new CacheHitContention(4); }
+    UPerfFunction* TestCacheHit16Threads() { return new CacheHitContention(16); }
+    UPerfFunction* TestCacheHit64Threads() { return new CacheHitContention(64); }
+};
+
+UPerfFunction*
+UnifiedCachePerfTest::runIndexedTest(
+    int32_t index, UBool exec, const char *&name, char *par /*= nullptr*/)
+{
+    (void)par;
+    TESTCASE_AUTO_BEGIN;
+
+    TESTCASE_AUTO(TestCacheHit1Thread);
+    TESTCASE_AUTO(TestCacheHit4Threads);
+    TESTCASE_AUTO(TestCacheHit16Threads);
+    TESTCASE_AUTO(TestCacheHit64Threads);
+
+    TESTCASE_AUTO_END;
+    return nullptr;
+}
+
+int main(int argc, const char *argv[])
+{
+    UErrorCode status = U_ZERO_ERROR;
+    UnifiedCachePerfTest test(argc, argv, status);
+
+    if (U_FAILURE(status)){
+        fprintf(stderr, "The error is %s\n", u_errorName(status));
+        test.usage();
+        return status;
+    }
+
+    if (test.run() == false){
+        test.usage();
+        fprintf(stderr, "FAILED: Tests could not be run please check the arguments.\n");
+        return -1;
+    }
+    return 0;
+}
@@ -45,6 +45,7 @@
     "Roundtrip",      ["$p1,Roundtrip",        "$p2,Roundtrip"],
     "FromUnicode",    ["$p1,FromUnicode",      "$p2,FromUnicode"],
     "FromUTF8",       ["$p1,FromUTF8",         "$p2,FromUTF8"],
+    "ToUnicode",      ["$p1,ToUnicode",        "$p2,ToUnicode"],
 };
 
 my $dataFiles = {
@@ -39,6 +39,8 @@ static char16_t pivot[INTERMEDIATE_CAPACITY];
 static char16_t output[OUTPUT_CAPACITY];
 static char intermediate[OUTPUT_CAPACITY];
 
+static char encoded[OUTPUT_CAPACITY];
+
 static int32_t utf8Length, encodedLength, outputLength, countInputCodePoints;
 
 static int32_t fromUCallbackCount;
@@ -262,6 +264,124 @@ class FromUnicode : public Command {
     }
 };
 
+// Base class for one-way conversions between UTF-16 and an 8-bit form.
+// In addition to the usual timings, prints the best throughput measured,
+// in gigabytes per second of the 8-bit form.
+class Throughput : public Command {
+protected:
+    Throughput(const UtfPerformanceTest &testcase, const char *name)
+            : Command(testcase), name(name), bytes(0), bestSeconds(-1.0) {}
+public:
+    ~Throughput() {
+        if (bestSeconds > 0 && bytes > 0) {
+            printf("%s: %.3f GB/s\n", name, (bytes / bestSeconds) / 1E9);
+        }
+    }
+    double time(int32_t n, UErrorCode* status) override {
+        double t = Command::time(n, status);
+        if (n > 0 && U_SUCCESS(*status)) {
+            double perCall = t / n;
+            if (bestSeconds < 0 || perCall < bestSeconds) {
+                bestSeconds = perCall;
+            }
+        }
+        return t;
+    }
+    long getEventsPerIteration() override {
+        return bytes;
+    }
+protected:
+    const char *name;
+    int32_t bytes;
+    double bestSeconds;
+};
+
+// Test u_strFromUTF8(), independent of --charset.
+class StrFromUTF8 : public Throughput {
+protected:
+    StrFromUTF8(const UtfPerformanceTest &testcase) : Throughput(testcase, "StrFromUTF8") {
+        bytes = utf8Length;
+    }
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        StrFromUTF8 * t = new StrFromUTF8(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return nullptr;
+        }
+    }
+    void call(UErrorCode* pErrorCode) override {
+        u_strFromUTF8(output, OUTPUT_CAPACITY, &outputLength, utf8, utf8Length, pErrorCode);
+    }
+};
+
+// Test u_strToUTF8(), independent of --charset.
+class StrToUTF8 : public Throughput {
+protected:
+    StrToUTF8(const UtfPerformanceTest &testcase) : Throughput(testcase, "StrToUTF8") {
+        bytes = utf8Length;
+    }
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        StrToUTF8 * t = new StrToUTF8(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return nullptr;
+        }
+    }
+    void call(UErrorCode* pErrorCode) override {
+        u_strToUTF8(intermediate, OUTPUT_CAPACITY, &encodedLength, input, inputLength, pErrorCode);
+    }
+};
+
+// Test one-way conversion encoding->UTF-16.
+class ToUnicode : public Throughput {
+protected:
+    ToUnicode(const UtfPerformanceTest &testcase) : Throughput(testcase, "ToUnicode") {
+        if (U_SUCCESS(errorCode)) {
+            bytes = ucnv_fromUChars(cnv, encoded, OUTPUT_CAPACITY, input, inputLength, &errorCode);
+        }
+    }
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        ToUnicode * t = new ToUnicode(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return nullptr;
+        }
+    }
+    void call(UErrorCode* pErrorCode) override {
+        const char *pIn, *pInLimit;
+        char16_t *pOut;
+
+        ucnv_resetToUnicode(cnv);
+
+        pIn=encoded;
+        pInLimit=encoded+bytes;
+        pOut=output;
+
+        /* feed the converter chunks of the requested length, like a stream reader would */
+        while(pIn<pInLimit) {
+            const char *pChunkLimit = pIn + testcase.chunkLength;
+            if(pChunkLimit>pInLimit) {
+                pChunkLimit=pInLimit;
+            }
+            ucnv_toUnicode(cnv, &pOut, output+OUTPUT_CAPACITY, &pIn, pChunkLimit, nullptr,
+                           pChunkLimit==pInLimit, pErrorCode);
+            if(U_FAILURE(*pErrorCode)) {
+                return;
+            }
+        }
+        outputLength = static_cast<int32_t>(pOut - output);
+    }
+};
+
 // Test one-way conversion UTF-8->encoding.
 class FromUTF8 : public Command {
 protected:
@@ -333,6 +453,9 @@ UPerfFunction* UtfPerformanceTest::runIndexedTest(int32_t index, UBool exec, con
         case 0: name = "Roundtrip";     if (exec) return Roundtrip::get(*this); break;
         case 1: name = "FromUnicode";   if (exec) return FromUnicode::get(*this); break;
         case 2: name = "FromUTF8";      if (exec) return FromUTF8::get(*this); break;
+        case 3: name = "ToUnicode";     if (exec) return ToUnicode::get(*this); break;
+        case 4: name = "StrFromUTF8";   if (exec) return StrFromUTF8::get(*this); break;
+        case 5: name = "StrToUTF8";     if (exec) return StrToUTF8::get(*this); break;
         default: name = ""; break;
     }
     return nullptr;